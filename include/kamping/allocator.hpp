@@ -16,9 +16,14 @@
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <mpi.h>
 
+#include "kamping/buffer_pool.hpp"
 #include "kamping/error_handling.hpp"
 
 namespace kamping {
@@ -98,4 +103,128 @@ template <typename T, typename U>
 bool operator!=(MPIAllocator<T> const&, MPIAllocator<U> const&) noexcept {
     return false;
 }
+
+/// @brief Returns an upstream allocator for a \ref BufferPool which obtains its memory using \c MPI_Alloc_mem.
+///
+/// Depending on the MPI implementation, memory allocated by \c MPI_Alloc_mem is registered with the network, which
+/// makes each allocation expensive. Small blocks are therefore carved from slabs of \p slab_size bytes.
+/// @param slab_size The size of the slabs small blocks are carved from.
+inline BufferPool::Upstream mpi_alloc_mem_upstream(size_t slab_size = size_t{1} << 20) {
+    return BufferPool::Upstream{
+        [](size_t num_bytes) -> void* { return MPIAllocator<std::byte>{}.allocate(num_bytes); },
+        [](void* ptr) noexcept { MPIAllocator<std::byte>{}.deallocate(static_cast<std::byte*>(ptr), 0); },
+        slab_size
+    };
+}
+
+/// @brief Returns the pool used by default constructed \ref PooledMPIAllocator objects, which obtains its memory using
+/// \c MPI_Alloc_mem (see \ref mpi_alloc_mem_upstream()).
+///
+/// The pool is never destroyed. As memory allocated by \c MPI_Alloc_mem cannot be freed after finalizing MPI, call
+/// `mpi_buffer_pool().release()` before finalizing MPI to return the cached memory.
+inline BufferPool& mpi_buffer_pool() {
+    static BufferPool* pool = new BufferPool(mpi_alloc_mem_upstream());
+    return *pool;
+}
+
+/// @brief STL-compatible allocator drawing its memory from a \ref BufferPool, by default from \ref mpi_buffer_pool().
+///
+/// Compared to \ref MPIAllocator, this avoids calling \c MPI_Alloc_mem and \c MPI_Free_mem for each allocation.
+/// Note that this allocator may only be used after initializing MPI.
+///
+/// @tparam T The type to allocate.
+template <typename T>
+class PooledMPIAllocator : public BufferPoolAllocator<T> {
+public:
+    /// @brief Constructs an allocator drawing from \ref mpi_buffer_pool().
+    PooledMPIAllocator() noexcept : BufferPoolAllocator<T>(mpi_buffer_pool()) {}
+
+    /// @brief Constructs an allocator drawing from \p pool, which has to outlive all memory allocated from it.
+    explicit PooledMPIAllocator(BufferPool& pool) noexcept : BufferPoolAllocator<T>(pool) {}
+
+    /// @brief Copy constructor for allocators with different value type.
+    template <typename U>
+    PooledMPIAllocator(PooledMPIAllocator<U> const& other) noexcept : BufferPoolAllocator<T>(other.pool()) {}
+};
+
+/// @brief A \c std::vector drawing its memory from \ref mpi_buffer_pool(). Can be used as default container type of a
+/// communicator, such that all buffers allocated by KaMPIng use memory obtained by \c MPI_Alloc_mem, e.g.,
+/// `Communicator<mpi_pooled_vector>`.
+template <typename T>
+class mpi_pooled_vector : public std::vector<T, PooledMPIAllocator<T>> {
+public:
+    using std::vector<T, PooledMPIAllocator<T>>::vector;
+};
+
+/// @brief Allocator adaptor which default-initializes instead of value-initializes elements constructed without
+/// arguments.
+///
+/// Resizing a container (e.g., \c std::vector::resize()) value-initializes the new elements, i.e., trivial types such
+/// as \c int or \c double are set to zero. For receive buffers, this results in an additional pass over the memory
+/// before MPI overwrites the elements. When using this adaptor, such elements are default-initialized instead, which
+/// leaves trivially default constructible elements uninitialized. All other operations are forwarded to \p Allocator.
+///
+/// @tparam T The type to allocate.
+/// @tparam Allocator The underlying allocator.
+template <typename T, typename Allocator = std::allocator<T>>
+class DefaultInitAllocator : public Allocator {
+    using traits = std::allocator_traits<Allocator>; ///< Traits of the underlying allocator.
+
+public:
+    /// @brief Obtains the allocator adaptor for type \c U.
+    template <typename U>
+    struct rebind {
+        /// @brief The allocator adaptor for type \c U.
+        using other = DefaultInitAllocator<U, typename traits::template rebind_alloc<U>>;
+    };
+
+    /// @brief Constructs the underlying allocator using its default constructor.
+    DefaultInitAllocator() = default;
+
+    /// @brief Wraps \p allocator.
+    DefaultInitAllocator(Allocator const& allocator) noexcept : Allocator(allocator) {}
+
+    /// @brief Copy constructor for allocators with different value type.
+    template <typename U, typename OtherAllocator>
+    DefaultInitAllocator(DefaultInitAllocator<U, OtherAllocator> const& other) noexcept
+        : Allocator(static_cast<OtherAllocator const&>(other)) {}
+
+    /// @brief Default-initializes the object at \p ptr.
+    template <typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    /// @brief Constructs the object at \p ptr from \p args using the underlying allocator.
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) noexcept(
+        noexcept(traits::construct(std::declval<Allocator&>(), ptr, std::forward<Args>(args)...))
+    ) {
+        traits::construct(static_cast<Allocator&>(*this), ptr, std::forward<Args>(args)...);
+    }
+};
+
+/// @brief Two allocator adaptors are equal if their underlying allocators are equal.
+template <typename T, typename A, typename U, typename B>
+bool operator==(DefaultInitAllocator<T, A> const& lhs, DefaultInitAllocator<U, B> const& rhs) noexcept {
+    return static_cast<A const&>(lhs) == static_cast<B const&>(rhs);
+}
+
+/// @brief Two allocator adaptors are equal if their underlying allocators are equal.
+template <typename T, typename A, typename U, typename B>
+bool operator!=(DefaultInitAllocator<T, A> const& lhs, DefaultInitAllocator<U, B> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/// @brief A \c std::vector which does not zero its elements when being resized, see \ref DefaultInitAllocator.
+///
+/// This can be used for buffers allocated by KaMPIng, either for a single buffer (e.g.,
+/// `recv_buf(alloc_new<default_init_vector<int>>)`), or for all buffers allocated by a communicator by using it as
+/// default container type, i.e., `Communicator<default_init_vector>`. Note that elements are also left uninitialized
+/// when the container is constructed with a size, e.g., `default_init_vector<int> v(42)`.
+template <typename T>
+class default_init_vector : public std::vector<T, DefaultInitAllocator<T>> {
+public:
+    using std::vector<T, DefaultInitAllocator<T>>::vector;
+};
 } // namespace kamping
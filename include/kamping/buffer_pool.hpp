@@ -0,0 +1,346 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// @brief A pool caching memory blocks between allocations, and an allocator drawing from it.
+///
+/// Collective operations allocate their (default) receive buffers, counts and displacements anew on each call. In
+/// tight loops, the cost of these allocations (and of the page faults when first touching freshly mapped memory) is
+/// measurable. Using \ref kamping::pooled_vector as default container type of a communicator, i.e.,
+/// `Communicator<pooled_vector>`, all internally allocated buffers are drawn from a \ref kamping::BufferPool, and
+/// returned to it when the result buffers are destroyed. After a warm-up phase, repeatedly calling the same operations
+/// therefore no longer allocates any memory. Pools can also draw from other upstream allocators, e.g., from \c
+/// MPI_Alloc_mem (see \ref kamping::mpi_pooled_vector).
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace kamping {
+
+/// @brief Caches freed memory blocks for later reuse.
+///
+/// Requests are rounded up to the next power of two (size class). Freed blocks are kept in a free list per size class
+/// and handed out again for requests of the same size class, instead of being returned to the upstream allocator
+/// (\c operator \c new by default, see \ref Upstream). The pool is thread-safe: allocations and deallocations are
+/// serialized by a mutex, such that blocks may be allocated and freed concurrently, also by different threads.
+///
+/// If the upstream allocator has a non-zero slab size, small blocks (of at most a quarter of the slab size) are not
+/// requested from the upstream allocator one by one, but carved from larger slabs. This is useful if each upstream
+/// allocation is expensive, e.g., because the memory is registered with the network (see \ref mpi_buffer_pool()).
+/// Blocks carved from slabs are always cached and the slabs are only returned to the upstream allocator by \ref
+/// release() if none of their blocks is in use.
+class BufferPool {
+public:
+    /// @brief Statistics about the allocations served by a \ref BufferPool.
+    struct Statistics {
+        size_t num_allocations          = 0; ///< The number of allocations served.
+        size_t num_reused               = 0; ///< The number of allocations served from a cached block.
+        size_t num_upstream_allocations = 0; ///< The number of blocks and slabs allocated from upstream.
+        size_t cached_bytes             = 0; ///< The number of bytes currently cached in the free lists.
+        size_t upstream_bytes           = 0; ///< The number of bytes currently allocated from upstream.
+    };
+
+    /// @brief The allocator a \ref BufferPool obtains its memory from.
+    struct Upstream {
+        /// @brief Returns a block of at least the given number of bytes, aligned to `alignof(std::max_align_t)`.
+        /// Throws if the allocation fails.
+        void* (*allocate)(size_t);
+        /// @brief Returns a block obtained from \c allocate.
+        void (*deallocate)(void*) noexcept;
+        /// @brief The size of the slabs small blocks are carved from. If zero, all blocks are allocated separately.
+        size_t slab_size = 0;
+    };
+
+    /// @brief Returns the upstream allocator using \c operator \c new and \c operator \c delete.
+    static Upstream new_delete_upstream() {
+        return Upstream{
+            [](size_t num_bytes) { return ::operator new(num_bytes); },
+            [](void* ptr) noexcept { ::operator delete(ptr); }
+        };
+    }
+
+    /// @brief Constructs an empty pool.
+    /// @param max_cached_bytes The maximum number of bytes kept in the free lists. Blocks freed when this limit is
+    /// reached are returned to the system.
+    explicit BufferPool(size_t max_cached_bytes = std::numeric_limits<size_t>::max())
+        : BufferPool(new_delete_upstream(), max_cached_bytes) {}
+
+    /// @brief Constructs an empty pool obtaining its memory from \p upstream.
+    /// @param upstream The upstream allocator.
+    /// @param max_cached_bytes The maximum number of bytes kept in the free lists. Blocks freed when this limit is
+    /// reached are returned to the upstream allocator. Blocks carved from slabs are not subject to this limit.
+    explicit BufferPool(Upstream upstream, size_t max_cached_bytes = std::numeric_limits<size_t>::max())
+        : _upstream(upstream),
+          _max_cached_bytes(max_cached_bytes) {}
+
+    /// @brief Copying a pool is not allowed.
+    BufferPool(BufferPool const&) = delete;
+    /// @brief Copying a pool is not allowed.
+    BufferPool& operator=(BufferPool const&) = delete;
+
+    /// @brief Returns all cached blocks and all slabs to the upstream allocator. Blocks which are still in use must not
+    /// be used or returned to the pool afterwards.
+    ~BufferPool() {
+        release();
+        release_slabs();
+    }
+
+    /// @brief Returns a block of at least \p num_bytes bytes, aligned to `alignof(std::max_align_t)`.
+    void* allocate(size_t num_bytes) {
+        size_t const                size_class = size_class_of(num_bytes);
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_statistics.num_allocations;
+        auto& free_list = _free_lists[size_class];
+        if (!free_list.empty()) {
+            void* block = free_list.back();
+            free_list.pop_back();
+            ++_statistics.num_reused;
+            _statistics.cached_bytes -= block_size(size_class);
+            if (is_carved(size_class)) {
+                ++_num_carved_in_use;
+            }
+            return block;
+        }
+        if (is_carved(size_class)) {
+            return carve(size_class);
+        }
+        void* block = _upstream.allocate(block_size(size_class));
+        ++_statistics.num_upstream_allocations;
+        _statistics.upstream_bytes += block_size(size_class);
+        return block;
+    }
+
+    /// @brief Returns the block \p ptr of \p num_bytes bytes (as passed to \ref allocate()) to the pool.
+    void deallocate(void* ptr, size_t num_bytes) noexcept {
+        size_t const                size_class = size_class_of(num_bytes);
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (is_carved(size_class)) {
+            --_num_carved_in_use;
+            // Blocks carved from a slab cannot be returned separately. If caching fails, the block is lost until the
+            // slabs are released.
+            try {
+                _free_lists[size_class].push_back(ptr);
+                _statistics.cached_bytes += block_size(size_class);
+            } catch (std::bad_alloc const&) {
+            }
+            return;
+        }
+        if (_statistics.cached_bytes + block_size(size_class) > _max_cached_bytes) {
+            return_upstream(ptr, size_class);
+            return;
+        }
+        // push_back may throw, in which case we free the block instead of caching it
+        try {
+            _free_lists[size_class].push_back(ptr);
+            _statistics.cached_bytes += block_size(size_class);
+        } catch (std::bad_alloc const&) {
+            return_upstream(ptr, size_class);
+        }
+    }
+
+    /// @brief Returns all cached blocks to the upstream allocator. Slabs are returned if none of the blocks carved from
+    /// them is in use.
+    void release() noexcept {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t size_class = 0; size_class < num_size_classes; ++size_class) {
+            if (is_carved(size_class)) {
+                continue;
+            }
+            auto& free_list = _free_lists[size_class];
+            for (void* block: free_list) {
+                return_upstream(block, size_class);
+            }
+            _statistics.cached_bytes -= free_list.size() * block_size(size_class);
+            free_list.clear();
+        }
+        if (_num_carved_in_use == 0) {
+            release_slabs();
+        }
+    }
+
+    /// @brief Returns a snapshot of the statistics about the allocations served by this pool.
+    Statistics statistics() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _statistics;
+    }
+
+    /// @brief Returns the pool used by default constructed \ref BufferPoolAllocator objects. It is never destroyed,
+    /// such that containers with static storage duration can safely return their memory at program exit.
+    static BufferPool& default_pool() {
+        static BufferPool* pool = new BufferPool();
+        return *pool;
+    }
+
+private:
+    static constexpr size_t num_size_classes = std::numeric_limits<size_t>::digits; ///< One per power of two.
+
+    /// @brief Returns the index of the smallest power of two which is at least \p num_bytes.
+    /// @throws std::bad_alloc if \p num_bytes exceeds the largest power of two representable as \c size_t.
+    static size_t size_class_of(size_t num_bytes) {
+        size_t size_class = 0;
+        while (block_size(size_class) < num_bytes) {
+            ++size_class;
+            if (size_class == num_size_classes) {
+                throw std::bad_alloc();
+            }
+        }
+        return size_class;
+    }
+
+    /// @brief Returns the size of the blocks of size class \p size_class.
+    static constexpr size_t block_size(size_t size_class) {
+        return size_t{1} << size_class;
+    }
+
+    /// @brief Returns whether blocks of size class \p size_class are carved from slabs.
+    bool is_carved(size_t size_class) const {
+        return block_size(size_class) <= _upstream.slab_size / 4;
+    }
+
+    /// @brief Carves a new block of size class \p size_class from the current slab, allocating a new slab if the
+    /// current one is exhausted. The remainder of an exhausted slab is not used.
+    void* carve(size_t size_class) {
+        // keep all blocks aligned to max_align_t
+        size_t const num_bytes = std::max(block_size(size_class), alignof(std::max_align_t));
+        if (_slab_remaining < num_bytes) {
+            _slabs.reserve(_slabs.size() + 1);
+            void* slab = _upstream.allocate(_upstream.slab_size);
+            _slabs.push_back(slab);
+            ++_statistics.num_upstream_allocations;
+            _statistics.upstream_bytes += _upstream.slab_size;
+            _slab_position  = static_cast<std::byte*>(slab);
+            _slab_remaining = _upstream.slab_size;
+        }
+        void* block = _slab_position;
+        _slab_position += num_bytes;
+        _slab_remaining -= num_bytes;
+        ++_num_carved_in_use;
+        return block;
+    }
+
+    /// @brief Returns the block \p ptr of size class \p size_class to the upstream allocator.
+    void return_upstream(void* ptr, size_t size_class) noexcept {
+        _upstream.deallocate(ptr);
+        _statistics.upstream_bytes -= block_size(size_class);
+    }
+
+    /// @brief Returns all slabs to the upstream allocator and drops the cached blocks carved from them.
+    void release_slabs() noexcept {
+        for (size_t size_class = 0; size_class < num_size_classes && is_carved(size_class); ++size_class) {
+            _statistics.cached_bytes -= _free_lists[size_class].size() * block_size(size_class);
+            _free_lists[size_class].clear();
+        }
+        for (void* slab: _slabs) {
+            _upstream.deallocate(slab);
+            _statistics.upstream_bytes -= _upstream.slab_size;
+        }
+        _slabs.clear();
+        _slab_position  = nullptr;
+        _slab_remaining = 0;
+    }
+
+    Upstream                                         _upstream;                    ///< The upstream allocator.
+    std::array<std::vector<void*>, num_size_classes> _free_lists;                  ///< The free lists.
+    size_t                                           _max_cached_bytes;            ///< The maximum cached bytes.
+    std::vector<void*>                               _slabs;                       ///< The slabs to carve blocks from.
+    std::byte*                                       _slab_position     = nullptr; ///< The next free byte in the slab.
+    size_t                                           _slab_remaining    = 0;       ///< The free bytes in the slab.
+    size_t                                           _num_carved_in_use = 0;       ///< The carved blocks in use.
+    Statistics                                       _statistics;                  ///< The statistics.
+    mutable std::mutex                               _mutex;                       ///< Serializes accesses.
+};
+
+/// @brief STL-compatible allocator drawing its memory from a \ref BufferPool.
+///
+/// Default constructed allocators use \ref BufferPool::default_pool(), which is shared by all threads. Containers using
+/// this allocator can therefore be allocated and freed concurrently, e.g., by threads using \ref ThreadCommunicators.
+///
+/// @tparam T The type to allocate.
+template <typename T>
+class BufferPoolAllocator {
+public:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "BufferPoolAllocator does not support over-aligned types.");
+
+    /// @brief The value type.
+    using value_type = T;
+
+    /// @brief Memory is owned by the pool, so it can be moved along with the allocator.
+    using propagate_on_container_move_assignment = std::true_type;
+
+    /// @brief Constructs an allocator drawing from \ref BufferPool::default_pool().
+    BufferPoolAllocator() noexcept : _pool(&BufferPool::default_pool()) {}
+
+    /// @brief Constructs an allocator drawing from \p pool, which has to outlive all memory allocated from it.
+    explicit BufferPoolAllocator(BufferPool& pool) noexcept : _pool(&pool) {}
+
+    /// @brief Copy constructor for allocators with different value type.
+    template <typename U>
+    BufferPoolAllocator(BufferPoolAllocator<U> const& other) noexcept : _pool(&other.pool()) {}
+
+    /// @brief Allocates storage for \p n objects of type \c T.
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(_pool->allocate(n * sizeof(T)));
+    }
+
+    /// @brief Returns the storage referenced by \p p, which must have been obtained by \ref allocate() with the same
+    /// \p n, to the pool.
+    void deallocate(T* p, size_t n) noexcept {
+        _pool->deallocate(p, n * sizeof(T));
+    }
+
+    /// @brief Returns the pool this allocator draws from.
+    BufferPool& pool() const noexcept {
+        return *_pool;
+    }
+
+private:
+    BufferPool* _pool; ///< The pool this allocator draws from.
+};
+
+/// @brief Two allocators are equal if they draw from the same pool.
+template <typename T, typename U>
+bool operator==(BufferPoolAllocator<T> const& lhs, BufferPoolAllocator<U> const& rhs) noexcept {
+    return &lhs.pool() == &rhs.pool();
+}
+
+/// @brief Two allocators are equal if they draw from the same pool.
+template <typename T, typename U>
+bool operator!=(BufferPoolAllocator<T> const& lhs, BufferPoolAllocator<U> const& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/// @brief A \c std::vector drawing its memory from \ref BufferPool::default_pool(). Can be used as default container
+/// type of a communicator to avoid repeated allocations of buffers allocated by KaMPIng, e.g.,
+/// `Communicator<pooled_vector>`.
+///
+/// This is a class instead of an alias template, such that it can be passed as template template parameter which is
+/// expanded with a parameter pack (as done by \ref Communicator::default_container_type).
+template <typename T>
+class pooled_vector : public std::vector<T, BufferPoolAllocator<T>> {
+public:
+    using std::vector<T, BufferPoolAllocator<T>>::vector;
+};
+
+} // namespace kamping
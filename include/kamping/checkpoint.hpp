@@ -0,0 +1,295 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Writing the distributed state of an application to a checkpoint file and restoring it, possibly on a
+/// different number of ranks.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/barrier.hpp"
+#include "kamping/collectives/bcast.hpp"
+#include "kamping/distributed_input.hpp"
+#include "kamping/file.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/named_parameters.hpp"
+#include "kamping/packing.hpp"
+
+namespace kamping {
+
+/// @brief A set of registered containers, which are written to a checkpoint file and restored from it collectively.
+///
+/// Each rank registers the same containers in the same order using \ref add(). A checkpoint is a single file written
+/// in parallel using MPI-IO. For each container, it contains the concatenation of the elements of all ranks (ordered by
+/// rank), preceded by an index of the container names and the number of elements of each rank. The file is written to
+/// a temporary path first and renamed when complete, such that a crash while checkpointing never destroys the previous
+/// checkpoint.
+///
+/// When restoring on the same number of ranks, each rank obtains exactly the elements it has written. Otherwise, the
+/// concatenated elements of each container are redistributed evenly among the ranks (see \ref balanced_partition()).
+class Checkpoint {
+public:
+    /// @brief Registers \p container, which is written to and restored from checkpoints under the name \p name.
+    /// @tparam Container A container providing \c data(), \c size() and \c resize() with trivially copyable elements,
+    /// e.g., \c std::vector.
+    /// @param name The name of the container, which has to be unique.
+    /// @param container The container, which has to outlive this object.
+    template <typename Container>
+    void add(std::string name, Container& container) {
+        using value_type = typename Container::value_type;
+        static_assert(
+            std::is_trivially_copyable_v<value_type>,
+            "Only containers of trivially copyable elements can be checkpointed."
+        );
+        Entry entry;
+        entry.name         = std::move(name);
+        entry.element_size = sizeof(value_type);
+        entry.size         = [&container]() noexcept {
+            return container.size();
+        };
+        entry.write = [&container](File<> const& file, MPI_Offset offset) {
+            file.write_at_all(send_buf(container), file_offset(offset));
+        };
+        entry.read = [&container](File<> const& file, MPI_Offset offset, size_t count) {
+            container.resize(count);
+            file.read_at_all(recv_buf(container), file_offset(offset));
+        };
+        _entries.push_back(std::move(entry));
+    }
+
+    /// @brief Returns the number of registered containers.
+    size_t num_containers() const {
+        return _entries.size();
+    }
+
+    /// @brief Writes all registered containers to the checkpoint file at \p path. This is a collective operation on \p
+    /// comm.
+    /// @param comm The communicator.
+    /// @param path The path of the checkpoint file, which has to be the same on all ranks.
+    /// @param step A number identifying the checkpoint (e.g., the iteration), which is returned by \ref restore().
+    /// @param hints Hints for the MPI implementation.
+    template <typename Comm>
+    void write(
+        Comm const& comm, std::string const& path, uint64_t step = 0, FileHints const& hints = FileHints()
+    ) const {
+        std::vector<uint64_t> local_counts(_entries.size());
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            local_counts[i] = _entries[i].size();
+        }
+        Index index;
+        index.step = step;
+        comm.allgather(send_buf(local_counts), recv_buf<resize_to_fit>(index.counts));
+        for (auto const& entry: _entries) {
+            index.names.push_back(entry.name);
+            index.element_sizes.push_back(entry.element_size);
+        }
+        index.num_ranks = comm.size();
+
+        std::string const temporary_path = path + ".tmp";
+        {
+            File<> const file(comm, temporary_path, MPI_MODE_CREATE | MPI_MODE_WRONLY, hints);
+            file.resize(0);
+            if (comm.rank() == 0) {
+                std::vector<char> const header = index.serialize();
+                file.write_at(send_buf(header), file_offset(0));
+            }
+            for (size_t i = 0; i < _entries.size(); ++i) {
+                _entries[i].write(file, asserting_cast<MPI_Offset>(index.data_offset(i, comm.rank())));
+            }
+        }
+        comm.barrier();
+        if (comm.rank() == 0) {
+            std::filesystem::rename(temporary_path, path);
+        }
+        comm.barrier();
+    }
+
+    /// @brief Restores all registered containers from the checkpoint file at \p path. This is a collective operation on
+    /// \p comm.
+    ///
+    /// The containers registered on this object have to match the ones in the checkpoint in name, order and element
+    /// size. Otherwise, a \c kassert::KassertException is thrown.
+    ///
+    /// @param comm The communicator. Its size may differ from the one of the communicator used for writing.
+    /// @param path The path of the checkpoint file, which has to be the same on all ranks.
+    /// @param hints Hints for the MPI implementation.
+    /// @return The step passed to \ref write().
+    template <typename Comm>
+    uint64_t restore(Comm const& comm, std::string const& path, FileHints const& hints = FileHints()) const {
+        File<> const file(comm, path, MPI_MODE_RDONLY, hints);
+
+        // Only the root reads the index, which is then broadcast to all ranks.
+        std::vector<char> header;
+        if (comm.rank() == 0) {
+            header.resize(Index::fixed_size);
+            file.read_at(recv_buf(header), file_offset(0));
+            header.resize(Index::header_size(header));
+            file.read_at(recv_buf(header), file_offset(0));
+        }
+        comm.bcast(send_recv_buf<resize_to_fit>(header));
+        Index const index = Index::deserialize(header);
+
+        THROWING_KAMPING_ASSERT(
+            index.names.size() == _entries.size(),
+            "The checkpoint contains " << index.names.size() << " containers, but " << _entries.size()
+                                       << " are registered."
+        );
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            THROWING_KAMPING_ASSERT(
+                index.names[i] == _entries[i].name && index.element_sizes[i] == _entries[i].element_size,
+                "The container " << _entries[i].name << " does not match the container " << index.names[i]
+                                 << " in the checkpoint."
+            );
+        }
+
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            if (index.num_ranks == comm.size()) {
+                _entries[i].read(
+                    file,
+                    asserting_cast<MPI_Offset>(index.data_offset(i, comm.rank())),
+                    index.count(comm.rank(), i)
+                );
+            } else {
+                ElementRange const range = balanced_partition(index.total_count(i), comm.rank(), comm.size());
+                _entries[i].read(
+                    file,
+                    asserting_cast<MPI_Offset>(index.data_offset(i, 0) + range.begin * index.element_sizes[i]),
+                    range.size()
+                );
+            }
+        }
+        return index.step;
+    }
+
+private:
+    /// @brief A registered container.
+    struct Entry {
+        std::string                                            name;         ///< The name of the container.
+        size_t                                                 element_size; ///< The size of an element in bytes.
+        std::function<size_t()>                                size;         ///< Returns the number of elements.
+        std::function<void(File<> const&, MPI_Offset)>         write;        ///< Writes the elements collectively.
+        std::function<void(File<> const&, MPI_Offset, size_t)> read;         ///< Resizes and reads collectively.
+    };
+
+    /// @brief The index at the beginning of a checkpoint file, which describes its content.
+    ///
+    /// The index consists of the magic number, the size of the index in bytes, the step, the number of ranks and the
+    /// number of containers (one \c uint64_t each), followed by the element size, the length of the name and the name
+    /// of each container, and the number of elements of each container on each rank (ordered by rank).
+    struct Index {
+        static constexpr uint64_t magic      = 0x54504b43474e504bull; ///< Identifies checkpoint files.
+        static constexpr size_t   fixed_size = 5 * sizeof(uint64_t);  ///< The size of the fixed part of the index.
+
+        uint64_t                 step;          ///< The step passed to \ref write().
+        size_t                   num_ranks;     ///< The number of ranks which wrote the checkpoint.
+        std::vector<std::string> names;         ///< The names of the containers.
+        std::vector<size_t>      element_sizes; ///< The element sizes of the containers.
+        std::vector<uint64_t>    counts;        ///< The number of elements of container \c i on rank \c r at \c r*n+i.
+
+        /// @brief Returns the number of elements of container \p i on rank \p rank.
+        size_t count(size_t rank, size_t i) const {
+            return counts[rank * names.size() + i];
+        }
+
+        /// @brief Returns the number of elements of container \p i on all ranks.
+        size_t total_count(size_t i) const {
+            size_t total = 0;
+            for (size_t rank = 0; rank < num_ranks; ++rank) {
+                total += count(rank, i);
+            }
+            return total;
+        }
+
+        /// @brief Returns the size of the index in bytes.
+        size_t size() const {
+            size_t size = fixed_size + counts.size() * sizeof(uint64_t);
+            for (auto const& name: names) {
+                size += 2 * sizeof(uint64_t) + name.size();
+            }
+            return size;
+        }
+
+        /// @brief Returns the byte offset of the elements of container \p i of rank \p rank in the file.
+        size_t data_offset(size_t i, size_t rank) const {
+            size_t offset = size();
+            for (size_t j = 0; j < i; ++j) {
+                offset += total_count(j) * element_sizes[j];
+            }
+            for (size_t r = 0; r < rank; ++r) {
+                offset += count(r, i) * element_sizes[i];
+            }
+            return offset;
+        }
+
+        /// @brief Returns the size of the index given its fixed part \p header.
+        static size_t header_size(std::vector<char> const& header) {
+            internal::PointerReader reader{header.data(), header.data() + header.size()};
+            THROWING_KAMPING_ASSERT(internal::read_uint64(reader) == magic, "The file is not a checkpoint.");
+            return asserting_cast<size_t>(internal::read_uint64(reader));
+        }
+
+        /// @brief Serializes the index.
+        std::vector<char> serialize() const {
+            std::vector<char>       bytes(size());
+            internal::PointerWriter writer{bytes.data()};
+            internal::write_uint64(writer, magic);
+            internal::write_uint64(writer, size());
+            internal::write_uint64(writer, step);
+            internal::write_uint64(writer, num_ranks);
+            internal::write_uint64(writer, names.size());
+            for (size_t i = 0; i < names.size(); ++i) {
+                internal::write_uint64(writer, element_sizes[i]);
+                // the name is stored as its length followed by its characters
+                internal::Packer<std::string>::write(names[i], writer);
+            }
+            writer.write(counts.data(), counts.size() * sizeof(uint64_t));
+            return bytes;
+        }
+
+        /// @brief Deserializes an index serialized by \ref serialize().
+        static Index deserialize(std::vector<char> const& bytes) {
+            internal::PointerReader reader{bytes.data(), bytes.data() + bytes.size()};
+            Index                   index;
+            internal::read_uint64(reader); // magic
+            internal::read_uint64(reader); // size
+            index.step                  = internal::read_uint64(reader);
+            index.num_ranks             = asserting_cast<size_t>(internal::read_uint64(reader));
+            size_t const num_containers = asserting_cast<size_t>(internal::read_uint64(reader));
+            index.names.resize(num_containers);
+            for (auto& name: index.names) {
+                index.element_sizes.push_back(asserting_cast<size_t>(internal::read_uint64(reader)));
+                internal::Packer<std::string>::read(reader, name);
+            }
+            index.counts.resize(index.num_ranks * num_containers);
+            reader.read(index.counts.data(), index.counts.size() * sizeof(uint64_t));
+            return index;
+        }
+    };
+
+    std::vector<Entry> _entries; ///< The registered containers.
+};
+
+} // namespace kamping
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <numeric>
+#include <vector>
 
 #include <mpi.h>
 
@@ -30,6 +31,8 @@
 #include "kamping/named_parameter_types.hpp"
 #include "kamping/named_parameters.hpp"
 #include "kamping/result.hpp"
+#include "kamping/serialization.hpp"
+#include "kamping/span.hpp"
 
 /// @addtogroup kamping_collectives
 /// @{
@@ -310,6 +313,10 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::allgather_inplace(
 /// - \ref kamping::recv_type() specifying the \c MPI datatype to use as recv type. If omitted, the \c
 /// MPI datatype is derived automatically based on recv_buf's underlying \c value_type.
 ///
+/// Gathering arbitrary (serializable) objects is supported by passing the object wrapped in \ref
+/// kamping::as_serialized() or \ref kamping::as_packed() as send buffer. This changes the requirements for the other
+/// parameters, see \ref Communicator::allgatherv_serialized.
+///
 /// @tparam Args Automatically deduced template parameters.
 /// @param args All required and any number of the optional parameters described above.
 /// @return Result object wrapping the output parameters to be returned by value.
@@ -324,6 +331,26 @@ template <
     typename... Plugins>
 template <typename... Args>
 auto kamping::Communicator<DefaultContainerType, Plugins...>::allgatherv(Args... args) const {
+    constexpr bool is_serialization_used =
+        internal::parameter_uses_serialization<internal::ParameterType::send_buf, Args...>();
+    if constexpr (is_serialization_used) {
+        return this->allgatherv_serialized(std::forward<Args>(args)...);
+    } else {
+        return this->allgatherv_plain(std::forward<Args>(args)...);
+    }
+}
+
+/// @brief Wrapper for \c MPI_Allgatherv operating on plain (not serialized) data.
+///
+/// This variant is selected by \ref Communicator::allgatherv() if the send buffer is not passed via \ref
+/// kamping::as_serialized() or \ref kamping::as_packed(). See there for the supported parameters.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::allgatherv_plain(Args... args) const {
     using namespace kamping::internal;
     KAMPING_CHECK_PARAMETERS(
         Args,
@@ -454,4 +481,63 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::allgatherv(Args...
         std::move(recv_type)
     );
 }
+
+/// @brief Wrapper for \c MPI_Allgatherv operating on serialized objects.
+///
+/// This variant is selected by \ref Communicator::allgatherv() if the send buffer is passed via \ref
+/// kamping::as_serialized(). Each rank serializes its object, the serialized sizes are exchanged and the serialized
+/// data is collected with a single \c MPI_Allgatherv on bytes. The received data is not deserialized eagerly, instead a
+/// \ref kamping::DeserializableBlocks object is returned, which deserializes the object received from each rank on
+/// request.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the object to send wrapped in \ref kamping::as_serialized() or \ref
+/// kamping::as_packed().
+///
+/// The following parameters are optional:
+/// - \ref kamping::recv_buf() containing \ref kamping::as_deserializable<T>() or \ref kamping::as_unpackable<T>(),
+/// specifying the type `T` each received object is deserialized into as well as the archive used for deserialization.
+/// If omitted, the type of the sent object is used together with the archive matching the send buffer, i.e., \ref
+/// kamping::PackingInputArchive for \ref kamping::as_packed() and `cereal::BinaryInputArchive` otherwise.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return Result object wrapping the output parameters to be returned by value. The received objects are returned as
+/// \ref kamping::DeserializableBlocks holding the serialized objects received from each rank.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::allgatherv_serialized(Args... args) const {
+    using namespace kamping::internal;
+    KAMPING_CHECK_PARAMETERS(Args, KAMPING_REQUIRED_PARAMETERS(send_buf), KAMPING_OPTIONAL_PARAMETERS(recv_buf));
+    static_assert(
+        !has_parameter_type<ParameterType::recv_buf, Args...>() ||
+            parameter_uses_serialization<ParameterType::recv_buf, Args...>(),
+        "When sending serialized data, the receive buffer has to be passed using as_deserializable() or "
+        "as_unpackable()."
+    );
+
+    auto send_buf = select_parameter_type<ParameterType::send_buf>(args...)
+                        .template construct_buffer_or_rebind<DefaultContainerType, serialization_support_tag>();
+    auto& serialization_buffer = send_buf.underlying();
+    using send_object_type     = typename std::remove_reference_t<decltype(serialization_buffer)>::object_type;
+    using result_type          = deserializable_blocks_type<
+        send_object_type,
+        in_archive_or_default_t<typename std::remove_reference_t<decltype(serialization_buffer)>::in_archive_type>,
+        Args...>;
+
+    serialization_buffer.serialize();
+    auto result = this->allgatherv(
+        kamping::send_buf(Span<char const>(serialization_buffer.data(), serialization_buffer.size())),
+        kamping::recv_buf(alloc_new<std::vector<char, typename result_type::allocator_type>>),
+        kamping::recv_counts_out(alloc_new<std::vector<int>>),
+        kamping::recv_displs_out(alloc_new<std::vector<int>>)
+    );
+    result_type blocks(result.extract_recv_buf(), result.extract_recv_counts(), result.extract_recv_displs());
+    auto        recv_buf = kamping::recv_buf(std::move(blocks)).construct_buffer_or_rebind();
+    return make_mpi_result<std::tuple<Args...>>(std::move(recv_buf));
+}
 /// @}
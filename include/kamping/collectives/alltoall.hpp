@@ -17,19 +17,26 @@
 #include <numeric>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <mpi.h>
 
+#include "kamping/allocator.hpp"
 #include "kamping/assertion_levels.hpp"
 #include "kamping/checking_casts.hpp"
+#include "kamping/collectives/alltoallv_algorithms.hpp"
 #include "kamping/collectives/collectives_helpers.hpp"
 #include "kamping/comm_helper/is_same_on_all_ranks.hpp"
 #include "kamping/communicator.hpp"
+#include "kamping/compression.hpp"
 #include "kamping/kassert/kassert.hpp"
+#include "kamping/large_count.hpp"
 #include "kamping/named_parameter_check.hpp"
 #include "kamping/named_parameter_selection.hpp"
 #include "kamping/named_parameters.hpp"
 #include "kamping/result.hpp"
+#include "kamping/serialization.hpp"
+#include "kamping/span.hpp"
 
 /// @addtogroup kamping_collectives
 /// @{
@@ -312,6 +319,22 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::alltoall_inplace(A
 /// - \ref kamping::recv_type() specifying the \c MPI datatype to use as recv type. If omitted, the \c MPI datatype is
 /// derived automatically based on recv_buf's underlying \c value_type.
 ///
+/// - \ref kamping::alltoallv_algorithm() specifying the algorithm used for the exchange. Pass one of the tags from the
+/// \c kamping::alltoallv_algorithms namespace to use an algorithm implemented in KaMPIng on top of point-to-point
+/// communication instead of the \c MPI_Alltoallv provided by the MPI implementation (the default). These algorithms
+/// exchange their messages on a duplicate of the communicator, which is created on first use and cached, such that
+/// they never match point-to-point messages of the application.
+///
+/// Exchanging arbitrary (serializable) objects is supported by passing a range of one object per rank wrapped in \ref
+/// kamping::as_serialized() or \ref kamping::as_packed() as send buffer. This changes the requirements for the other
+/// parameters, see \ref Communicator::alltoallv_serialized.
+///
+/// Ranges of integers can be compressed before the exchange by wrapping them in \ref kamping::compressed(), see \ref
+/// Communicator::alltoallv_compressed.
+///
+/// If the counts and displacements are passed using another type than \c int (e.g., \c MPI_Count or \c size_t), more
+/// than `2^31 - 1` elements can be exchanged with each rank, see \ref Communicator::alltoallv_large_count.
+///
 /// @tparam Args Automatically deduced template parameters.
 /// @param args All required and any number of the optional buffers described above.
 /// @return Result object wrapping the output parameters to be returned by value.
@@ -326,11 +349,39 @@ template <
     typename... Plugins>
 template <typename... Args>
 auto kamping::Communicator<DefaultContainerType, Plugins...>::alltoallv(Args... args) const {
+    constexpr bool is_serialization_used =
+        internal::parameter_uses_serialization<internal::ParameterType::send_buf, Args...>();
+    constexpr bool is_compression_used =
+        internal::parameter_uses_compression<internal::ParameterType::send_buf, Args...>();
+    constexpr bool is_large_count_used =
+        internal::parameter_uses_large_counts<internal::ParameterType::send_counts, Args...>();
+    if constexpr (is_serialization_used) {
+        return this->alltoallv_serialized(std::forward<Args>(args)...);
+    } else if constexpr (is_compression_used) {
+        return this->alltoallv_compressed(std::forward<Args>(args)...);
+    } else if constexpr (is_large_count_used) {
+        return this->alltoallv_large_count(std::forward<Args>(args)...);
+    } else {
+        return this->alltoallv_plain(std::forward<Args>(args)...);
+    }
+}
+
+/// @brief Wrapper for \c MPI_Alltoallv operating on plain (neither serialized nor compressed) data with \c int counts.
+///
+/// This variant is selected by \ref Communicator::alltoallv() if none of the other variants applies. See there for the
+/// supported parameters.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::alltoallv_plain(Args... args) const {
     // Get all parameter objects
     KAMPING_CHECK_PARAMETERS(
         Args,
         KAMPING_REQUIRED_PARAMETERS(send_buf, send_counts),
-        KAMPING_OPTIONAL_PARAMETERS(recv_counts, recv_buf, send_displs, recv_displs, send_type, recv_type)
+        KAMPING_OPTIONAL_PARAMETERS(recv_counts, recv_buf, send_displs, recv_displs, send_type, recv_type, algorithm)
     );
 
     // Get send_buf
@@ -339,6 +390,15 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::alltoallv(Args...
     using send_value_type         = typename std::remove_reference_t<decltype(send_buf)>::value_type;
     using default_recv_value_type = std::remove_const_t<send_value_type>;
 
+    // Get algorithm
+    using default_algorithm_type = decltype(kamping::alltoallv_algorithm(alltoallv_algorithms::builtin));
+    auto const& algorithm_param =
+        internal::select_parameter_type_or_default<internal::ParameterType::algorithm, default_algorithm_type>(
+            std::tuple<>(),
+            args...
+        );
+    using algorithm_type = typename std::remove_reference_t<decltype(algorithm_param)>::algorithm_type;
+
     // Get recv_buf
     using default_recv_buf_type = decltype(kamping::recv_buf(alloc_new<DefaultContainerType<default_recv_value_type>>));
     auto recv_buf =
@@ -473,21 +533,408 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::alltoallv(Args...
     );
 
     // Do the actual alltoallv
-    [[maybe_unused]] int err = MPI_Alltoallv(
+    [[maybe_unused]] int err = internal::alltoallv_with_algorithm(
+        algorithm_param.algorithm,
+        internal::AlltoallvArgs{
+            send_buf.data(),                // send_buf
+            send_counts.data(),             // send_counts
+            send_displs.data(),             // send_displs
+            send_type.get_single_element(), // send_type
+            recv_buf.data(),                // recv_buf
+            recv_counts.data(),             // recv_counts
+            recv_displs.data(),             // recv_displs
+            recv_type.get_single_element(), // recv_type
+            mpi_communicator()              // comm
+        }
+    );
+
+    this->mpi_error_hook(err, algorithm_type::mpi_function_name);
+
+    return internal::make_mpi_result<std::tuple<Args...>>(
+        std::move(recv_buf),    // recv_buf
+        std::move(recv_counts), // recv_counts
+        std::move(recv_displs), // recv_displs
+        std::move(send_displs), // send_displs
+        std::move(send_type),   // send_type
+        std::move(recv_type)    // recv_type
+    );
+}
+
+/// @brief Wrapper for \c MPI_Alltoallv operating on serialized objects.
+///
+/// This variant is selected by \ref Communicator::alltoallv() if the send buffer is passed via \ref
+/// kamping::as_serialized(). The send buffer has to be a range containing exactly one object per rank; the `i`-th
+/// object is sent to rank `i`. All objects are serialized back to back into a single contiguous buffer, the number of
+/// bytes per destination is used as send counts and the data is exchanged with a single \c MPI_Alltoallv on bytes. The
+/// received data is not deserialized eagerly, instead a \ref kamping::DeserializableBlocks object is returned, which
+/// deserializes the object received from each rank on request.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing a range of `comm.size()` objects wrapped in \ref kamping::as_serialized() or
+/// \ref kamping::as_packed().
+///
+/// The following parameters are optional:
+/// - \ref kamping::recv_buf() containing \ref kamping::as_deserializable<T>() or \ref kamping::as_unpackable<T>(),
+/// specifying the type `T` each received object is deserialized into as well as the archive used for deserialization.
+/// If omitted, the value type of the send range is used together with the archive matching the send buffer, i.e., \ref
+/// kamping::PackingInputArchive for \ref kamping::as_packed() and `cereal::BinaryInputArchive` otherwise.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional buffers described above.
+/// @return Result object wrapping the output parameters to be returned by value. The received objects are returned as
+/// \ref kamping::DeserializableBlocks holding the serialized objects received from each rank.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::alltoallv_serialized(Args... args) const {
+    using namespace internal;
+    KAMPING_CHECK_PARAMETERS(Args, KAMPING_REQUIRED_PARAMETERS(send_buf), KAMPING_OPTIONAL_PARAMETERS(recv_buf));
+    static_assert(
+        !has_parameter_type<ParameterType::recv_buf, Args...>() ||
+            parameter_uses_serialization<ParameterType::recv_buf, Args...>(),
+        "When sending serialized data, the receive buffer has to be passed using as_deserializable() or "
+        "as_unpackable()."
+    );
+
+    auto send_buf = select_parameter_type<ParameterType::send_buf>(args...)
+                        .template construct_buffer_or_rebind<DefaultContainerType, serialization_support_tag>();
+    auto& serialization_buffer = send_buf.underlying();
+    using send_range_type      = typename std::remove_reference_t<decltype(serialization_buffer)>::object_type;
+    using result_type          = deserializable_blocks_type<
+        std::remove_const_t<typename send_range_type::value_type>,
+        in_archive_or_default_t<typename std::remove_reference_t<decltype(serialization_buffer)>::in_archive_type>,
+        Args...>;
+
+    std::vector<int> send_counts;
+    serialization_buffer.serialize_each(send_counts);
+    KAMPING_ASSERT(
+        send_counts.size() == this->size(),
+        "The serialized send buffer has to contain exactly one object per rank.",
+        assert::light
+    );
+
+    auto result = this->alltoallv(
+        kamping::send_buf(Span<char const>(serialization_buffer.data(), serialization_buffer.size())),
+        kamping::send_counts(send_counts),
+        kamping::recv_buf(alloc_new<std::vector<char, typename result_type::allocator_type>>),
+        kamping::recv_counts_out(alloc_new<std::vector<int>>),
+        kamping::recv_displs_out(alloc_new<std::vector<int>>)
+    );
+    result_type blocks(result.extract_recv_buf(), result.extract_recv_counts(), result.extract_recv_displs());
+    auto        recv_buf = kamping::recv_buf(std::move(blocks)).construct_buffer_or_rebind();
+    return make_mpi_result<std::tuple<Args...>>(std::move(recv_buf));
+}
+
+/// @brief Wrapper for \c MPI_Alltoallv exchanging compressed integers.
+///
+/// This variant is selected by \ref Communicator::alltoallv() if the send buffer is passed via \ref
+/// kamping::compressed(). The block of elements destined for each rank is delta and variable-byte encoded (see \ref
+/// compression.hpp) into a byte buffer. As for the uncompressed variant, the number of bytes sent to each rank is
+/// exchanged with an \c MPI_Alltoall, afterwards the encoded blocks are exchanged with a single \c MPI_Alltoallv. Each
+/// received block starts with its number of elements, from which the receive counts are computed. Finally, the received
+/// blocks are decoded into the receive buffer.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the integers to send wrapped in \ref kamping::compressed().
+///
+/// - \ref kamping::send_counts() containing the number of elements to send to each rank.
+///
+/// The following parameters are optional:
+/// - \ref kamping::send_displs() containing the offsets of the messages in send_buf. If omitted, this is calculated as
+/// the exclusive prefix-sum of `send_counts`.
+///
+/// - \ref kamping::recv_buf() specifying a buffer for the decoded output. Its \c value_type has to match the value type
+/// of the compressed send buffer.
+///
+/// - \ref kamping::recv_counts_out() and \ref kamping::recv_displs_out() to obtain the number of elements received from
+/// each rank and their offsets in the receive buffer. As these are derived from the received data, they can only be
+/// passed as out parameters.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional buffers described above.
+/// @return Result object wrapping the output parameters to be returned by value.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::alltoallv_compressed(Args... args) const {
+    using namespace internal;
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(send_buf, send_counts),
+        KAMPING_OPTIONAL_PARAMETERS(recv_buf, send_displs, recv_counts, recv_displs)
+    );
+
+    // Get send_buf
+    auto const& send_buf = select_parameter_type<ParameterType::send_buf>(args...).construct_buffer_or_rebind();
+    auto const& send_data = send_buf.underlying().underlying();
+    using send_value_type = std::remove_const_t<typename std::remove_reference_t<decltype(send_data)>::value_type>;
+
+    // Get recv_buf
+    using default_recv_buf_type = decltype(kamping::recv_buf(alloc_new<DefaultContainerType<send_value_type>>));
+    auto recv_buf =
+        select_parameter_type_or_default<ParameterType::recv_buf, default_recv_buf_type>(std::tuple<>(), args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    using recv_value_type = typename std::remove_reference_t<decltype(recv_buf)>::value_type;
+    static_assert(
+        std::is_same_v<recv_value_type, send_value_type>,
+        "The receive buffer must have the same value_type as the compressed send buffer."
+    );
+
+    // Get send_counts
+    auto const& send_counts = select_parameter_type<ParameterType::send_counts>(args...)
+                                  .template construct_buffer_or_rebind<DefaultContainerType>();
+    using send_counts_type = typename std::remove_reference_t<decltype(send_counts)>::value_type;
+    static_assert(std::is_same_v<std::remove_const_t<send_counts_type>, int>, "Send counts must be of type int");
+    static_assert(!has_to_be_computed<decltype(send_counts)>, "Send counts must be given as an input parameter");
+    KAMPING_ASSERT(send_counts.size() >= this->size(), "Send counts buffer is not large enough.", assert::light);
+
+    // Get send_displs
+    using default_send_displs_type = decltype(kamping::send_displs_out(alloc_new<DefaultContainerType<int>>));
+    auto send_displs =
+        select_parameter_type_or_default<ParameterType::send_displs, default_send_displs_type>(std::tuple<>(), args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    using send_displs_type = typename std::remove_reference_t<decltype(send_displs)>::value_type;
+    static_assert(std::is_same_v<std::remove_const_t<send_displs_type>, int>, "Send displs must be of type int");
+    if constexpr (has_to_be_computed<decltype(send_displs)>) {
+        send_displs.resize_if_requested([&]() { return this->size(); });
+        KAMPING_ASSERT(send_displs.size() >= this->size(), "Send displs buffer is not large enough.", assert::light);
+        std::exclusive_scan(send_counts.data(), send_counts.data() + this->size(), send_displs.data(), 0);
+    } else {
+        KAMPING_ASSERT(send_displs.size() >= this->size(), "Send displs buffer is not large enough.", assert::light);
+    }
+
+    // Get recv_counts and recv_displs
+    using default_recv_counts_type = decltype(kamping::recv_counts_out(alloc_new<DefaultContainerType<int>>));
+    auto recv_counts =
+        select_parameter_type_or_default<ParameterType::recv_counts, default_recv_counts_type>(std::tuple<>(), args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    using default_recv_displs_type = decltype(kamping::recv_displs_out(alloc_new<DefaultContainerType<int>>));
+    auto recv_displs =
+        select_parameter_type_or_default<ParameterType::recv_displs, default_recv_displs_type>(std::tuple<>(), args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    static_assert(
+        has_to_be_computed<decltype(recv_counts)> && has_to_be_computed<decltype(recv_displs)>,
+        "When sending compressed data, recv counts and recv displs can only be passed as out parameters."
+    );
+    using recv_counts_type = typename std::remove_reference_t<decltype(recv_counts)>::value_type;
+    static_assert(std::is_same_v<std::remove_const_t<recv_counts_type>, int>, "Recv counts must be of type int");
+    using recv_displs_type = typename std::remove_reference_t<decltype(recv_displs)>::value_type;
+    static_assert(std::is_same_v<std::remove_const_t<recv_displs_type>, int>, "Recv displs must be of type int");
+
+    // Encode the block for each destination
+    std::vector<char> encoded;
+    std::vector<int>  encoded_counts(this->size());
+    encoded.reserve(std::size(send_data) * sizeof(send_value_type));
+    for (size_t rank = 0; rank < this->size(); ++rank) {
+        KAMPING_ASSERT(
+            static_cast<size_t>(send_displs.data()[rank] + send_counts.data()[rank]) <= std::size(send_data),
+            "The send buffer is not large enough to hold all elements specified by send counts and send displs.",
+            assert::light
+        );
+        size_t const size_before = encoded.size();
+        encode_delta_varint(
+            std::data(send_data) + send_displs.data()[rank],
+            asserting_cast<size_t>(send_counts.data()[rank]),
+            encoded
+        );
+        encoded_counts[rank] = asserting_cast<int>(encoded.size() - size_before);
+    }
+
+    // The received bytes are overwritten by MPI, so there is no need to zero them first.
+    auto encoded_result = this->alltoallv(
+        kamping::send_buf(encoded),
+        kamping::send_counts(encoded_counts),
+        kamping::recv_buf(alloc_new<default_init_vector<char>>),
+        kamping::recv_counts_out(alloc_new<std::vector<int>>),
+        kamping::recv_displs_out(alloc_new<std::vector<int>>)
+    );
+    auto const& received        = encoded_result.get_recv_buf();
+    auto const& received_displs = encoded_result.get_recv_displs();
+
+    // Every received block starts with its number of elements
+    recv_counts.resize_if_requested([&]() { return this->size(); });
+    KAMPING_ASSERT(recv_counts.size() >= this->size(), "Recv counts buffer is not large enough.", assert::light);
+    for (size_t rank = 0; rank < this->size(); ++rank) {
+        recv_counts.data()[rank] = asserting_cast<int>(decoded_size(received.data() + received_displs[rank]));
+    }
+    recv_displs.resize_if_requested([&]() { return this->size(); });
+    KAMPING_ASSERT(recv_displs.size() >= this->size(), "Recv displs buffer is not large enough.", assert::light);
+    std::exclusive_scan(recv_counts.data(), recv_counts.data() + this->size(), recv_displs.data(), 0);
+
+    // Decode the received blocks
+    auto compute_required_recv_buf_size = [&]() {
+        return asserting_cast<size_t>(recv_displs.data()[this->size() - 1] + recv_counts.data()[this->size() - 1]);
+    };
+    recv_buf.resize_if_requested(compute_required_recv_buf_size);
+    KAMPING_ASSERT(
+        recv_buf.size() >= compute_required_recv_buf_size(),
+        "Recv buffer is not large enough to hold all received elements.",
+        assert::light
+    );
+    for (size_t rank = 0; rank < this->size(); ++rank) {
+        decode_delta_varint(received.data() + received_displs[rank], recv_buf.data() + recv_displs.data()[rank]);
+    }
+
+    return make_mpi_result<std::tuple<Args...>>(
+        std::move(recv_buf),    // recv_buf
+        std::move(recv_counts), // recv_counts
+        std::move(recv_displs), // recv_displs
+        std::move(send_displs)  // send_displs
+    );
+}
+
+/// @brief Wrapper for \c MPI_Alltoallv supporting more than `2^31 - 1` elements per rank.
+///
+/// This variant is selected by \ref Communicator::alltoallv() if the send counts are not of type \c int. All counts and
+/// displacements have to be of the same integral type as the send counts, e.g., \c MPI_Count, \c std::int64_t or \c
+/// size_t. If the MPI library supports MPI-4, the data is exchanged using \c MPI_Alltoallv_c. Otherwise, the block
+/// exchanged with each rank is described by a derived datatype, such that counts and displacements beyond the range of
+/// \c int can be used with \c MPI_Alltoallw.
+///
+/// The parameters are the same as for \ref Communicator::alltoallv().
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional buffers described above.
+/// @return Result object wrapping the output parameters to be returned by value.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::alltoallv_large_count(Args... args) const {
+    using namespace internal;
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(send_buf, send_counts),
+        KAMPING_OPTIONAL_PARAMETERS(recv_counts, recv_buf, send_displs, recv_displs, send_type, recv_type)
+    );
+
+    // Get send_buf
+    auto const& send_buf  = select_parameter_type<ParameterType::send_buf>(args...).construct_buffer_or_rebind();
+    using send_value_type = typename std::remove_reference_t<decltype(send_buf)>::value_type;
+
+    // Get recv_buf
+    using default_recv_buf_type =
+        decltype(kamping::recv_buf(alloc_new<DefaultContainerType<std::remove_const_t<send_value_type>>>));
+    auto recv_buf =
+        select_parameter_type_or_default<ParameterType::recv_buf, default_recv_buf_type>(std::tuple<>(), args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    using recv_value_type = typename std::remove_reference_t<decltype(recv_buf)>::value_type;
+    static_assert(!std::is_const_v<recv_value_type>, "The receive buffer must not have a const value_type.");
+
+    // Get send/recv types
+    auto [send_type, recv_type] =
+        determine_mpi_datatypes<send_value_type, recv_value_type, decltype(recv_buf)>(args...);
+    [[maybe_unused]] constexpr bool recv_type_has_to_be_deduced = has_to_be_computed<decltype(recv_type)>;
+
+    // Get send_counts
+    auto const& send_counts = select_parameter_type<ParameterType::send_counts>(args...)
+                                  .template construct_buffer_or_rebind<DefaultContainerType>();
+    using count_type = std::remove_const_t<typename std::remove_reference_t<decltype(send_counts)>::value_type>;
+    static_assert(std::is_integral_v<count_type>, "Send counts must be of integral type");
+    static_assert(!has_to_be_computed<decltype(send_counts)>, "Send counts must be given as an input parameter");
+    KAMPING_ASSERT(send_counts.size() >= this->size(), "Send counts buffer is not large enough.", assert::light);
+
+    // Get recv_counts
+    using default_recv_counts_type = decltype(kamping::recv_counts_out(alloc_new<DefaultContainerType<count_type>>));
+    auto recv_counts =
+        select_parameter_type_or_default<ParameterType::recv_counts, default_recv_counts_type>(std::tuple<>(), args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    using recv_counts_type = typename std::remove_reference_t<decltype(recv_counts)>::value_type;
+    static_assert(
+        std::is_same_v<std::remove_const_t<recv_counts_type>, count_type>,
+        "Recv counts must be of the same type as send counts"
+    );
+
+    // Get send_displs
+    using default_send_displs_type = decltype(kamping::send_displs_out(alloc_new<DefaultContainerType<count_type>>));
+    auto send_displs =
+        select_parameter_type_or_default<ParameterType::send_displs, default_send_displs_type>(std::tuple<>(), args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    using send_displs_type = typename std::remove_reference_t<decltype(send_displs)>::value_type;
+    static_assert(
+        std::is_same_v<std::remove_const_t<send_displs_type>, count_type>,
+        "Send displs must be of the same type as send counts"
+    );
+
+    // Get recv_displs
+    using default_recv_displs_type = decltype(kamping::recv_displs_out(alloc_new<DefaultContainerType<count_type>>));
+    auto recv_displs =
+        select_parameter_type_or_default<ParameterType::recv_displs, default_recv_displs_type>(std::tuple<>(), args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    using recv_displs_type = typename std::remove_reference_t<decltype(recv_displs)>::value_type;
+    static_assert(
+        std::is_same_v<std::remove_const_t<recv_displs_type>, count_type>,
+        "Recv displs must be of the same type as send counts"
+    );
+
+    // Calculate recv_counts if necessary
+    constexpr bool do_calculate_recv_counts = has_to_be_computed<decltype(recv_counts)>;
+    KAMPING_ASSERT(
+        is_same_on_all_ranks(do_calculate_recv_counts),
+        "Receive counts are given on some ranks and have to be computed on others",
+        assert::light_communication
+    );
+    if constexpr (do_calculate_recv_counts) {
+        recv_counts.resize_if_requested([&]() { return this->size(); });
+        KAMPING_ASSERT(recv_counts.size() >= this->size(), "Recv counts buffer is not large enough.", assert::light);
+        this->alltoall(kamping::send_buf(send_counts.get()), kamping::recv_buf(recv_counts.get()));
+    } else {
+        KAMPING_ASSERT(recv_counts.size() >= this->size(), "Recv counts buffer is not large enough.", assert::light);
+    }
+
+    // Calculate send_displs if necessary
+    if constexpr (has_to_be_computed<decltype(send_displs)>) {
+        send_displs.resize_if_requested([&]() { return this->size(); });
+        KAMPING_ASSERT(send_displs.size() >= this->size(), "Send displs buffer is not large enough.", assert::light);
+        std::exclusive_scan(send_counts.data(), send_counts.data() + this->size(), send_displs.data(), count_type{0});
+    } else {
+        KAMPING_ASSERT(send_displs.size() >= this->size(), "Send displs buffer is not large enough.", assert::light);
+    }
+
+    // Calculate recv_displs if necessary
+    if constexpr (has_to_be_computed<decltype(recv_displs)>) {
+        recv_displs.resize_if_requested([&]() { return this->size(); });
+        KAMPING_ASSERT(recv_displs.size() >= this->size(), "Recv displs buffer is not large enough.", assert::light);
+        std::exclusive_scan(recv_counts.data(), recv_counts.data() + this->size(), recv_displs.data(), count_type{0});
+    } else {
+        KAMPING_ASSERT(recv_displs.size() >= this->size(), "Recv displs buffer is not large enough.", assert::light);
+    }
+
+    auto compute_required_recv_buf_size = [&]() {
+        return compute_required_recv_buf_size_in_vectorized_communication(recv_counts, recv_displs, this->size());
+    };
+    recv_buf.resize_if_requested(compute_required_recv_buf_size);
+    KAMPING_ASSERT(
+        // if the recv type is user provided, kamping cannot make any assumptions about the required size of the
+        // recv buffer
+        !recv_type_has_to_be_deduced || recv_buf.size() >= compute_required_recv_buf_size(),
+        "Recv buffer is not large enough to hold all received elements.",
+        assert::light
+    );
+
+    [[maybe_unused]] int err = internal::alltoallv_large_count(
         send_buf.data(),                // send_buf
         send_counts.data(),             // send_counts
         send_displs.data(),             // send_displs
         send_type.get_single_element(), // send_type
-        recv_buf.data(),                // send_counts
+        recv_buf.data(),                // recv_buf
         recv_counts.data(),             // recv_counts
         recv_displs.data(),             // recv_displs
         recv_type.get_single_element(), // recv_type
-        mpi_communicator()              // comm
+        mpi_communicator(),             // comm
+        this->size()                    // comm_size
     );
+    this->mpi_error_hook(err, internal::alltoallv_large_count_name);
 
-    this->mpi_error_hook(err, "MPI_Alltoallv");
-
-    return internal::make_mpi_result<std::tuple<Args...>>(
+    return make_mpi_result<std::tuple<Args...>>(
         std::move(recv_buf),    // recv_buf
         std::move(recv_counts), // recv_counts
         std::move(recv_displs), // recv_displs
@@ -0,0 +1,380 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// @brief Alltoallv algorithms implemented on top of point-to-point communication, which can be selected using \ref
+/// kamping::alltoallv_algorithm().
+///
+/// All algorithms take the same arguments as \c MPI_Alltoallv and return an MPI error code. The algorithms based on
+/// point-to-point communication exchange their messages on a duplicate of the communicator (see \ref
+/// alltoallv_algorithm_comm()), such that they never match point-to-point messages of the application.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/allocator.hpp"
+#include "kamping/checking_casts.hpp"
+#include "kamping/parameter_objects.hpp"
+
+namespace kamping::internal {
+
+/// @brief Arguments of an \c MPI_Alltoallv call, used to pass them to the different alltoallv algorithms.
+struct AlltoallvArgs {
+    void const*  send_buf;    ///< The send buffer.
+    int const*   send_counts; ///< The number of elements to send to each rank.
+    int const*   send_displs; ///< The offsets of the blocks in the send buffer.
+    MPI_Datatype send_type;   ///< The send type.
+    void*        recv_buf;    ///< The receive buffer.
+    int const*   recv_counts; ///< The number of elements to receive from each rank.
+    int const*   recv_displs; ///< The offsets of the blocks in the receive buffer.
+    MPI_Datatype recv_type;   ///< The receive type.
+    MPI_Comm     comm;        ///< The communicator.
+
+    /// @brief Returns a pointer to the block sent to \p rank.
+    void const* send_block(int rank) const {
+        return static_cast<char const*>(send_buf) + static_cast<MPI_Aint>(send_displs[rank]) * extent(send_type);
+    }
+
+    /// @brief Returns a pointer to the block received from \p rank.
+    void* recv_block(int rank) const {
+        return static_cast<char*>(recv_buf) + static_cast<MPI_Aint>(recv_displs[rank]) * extent(recv_type);
+    }
+
+    /// @brief Returns the extent of \p type.
+    static MPI_Aint extent(MPI_Datatype type) {
+        MPI_Aint lower_bound;
+        MPI_Aint type_extent;
+        MPI_Type_get_extent(type, &lower_bound, &type_extent);
+        return type_extent;
+    }
+};
+
+/// @brief The tag used for the point-to-point messages of the alltoallv algorithms.
+constexpr int alltoallv_algorithm_tag = 0;
+
+/// @brief Frees the duplicate communicator cached by \ref alltoallv_algorithm_comm() when the communicator it is
+/// attached to is freed.
+inline int free_alltoallv_algorithm_comm(MPI_Comm, int, void* attribute_val, void*) {
+    auto* comm = static_cast<MPI_Comm*>(attribute_val);
+    int   err  = MPI_Comm_free(comm);
+    delete comm;
+    return err;
+}
+
+/// @brief Returns the attribute key under which \ref alltoallv_algorithm_comm() caches the duplicate communicator.
+inline int alltoallv_algorithm_comm_keyval() {
+    static int const keyval = [] {
+        int new_keyval = MPI_KEYVAL_INVALID;
+        MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &free_alltoallv_algorithm_comm, &new_keyval, nullptr);
+        return new_keyval;
+    }();
+    return keyval;
+}
+
+/// @brief Retrieves the communicator used for the point-to-point messages of the alltoallv algorithms on \p comm.
+///
+/// On first use, \p comm is duplicated using \c MPI_Comm_dup (which is collective, as are the algorithms). The
+/// duplicate is cached as attribute of \p comm, so it is shared by all \ref Communicator objects wrapping \p comm, and
+/// freed together with \p comm.
+///
+/// @param comm The communicator passed to the algorithm.
+/// @param algorithm_comm Set to the duplicate of \p comm.
+/// @return The MPI error code.
+inline int alltoallv_algorithm_comm(MPI_Comm comm, MPI_Comm& algorithm_comm) {
+    int const keyval = alltoallv_algorithm_comm_keyval();
+    void*     cached = nullptr;
+    int       found  = false;
+    int       err    = MPI_Comm_get_attr(comm, keyval, &cached, &found);
+    if (err != MPI_SUCCESS) {
+        return err;
+    }
+    if (!found) {
+        auto* duplicate = new MPI_Comm(MPI_COMM_NULL);
+        err             = MPI_Comm_dup(comm, duplicate);
+        if (err != MPI_SUCCESS) {
+            delete duplicate;
+            return err;
+        }
+        err = MPI_Comm_set_attr(comm, keyval, duplicate);
+        if (err != MPI_SUCCESS) {
+            MPI_Comm_free(duplicate);
+            delete duplicate;
+            return err;
+        }
+        cached = duplicate;
+    }
+    algorithm_comm = *static_cast<MPI_Comm*>(cached);
+    return MPI_SUCCESS;
+}
+
+/// @brief Calls \c MPI_Alltoallv.
+inline int alltoallv_with_algorithm(builtin_alltoallv_t, AlltoallvArgs const& args) {
+    return MPI_Alltoallv(
+        args.send_buf,    // send_buf
+        args.send_counts, // send_counts
+        args.send_displs, // send_displs
+        args.send_type,   // send_type
+        args.recv_buf,    // recv_buf
+        args.recv_counts, // recv_counts
+        args.recv_displs, // recv_displs
+        args.recv_type,   // recv_type
+        args.comm         // comm
+    );
+}
+
+/// @brief Pairwise exchange: In step `k` (for `k` in `[0, p)`), each rank sends one block and receives one block using
+/// \c MPI_Sendrecv. If `p` is a power of two, rank `i` exchanges its blocks with rank `i XOR k`, otherwise it sends to
+/// rank `i + k` and receives from rank `i - k`.
+inline int alltoallv_with_algorithm(pairwise_alltoallv_t, AlltoallvArgs const& args) {
+    MPI_Comm comm;
+    if (int const err = alltoallv_algorithm_comm(args.comm, comm); err != MPI_SUCCESS) {
+        return err;
+    }
+    int rank;
+    int size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    bool const is_power_of_two = (size & (size - 1)) == 0;
+    for (int step = 0; step < size; ++step) {
+        int const dest   = is_power_of_two ? rank ^ step : (rank + step) % size;
+        int const source = is_power_of_two ? rank ^ step : (rank - step + size) % size;
+        int const err    = MPI_Sendrecv(
+            args.send_block(dest),
+            args.send_counts[dest],
+            args.send_type,
+            dest,
+            alltoallv_algorithm_tag,
+            args.recv_block(source),
+            args.recv_counts[source],
+            args.recv_type,
+            source,
+            alltoallv_algorithm_tag,
+            comm,
+            MPI_STATUS_IGNORE
+        );
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+    }
+    return MPI_SUCCESS;
+}
+
+/// @brief Throttled linear exchange: The receives from ranks `i - 1, i - 2, ...` and the sends to ranks `i + 1, i + 2,
+/// ...` are posted in batches of at most `window` requests each. Each batch is completed before the next one is posted.
+inline int alltoallv_with_algorithm(throttled_linear_alltoallv_t algorithm, AlltoallvArgs const& args) {
+    MPI_Comm comm;
+    if (int const err = alltoallv_algorithm_comm(args.comm, comm); err != MPI_SUCCESS) {
+        return err;
+    }
+    int rank;
+    int size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    int const                window = asserting_cast<int>(std::max<size_t>(algorithm.window, 1));
+    std::vector<MPI_Request> requests;
+    requests.reserve(2 * static_cast<size_t>(std::min(window, size)));
+    for (int batch_begin = 0; batch_begin < size; batch_begin += window) {
+        int const batch_end = std::min(batch_begin + window, size);
+        requests.clear();
+        for (int step = batch_begin; step < batch_end; ++step) {
+            int const source = (rank - step + size) % size;
+            int const err    = MPI_Irecv(
+                args.recv_block(source),
+                args.recv_counts[source],
+                args.recv_type,
+                source,
+                alltoallv_algorithm_tag,
+                comm,
+                &requests.emplace_back(MPI_REQUEST_NULL)
+            );
+            if (err != MPI_SUCCESS) {
+                return err;
+            }
+        }
+        for (int step = batch_begin; step < batch_end; ++step) {
+            int const dest = (rank + step) % size;
+            int const err  = MPI_Isend(
+                args.send_block(dest),
+                args.send_counts[dest],
+                args.send_type,
+                dest,
+                alltoallv_algorithm_tag,
+                comm,
+                &requests.emplace_back(MPI_REQUEST_NULL)
+            );
+            if (err != MPI_SUCCESS) {
+                return err;
+            }
+        }
+        int const err = MPI_Waitall(asserting_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+    }
+    return MPI_SUCCESS;
+}
+
+/// @brief Bruck's algorithm: After locally rotating the blocks such that block `j` is destined for rank `i + j`, in
+/// round `k` each rank forwards all blocks whose index has bit `k` set to rank `i + 2^k` and receives the blocks with
+/// the same indices from rank `i - 2^k`. After `ceil(log2(p))` rounds, block `j` on rank `i` originates from rank `i -
+/// j`.
+///
+/// As the sizes of forwarded blocks are not known to the receiver, the blocks are packed (using \c MPI_Pack) into a
+/// message which starts with the size of each contained block.
+inline int alltoallv_with_algorithm(bruck_alltoallv_t, AlltoallvArgs const& args) {
+    MPI_Comm comm;
+    if (int const err = alltoallv_algorithm_comm(args.comm, comm); err != MPI_SUCCESS) {
+        return err;
+    }
+    int rank;
+    int size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    auto const num_blocks = static_cast<size_t>(size);
+
+    // All byte buffers are overwritten by MPI_Pack or MPI_Recv after being resized, so they do not need to be zeroed.
+    std::vector<default_init_vector<char>> blocks(num_blocks);
+    for (int j = 0; j < size; ++j) {
+        int const dest = (rank + j) % size;
+        if (args.send_counts[dest] == 0) {
+            continue;
+        }
+        int pack_size;
+        int       err = MPI_Pack_size(args.send_counts[dest], args.send_type, comm, &pack_size);
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+        auto& block = blocks[static_cast<size_t>(j)];
+        block.resize(static_cast<size_t>(pack_size));
+        int position = 0;
+        err          = MPI_Pack(
+            args.send_block(dest),
+            args.send_counts[dest],
+            args.send_type,
+            block.data(),
+            pack_size,
+            &position,
+            comm
+        );
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+        block.resize(static_cast<size_t>(position));
+    }
+
+    default_init_vector<char> send_message;
+    default_init_vector<char> recv_message;
+    std::vector<int>          block_sizes;
+    for (int distance = 1; distance < size; distance *= 2) {
+        block_sizes.clear();
+        for (size_t j = 0; j < num_blocks; ++j) {
+            if (j & static_cast<size_t>(distance)) {
+                block_sizes.push_back(asserting_cast<int>(blocks[j].size()));
+            }
+        }
+        size_t const header_size = block_sizes.size() * sizeof(int);
+        send_message.resize(header_size);
+        std::memcpy(send_message.data(), block_sizes.data(), header_size);
+        for (size_t j = 0; j < num_blocks; ++j) {
+            if (j & static_cast<size_t>(distance)) {
+                send_message.insert(send_message.end(), blocks[j].begin(), blocks[j].end());
+            }
+        }
+
+        int const   dest   = (rank + distance) % size;
+        int const   source = (rank - distance + size) % size;
+        MPI_Request send_request;
+        int         err = MPI_Isend(
+            send_message.data(),
+            asserting_cast<int>(send_message.size()),
+            MPI_BYTE,
+            dest,
+            alltoallv_algorithm_tag,
+            comm,
+            &send_request
+        );
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+        MPI_Status status;
+        err = MPI_Probe(source, alltoallv_algorithm_tag, comm, &status);
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+        int message_size;
+        err = MPI_Get_count(&status, MPI_BYTE, &message_size);
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+        recv_message.resize(asserting_cast<size_t>(message_size));
+        err = MPI_Recv(
+            recv_message.data(),
+            message_size,
+            MPI_BYTE,
+            source,
+            alltoallv_algorithm_tag,
+            comm,
+            MPI_STATUS_IGNORE
+        );
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+        err = MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+
+        // The received message contains the blocks with the same indices as the sent one.
+        std::memcpy(block_sizes.data(), recv_message.data(), header_size);
+        size_t offset      = header_size;
+        size_t block_index = 0;
+        for (size_t j = 0; j < num_blocks; ++j) {
+            if (j & static_cast<size_t>(distance)) {
+                auto const block_size = static_cast<size_t>(block_sizes[block_index++]);
+                auto const begin      = recv_message.begin() + static_cast<std::ptrdiff_t>(offset);
+                blocks[j].assign(begin, begin + static_cast<std::ptrdiff_t>(block_size));
+                offset += block_size;
+            }
+        }
+    }
+
+    for (int j = 0; j < size; ++j) {
+        int const source = (rank - j + size) % size;
+        auto&     block  = blocks[static_cast<size_t>(j)];
+        if (args.recv_counts[source] == 0) {
+            continue;
+        }
+        int       position = 0;
+        int const err      = MPI_Unpack(
+            block.data(),
+            asserting_cast<int>(block.size()),
+            &position,
+            args.recv_block(source),
+            args.recv_counts[source],
+            args.recv_type,
+            comm
+        );
+        if (err != MPI_SUCCESS) {
+            return err;
+        }
+    }
+    return MPI_SUCCESS;
+}
+
+} // namespace kamping::internal
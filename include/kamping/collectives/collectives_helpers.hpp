@@ -33,20 +33,22 @@ template <typename RecvCounts, typename RecvDispls>
 size_t compute_required_recv_buf_size_in_vectorized_communication(
     RecvCounts const& recv_counts, RecvDispls const& recv_displs, size_t comm_size
 ) {
+    using count_type = std::remove_const_t<std::remove_reference_t<decltype(*recv_counts.data())>>;
+
     constexpr bool do_calculate_recv_displs = internal::has_to_be_computed<RecvDispls>;
     if constexpr (do_calculate_recv_displs) {
         // If recv displs are not provided as a parameter, they are monotonically increasing. In this case, it is
         // safe to deduce the required recv_buf size by only considering  the last entry of recv_counts and
         // recv_displs.
-        int recv_buf_size = *(recv_counts.data() + comm_size - 1) + // Last element of recv_counts
-                            *(recv_displs.data() + comm_size - 1);  // Last element of recv_displs
+        count_type recv_buf_size = *(recv_counts.data() + comm_size - 1) + // Last element of recv_counts
+                                   *(recv_displs.data() + comm_size - 1);  // Last element of recv_displs
         return asserting_cast<size_t>(recv_buf_size);
     } else {
         // If recv displs are user provided, they do not need to be monotonically increasing. Therefore, we have to
         // compute the maximum of recv_displs and recv_counts from each rank to provide a receive buffer large
         // enough to be able to receive all elements. This O(p) computation is only executed if the user wants
         // kamping to resize the receive buffer.
-        int recv_buf_size = 0;
+        count_type recv_buf_size = 0;
         for (size_t i = 0; i < comm_size; ++i) {
             recv_buf_size = std::max(recv_buf_size, *(recv_counts.data() + i) + *(recv_displs.data() + i));
         }
@@ -202,4 +204,30 @@ constexpr auto determine_mpi_send_recv_datatype(Args&... args)
     return mpi_send_recv_type;
 }
 
+/// @brief Helper for \ref deserializable_blocks_type. Used if no receive buffer has been passed.
+template <bool has_recv_buf, typename DefaultObject, typename DefaultInArchive, typename... Args>
+struct deserializable_blocks_type_impl {
+    using type = DeserializableBlocks<DefaultObject, DefaultInArchive>; ///< The resulting type.
+};
+
+/// @brief Helper for \ref deserializable_blocks_type. Used if a receive buffer has been passed.
+template <typename DefaultObject, typename DefaultInArchive, typename... Args>
+struct deserializable_blocks_type_impl<true, DefaultObject, DefaultInArchive, Args...> {
+    using recv_buf_type = serialization_buffer_type_t<ParameterType::recv_buf, Args...>; ///< The receive buffer.
+    using type          = DeserializableBlocks<
+        typename recv_buf_type::object_type,
+        typename recv_buf_type::in_archive_type,
+        typename recv_buf_type::allocator_type>; ///< The resulting type.
+};
+
+/// @brief The \ref kamping::DeserializableBlocks type returned by a vectorized collective operating on serialized data.
+/// If a receive buffer created by \ref kamping::as_deserializable() is contained in \p Args, the object type, archive
+/// and allocator are taken from it. Otherwise, objects of type \p DefaultObject are deserialized using \p
+/// DefaultInArchive.
+template <typename DefaultObject, typename DefaultInArchive, typename... Args>
+using deserializable_blocks_type = typename deserializable_blocks_type_impl<
+    has_parameter_type<ParameterType::recv_buf, Args...>(),
+    DefaultObject,
+    DefaultInArchive,
+    Args...>::type;
 } // namespace kamping::internal
@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <numeric>
+#include <vector>
 
 #include <mpi.h>
 
@@ -31,6 +32,8 @@
 #include "kamping/named_parameter_types.hpp"
 #include "kamping/named_parameters.hpp"
 #include "kamping/result.hpp"
+#include "kamping/serialization.hpp"
+#include "kamping/span.hpp"
 
 /// @addtogroup kamping_collectives
 /// @{
@@ -206,6 +209,10 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::gather(Args... arg
 /// - \ref kamping::root() specifying an alternative root. If not present, the default root of the \c Communicator
 /// is used, see root().
 ///
+/// Gathering arbitrary (serializable) objects is supported by passing the object wrapped in \ref
+/// kamping::as_serialized() or \ref kamping::as_packed() as send buffer. This changes the requirements for the other
+/// parameters, see \ref Communicator::gatherv_serialized.
+///
 /// @tparam Args Automatically deduced template parameters.
 /// @param args All required and any number of the optional parameters described above.
 /// @return Result object wrapping the output parameters to be returned by value.
@@ -220,6 +227,26 @@ template <
     typename... Plugins>
 template <typename... Args>
 auto kamping::Communicator<DefaultContainerType, Plugins...>::gatherv(Args... args) const {
+    constexpr bool is_serialization_used =
+        internal::parameter_uses_serialization<internal::ParameterType::send_buf, Args...>();
+    if constexpr (is_serialization_used) {
+        return this->gatherv_serialized(std::forward<Args>(args)...);
+    } else {
+        return this->gatherv_plain(std::forward<Args>(args)...);
+    }
+}
+
+/// @brief Wrapper for \c MPI_Gatherv operating on plain (not serialized) data.
+///
+/// This variant is selected by \ref Communicator::gatherv() if the send buffer is not passed via \ref
+/// kamping::as_serialized() or \ref kamping::as_packed(). See there for the supported parameters.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::gatherv_plain(Args... args) const {
     using namespace kamping::internal;
     KAMPING_CHECK_PARAMETERS(
         Args,
@@ -396,4 +423,73 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::gatherv(Args... ar
         std::move(recv_type)
     );
 }
+
+/// @brief Wrapper for \c MPI_Gatherv operating on serialized objects.
+///
+/// This variant is selected by \ref Communicator::gatherv() if the send buffer is passed via \ref
+/// kamping::as_serialized(). Each rank serializes its object, the serialized sizes are gathered at the root and the
+/// serialized data is collected with a single \c MPI_Gatherv on bytes. The received data is not deserialized eagerly,
+/// instead a \ref kamping::DeserializableBlocks object is returned, which deserializes the object received from each
+/// rank on request. On all ranks except the root, the returned object is empty.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the object to send wrapped in \ref kamping::as_serialized() or \ref
+/// kamping::as_packed().
+///
+/// The following parameters are optional:
+/// - \ref kamping::recv_buf() containing \ref kamping::as_deserializable<T>() or \ref kamping::as_unpackable<T>(),
+/// specifying the type `T` each received object is deserialized into as well as the archive used for deserialization.
+/// If omitted, the type of the sent object is used together with the archive matching the send buffer, i.e., \ref
+/// kamping::PackingInputArchive for \ref kamping::as_packed() and `cereal::BinaryInputArchive` otherwise.
+///
+/// - \ref kamping::root() specifying an alternative root. If not present, the default root of the \c Communicator
+/// is used, see root().
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return Result object wrapping the output parameters to be returned by value. The received objects are returned as
+/// \ref kamping::DeserializableBlocks holding the serialized objects received from each rank.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::gatherv_serialized(Args... args) const {
+    using namespace kamping::internal;
+    KAMPING_CHECK_PARAMETERS(Args, KAMPING_REQUIRED_PARAMETERS(send_buf), KAMPING_OPTIONAL_PARAMETERS(recv_buf, root));
+    static_assert(
+        !has_parameter_type<ParameterType::recv_buf, Args...>() ||
+            parameter_uses_serialization<ParameterType::recv_buf, Args...>(),
+        "When sending serialized data, the receive buffer has to be passed using as_deserializable() or "
+        "as_unpackable()."
+    );
+
+    auto send_buf = select_parameter_type<ParameterType::send_buf>(args...)
+                        .template construct_buffer_or_rebind<DefaultContainerType, serialization_support_tag>();
+    auto& serialization_buffer = send_buf.underlying();
+    using send_object_type     = typename std::remove_reference_t<decltype(serialization_buffer)>::object_type;
+    using result_type          = deserializable_blocks_type<
+        send_object_type,
+        in_archive_or_default_t<typename std::remove_reference_t<decltype(serialization_buffer)>::in_archive_type>,
+        Args...>;
+
+    auto&& root =
+        select_parameter_type_or_default<ParameterType::root, RootDataBuffer>(std::tuple(this->root()), args...);
+
+    serialization_buffer.serialize();
+    auto result = this->gatherv(
+        kamping::send_buf(Span<char const>(serialization_buffer.data(), serialization_buffer.size())),
+        kamping::recv_buf(alloc_new<std::vector<char, typename result_type::allocator_type>>),
+        kamping::recv_counts_out(alloc_new<std::vector<int>>),
+        kamping::recv_displs_out(alloc_new<std::vector<int>>),
+        kamping::root(root.rank_signed())
+    );
+    if (!this->is_root(root.rank_signed())) {
+        return make_mpi_result<std::tuple<Args...>>(kamping::recv_buf(result_type()).construct_buffer_or_rebind());
+    }
+    result_type blocks(result.extract_recv_buf(), result.extract_recv_counts(), result.extract_recv_displs());
+    auto        recv_buf = kamping::recv_buf(std::move(blocks)).construct_buffer_or_rebind();
+    return make_mpi_result<std::tuple<Args...>>(std::move(recv_buf));
+}
 /// @}
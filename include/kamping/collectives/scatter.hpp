@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include <mpi.h>
 
@@ -33,6 +34,8 @@
 #include "kamping/named_parameter_types.hpp"
 #include "kamping/named_parameters.hpp"
 #include "kamping/result.hpp"
+#include "kamping/serialization.hpp"
+#include "kamping/span.hpp"
 
 /// @addtogroup kamping_collectives
 /// @{
@@ -320,6 +323,10 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::scatter_single(Arg
 /// - \ref kamping::root() [on all PEs] specifying the rank of the root PE. If omitted, the default root PE of the
 /// communicator is used instead.
 ///
+/// Scattering arbitrary (serializable) objects is supported by passing \ref kamping::as_deserializable() or \ref
+/// kamping::as_unpackable() as receive buffer. This changes the requirements for the other parameters, see \ref
+/// Communicator::scatterv_serialized.
+///
 /// @tparam recv_value_type_tparam The type that is received. Only required when no kamping::send_buf() and no
 /// kamping::recv_buf() is given.
 /// @tparam Args Automatically deduced template parameters.
@@ -336,6 +343,26 @@ template <
     typename... Plugins>
 template <typename recv_value_type_tparam /* = kamping::internal::unused_tparam */, typename... Args>
 auto kamping::Communicator<DefaultContainerType, Plugins...>::scatterv(Args... args) const {
+    constexpr bool is_serialization_used =
+        internal::parameter_uses_serialization<internal::ParameterType::recv_buf, Args...>();
+    if constexpr (is_serialization_used) {
+        return this->scatterv_serialized(std::forward<Args>(args)...);
+    } else {
+        return this->template scatterv_plain<recv_value_type_tparam>(std::forward<Args>(args)...);
+    }
+}
+
+/// @brief Wrapper for \c MPI_Scatterv operating on plain (not serialized) data.
+///
+/// This variant is selected by \ref Communicator::scatterv() if the receive buffer is not passed via \ref
+/// kamping::as_deserializable() or \ref kamping::as_unpackable(). See there for the supported parameters.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename recv_value_type_tparam /* = kamping::internal::unused_tparam */, typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::scatterv_plain(Args... args) const {
     using namespace kamping::internal;
 
     KAMPING_CHECK_PARAMETERS(
@@ -502,4 +529,93 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::scatterv(Args... a
         std::move(recv_type)
     );
 }
+
+/// @brief Wrapper for \c MPI_Scatterv operating on serialized objects.
+///
+/// This variant is selected by \ref Communicator::scatterv() if the receive buffer is passed via \ref
+/// kamping::as_deserializable(). The root serializes the `i`-th object of its send range for rank `i` back to back
+/// into a single contiguous buffer, the serialized sizes are scattered and the data is distributed with a single \c
+/// MPI_Scatterv on bytes. Each rank then deserializes the received object directly from the receive buffer.
+///
+/// The following parameters are required:
+/// - \ref kamping::recv_buf() [on all PEs] containing \ref kamping::as_deserializable() or \ref
+/// kamping::as_unpackable(), specifying the object to deserialize into.
+///
+/// - \ref kamping::send_buf() [on root PE] containing a range of `comm.size()` objects wrapped in \ref
+/// kamping::as_serialized() or \ref kamping::as_packed(). It is ignored on all other PEs.
+///
+/// The following parameters are optional:
+/// - \ref kamping::root() [on all PEs] specifying the rank of the root PE. If omitted, the default root PE of the
+/// communicator is used instead.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return The deserialized object if \ref kamping::as_deserializable() has been passed an rvalue or no object at all,
+/// otherwise the object passed to \ref kamping::as_deserializable() is deserialized into in place.
+template <
+    template <typename...>
+    typename DefaultContainerType,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+template <typename... Args>
+auto kamping::Communicator<DefaultContainerType, Plugins...>::scatterv_serialized(Args... args) const {
+    using namespace kamping::internal;
+    KAMPING_CHECK_PARAMETERS(Args, KAMPING_REQUIRED_PARAMETERS(recv_buf), KAMPING_OPTIONAL_PARAMETERS(send_buf, root));
+    constexpr bool has_send_buf = has_parameter_type<ParameterType::send_buf, Args...>();
+    static_assert(
+        !has_send_buf || parameter_uses_serialization<ParameterType::send_buf, Args...>(),
+        "When receiving serialized data, the send buffer has to be passed using as_serialized() or as_packed()."
+    );
+
+    using root_param_type = decltype(kamping::root(0));
+    auto&& root_param =
+        select_parameter_type_or_default<ParameterType::root, root_param_type>(std::tuple(root()), args...);
+    int const root_val = root_param.rank_signed();
+    KAMPING_ASSERT(
+        is_valid_rank(root_val),
+        "Invalid root rank " << root_val << " in communicator of size " << size(),
+        assert::light
+    );
+    KAMPING_ASSERT(
+        !is_root(root_val) || has_send_buf,
+        "Send buffer must be specified on root.",
+        assert::light
+    );
+
+    auto recv_buf = select_parameter_type<ParameterType::recv_buf>(args...)
+                        .template construct_buffer_or_rebind<DefaultContainerType, serialization_support_tag>();
+    using allocator_type = typename std::remove_reference_t<decltype(recv_buf.underlying())>::allocator_type;
+
+    std::vector<int> send_counts;
+    auto             exchange = [&](Span<char const> send_data) {
+        return this->scatterv(
+            kamping::send_buf(send_data),
+            kamping::send_counts(send_counts),
+            kamping::recv_buf(alloc_new<std::vector<char, allocator_type>>),
+            kamping::root(root_val)
+        );
+    };
+    auto serialized_data = [&] {
+        if constexpr (has_send_buf) {
+            auto send_buf = select_parameter_type<ParameterType::send_buf>(args...)
+                                .template construct_buffer_or_rebind<DefaultContainerType, serialization_support_tag>();
+            auto& serialization_buffer = send_buf.underlying();
+            if (is_root(root_val)) {
+                serialization_buffer.serialize_each(send_counts);
+                KAMPING_ASSERT(
+                    send_counts.size() == size(),
+                    "The serialized send buffer has to contain exactly one object per rank.",
+                    assert::light
+                );
+            }
+            return exchange(Span<char const>(serialization_buffer.data(), serialization_buffer.size()));
+        } else {
+            return exchange(Span<char const>());
+        }
+    }();
+
+    recv_buf.underlying().deserialize_from(serialized_data.data(), serialized_data.size());
+    auto serialization_data = recv_buf.extract();
+    return make_mpi_result<std::tuple<Args...>>(std::move(serialization_data).extract());
+}
 /// @}
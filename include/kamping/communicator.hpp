@@ -523,6 +523,18 @@ public:
     template <typename... Args>
     auto alltoallv(Args... args) const;
 
+    template <typename... Args>
+    auto alltoallv_plain(Args... args) const;
+
+    template <typename... Args>
+    auto alltoallv_serialized(Args... args) const;
+
+    template <typename... Args>
+    auto alltoallv_compressed(Args... args) const;
+
+    template <typename... Args>
+    auto alltoallv_large_count(Args... args) const;
+
     template <typename recv_value_type_tparam = kamping::internal::unused_tparam, typename... Args>
     auto scatter(Args... args) const;
 
@@ -532,6 +544,12 @@ public:
     template <typename recv_value_type_tparam = kamping::internal::unused_tparam, typename... Args>
     auto scatterv(Args... args) const;
 
+    template <typename recv_value_type_tparam = kamping::internal::unused_tparam, typename... Args>
+    auto scatterv_plain(Args... args) const;
+
+    template <typename... Args>
+    auto scatterv_serialized(Args... args) const;
+
     template <typename... Args>
     auto reduce(Args... args) const;
 
@@ -574,6 +592,12 @@ public:
     template <typename... Args>
     auto gatherv(Args... args) const;
 
+    template <typename... Args>
+    auto gatherv_plain(Args... args) const;
+
+    template <typename... Args>
+    auto gatherv_serialized(Args... args) const;
+
     template <typename... Args>
     auto allgather(Args... args) const;
 
@@ -583,6 +607,12 @@ public:
     template <typename... Args>
     auto allgatherv(Args... args) const;
 
+    template <typename... Args>
+    auto allgatherv_plain(Args... args) const;
+
+    template <typename... Args>
+    auto allgatherv_serialized(Args... args) const;
+
     template <typename recv_value_type_tparam = kamping::internal::unused_tparam, typename... Args>
     auto bcast(Args... args) const;
 
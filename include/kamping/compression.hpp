@@ -0,0 +1,191 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// @brief Lightweight compression of integer send buffers using delta and variable-byte encoding.
+///
+/// Each block (e.g., the elements sent to one rank in an \c alltoallv) is encoded on its own: first the number of
+/// elements, then the differences between consecutive elements. Differences are zigzag encoded, such that small
+/// negative differences also result in small codes, and stored using a variable number of bytes (7 bits of payload per
+/// byte). This works best for sorted or nearly sorted sequences of integers, such as IDs, where most differences are
+/// small.
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "kamping/named_parameter_check.hpp"
+#include "kamping/named_parameter_selection.hpp"
+#include "kamping/named_parameter_types.hpp"
+
+namespace kamping {
+namespace internal {
+
+/// @brief Wraps a container of integers which is compressed before it is sent. Created by \ref kamping::compressed().
+/// @tparam Container Type of the wrapped container. May be a (const) lvalue reference, in which case the container is
+/// referenced instead of owned.
+template <typename Container>
+class CompressedBuffer {
+public:
+    /// @brief Type of the wrapped container.
+    using container_type = std::remove_const_t<std::remove_reference_t<Container>>;
+    using value_type     = typename container_type::value_type; ///< Type of the elements to compress.
+    static_assert(
+        std::is_integral_v<value_type> && !std::is_same_v<value_type, bool>,
+        "Only containers of integers can be compressed."
+    );
+
+    /// @brief Wraps \p container.
+    template <typename Container_>
+    explicit CompressedBuffer(Container_&& container) : _container(std::forward<Container_>(container)) {}
+
+    /// @brief Returns the wrapped container.
+    container_type const& underlying() const {
+        return _container;
+    }
+
+private:
+    Container _container; ///< The wrapped container (or a reference to it).
+};
+
+/// @brief Type trait to check if a type is a \ref CompressedBuffer.
+template <typename>
+constexpr bool is_compressed_buffer_v_impl = false;
+
+/// @brief Type trait to check if a type is a \ref CompressedBuffer.
+template <typename Container>
+constexpr bool is_compressed_buffer_v_impl<CompressedBuffer<Container>> = true;
+
+/// @brief Type trait to check if a type is a \ref CompressedBuffer.
+template <typename T>
+constexpr bool is_compressed_buffer_v = is_compressed_buffer_v_impl<std::remove_const_t<std::remove_reference_t<T>>>;
+
+/// @brief Checks if the parameter with parameter type \p ptype is contained in \p Args and has been passed as a
+/// compressed buffer (see \ref kamping::compressed()).
+template <ParameterType ptype, typename... Args>
+constexpr bool parameter_uses_compression() {
+    if constexpr (has_parameter_type<ptype, Args...>()) {
+        using buffer_builder_type = buffer_type_with_requested_parameter_type<ptype, Args...>;
+        return is_compressed_buffer_v<typename buffer_builder_type::DataBufferType::MemberTypeWithConstAndRef>;
+    } else {
+        return false;
+    }
+}
+
+/// @brief Appends the variable-byte encoding of \p value to \p out.
+/// @tparam Container Byte container providing \c push_back().
+template <typename Unsigned, typename Container>
+void write_varint(Unsigned value, Container& out) {
+    static_assert(std::is_unsigned_v<Unsigned>);
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value = static_cast<Unsigned>(value >> 7);
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+/// @brief Reads a variable-byte encoded value starting at \p in into \p value.
+/// @return Pointer past the last read byte.
+template <typename Unsigned>
+char const* read_varint(char const* in, Unsigned& value) {
+    static_assert(std::is_unsigned_v<Unsigned>);
+    value        = 0;
+    size_t shift = 0;
+    unsigned char byte;
+    do {
+        byte = static_cast<unsigned char>(*in++);
+        value |= static_cast<Unsigned>(static_cast<Unsigned>(byte & 0x7F) << shift);
+        shift += 7;
+    } while (byte & 0x80);
+    return in;
+}
+
+/// @brief Zigzag encodes the difference \p diff (computed in two's complement), such that differences with small
+/// absolute values result in small unsigned values.
+template <typename Unsigned>
+constexpr Unsigned zigzag_encode(Unsigned diff) {
+    constexpr int msb      = std::numeric_limits<Unsigned>::digits - 1;
+    auto const    all_ones = static_cast<Unsigned>(-static_cast<Unsigned>(diff >> msb));
+    return static_cast<Unsigned>(static_cast<Unsigned>(diff << 1) ^ all_ones);
+}
+
+/// @brief Inverse of \ref zigzag_encode().
+template <typename Unsigned>
+constexpr Unsigned zigzag_decode(Unsigned code) {
+    return static_cast<Unsigned>((code >> 1) ^ static_cast<Unsigned>(-static_cast<Unsigned>(code & 1)));
+}
+
+/// @brief Appends the encoding of the \p count integers starting at \p data to \p out: the number of elements followed
+/// by the zigzag and variable-byte encoded differences of consecutive elements.
+/// @tparam T Integral type of the elements.
+/// @tparam Container Byte container providing \c push_back().
+template <typename T, typename Container>
+void encode_delta_varint(T const* data, size_t count, Container& out) {
+    using Unsigned = std::make_unsigned_t<T>;
+    write_varint(static_cast<std::uint64_t>(count), out);
+    Unsigned previous = 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto const current = static_cast<Unsigned>(data[i]);
+        write_varint(zigzag_encode(static_cast<Unsigned>(current - previous)), out);
+        previous = current;
+    }
+}
+
+/// @brief Reads the number of elements of a block encoded by \ref encode_delta_varint() starting at \p in.
+inline size_t decoded_size(char const* in) {
+    std::uint64_t count;
+    read_varint(in, count);
+    return static_cast<size_t>(count);
+}
+
+/// @brief Decodes a block encoded by \ref encode_delta_varint() starting at \p in into the memory starting at \p out,
+/// which has to provide space for at least \ref decoded_size() elements.
+/// @return Pointer past the last read byte.
+template <typename T>
+char const* decode_delta_varint(char const* in, T* out) {
+    using Unsigned = std::make_unsigned_t<T>;
+    std::uint64_t count;
+    in                = read_varint(in, count);
+    Unsigned previous = 0;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        Unsigned code;
+        in       = read_varint(in, code);
+        previous = static_cast<Unsigned>(previous + zigzag_decode(code));
+        out[i]   = static_cast<T>(previous);
+    }
+    return in;
+}
+
+} // namespace internal
+
+/// @brief Indicates that the wrapped container of integers is compressed before being sent and decompressed on the
+/// receiving side. Each block sent to a rank is delta encoded and the differences are stored using variable-byte
+/// encoding (see \ref compression.hpp). This reduces the communication volume for sorted or nearly sorted integer
+/// sequences, at the cost of encoding and decoding the data.
+///
+/// Currently supported by \ref Communicator::alltoallv():
+/// ```cpp
+/// std::vector<std::uint64_t> sorted_ids = ...;
+/// auto recv_ids = comm.alltoallv(send_buf(compressed(sorted_ids)), send_counts(counts));
+/// ```
+/// @param container The container of integers to send. If an rvalue is passed, it is moved into the wrapper.
+template <typename Container>
+auto compressed(Container&& container) {
+    return internal::CompressedBuffer<Container>(std::forward<Container>(container));
+}
+
+} // namespace kamping
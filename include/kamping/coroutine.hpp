@@ -0,0 +1,440 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Coroutines awaiting nonblocking operations and a single-threaded scheduler resuming them upon completion.
+/// Requires C++20.
+
+#pragma once
+
+#if !defined(__cpp_impl_coroutine)
+    #error "kamping/coroutine.hpp requires C++20 coroutine support."
+#endif
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/error_handling.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/request.hpp"
+#include "kamping/result.hpp"
+
+namespace kamping {
+
+class CoroutineScheduler;
+
+template <typename T = void>
+class Task;
+
+namespace internal {
+
+/// @brief Type trait checking whether \p T is a \ref Task.
+template <typename T>
+struct is_task : std::false_type {};
+
+/// @brief Type trait checking whether \p T is a \ref Task.
+template <typename T>
+struct is_task<Task<T>> : std::true_type {};
+
+/// @brief Type trait checking whether \p T is a \ref NonBlockingResult.
+template <typename T>
+struct is_nonblocking_result : std::false_type {};
+
+/// @brief Type trait checking whether \p T is a \ref NonBlockingResult.
+template <typename CallerProvidedArgs, typename RequestDataBuffer, typename... Buffers>
+struct is_nonblocking_result<NonBlockingResult<CallerProvidedArgs, RequestDataBuffer, Buffers...>> : std::true_type {};
+
+/// @brief Suspends a coroutine until \p request is complete.
+inline void suspend_on_request(CoroutineScheduler& scheduler, MPI_Request* request, std::coroutine_handle<> handle);
+
+/// @brief Awaiter suspending a coroutine until a \ref NonBlockingResult is complete, which then returns the result of
+/// \ref NonBlockingResult::wait().
+template <typename NonBlockingResultType>
+struct NonBlockingResultAwaiter {
+    NonBlockingResultType result;    ///< The awaited operation.
+    CoroutineScheduler*   scheduler; ///< The scheduler of the awaiting coroutine.
+
+    /// @brief Returns whether the operation is already complete.
+    bool await_ready() {
+        return *result.get_request_ptr() == MPI_REQUEST_NULL;
+    }
+
+    /// @brief Suspends the awaiting coroutine until the operation is complete.
+    void await_suspend(std::coroutine_handle<> handle) {
+        suspend_on_request(*scheduler, result.get_request_ptr(), handle);
+    }
+
+    /// @brief Returns the result of the completed operation.
+    auto await_resume() {
+        return result.wait();
+    }
+};
+
+/// @brief Awaiter suspending a coroutine until a \ref Request is complete.
+struct RequestAwaiter {
+    Request*            request;   ///< The awaited request.
+    CoroutineScheduler* scheduler; ///< The scheduler of the awaiting coroutine.
+
+    /// @brief Returns whether the request is already complete.
+    bool await_ready() const {
+        return request->is_null();
+    }
+
+    /// @brief Suspends the awaiting coroutine until the request is complete.
+    void await_suspend(std::coroutine_handle<> handle) {
+        suspend_on_request(*scheduler, request->request_ptr(), handle);
+    }
+
+    /// @brief Does nothing, as the request has already been completed.
+    void await_resume() const {}
+};
+
+/// @brief Awaiter resuming the awaiting coroutine of a finished \ref Task.
+struct FinalAwaiter {
+    /// @brief Always suspends, such that the result can be retrieved from the finished coroutine.
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    /// @brief Transfers control to the awaiting coroutine (if any).
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept {
+        if (handle.promise().continuation) {
+            return handle.promise().continuation;
+        }
+        return std::noop_coroutine();
+    }
+
+    /// @brief Does nothing.
+    void await_resume() const noexcept {}
+};
+
+/// @brief The part of the promise of a \ref Task independent of its result type.
+struct TaskPromiseBase {
+    CoroutineScheduler*     scheduler = nullptr; ///< The scheduler resuming this coroutine.
+    std::coroutine_handle<> continuation;        ///< The coroutine awaiting this one (if any).
+    std::exception_ptr      exception;           ///< The exception thrown by this coroutine (if any).
+
+    /// @brief Tasks are started lazily, i.e., when they are awaited or spawned.
+    std::suspend_always initial_suspend() const noexcept {
+        return {};
+    }
+
+    /// @brief Resumes the awaiting coroutine (if any) when finished.
+    FinalAwaiter final_suspend() const noexcept {
+        return {};
+    }
+
+    /// @brief Stores the exception, which is rethrown when retrieving the result.
+    void unhandled_exception() {
+        exception = std::current_exception();
+    }
+
+    /// @brief Makes nonblocking operations, requests and tasks awaitable within a task.
+    template <typename Awaitable>
+    decltype(auto) await_transform(Awaitable&& awaitable);
+};
+
+/// @brief The promise of a \ref Task returning a value of type \p T.
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value; ///< The returned value.
+
+    /// @brief Returns the task associated with this promise.
+    Task<T> get_return_object() {
+        return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    /// @brief Stores the returned value.
+    template <typename U>
+    void return_value(U&& returned_value) {
+        value.emplace(std::forward<U>(returned_value));
+    }
+
+    /// @brief Returns the value or rethrows the exception of the finished coroutine.
+    T result() {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        return std::move(*value);
+    }
+};
+
+/// @brief The promise of a \ref Task returning nothing.
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    /// @brief Returns the task associated with this promise.
+    Task<void> get_return_object();
+
+    /// @brief Does nothing.
+    void return_void() const {}
+
+    /// @brief Rethrows the exception of the finished coroutine (if any).
+    void result() const {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+};
+
+/// @brief Awaiter starting a \ref Task and resuming the awaiting coroutine when it is finished.
+template <typename T>
+struct TaskAwaiter {
+    Task<T>             task;      ///< The awaited task.
+    CoroutineScheduler* scheduler; ///< The scheduler of the awaiting coroutine.
+
+    /// @brief Returns whether the task has already finished.
+    bool await_ready() const {
+        return task.done();
+    }
+
+    /// @brief Starts the task, which resumes the awaiting coroutine when finished.
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> handle) {
+        task._handle.promise().scheduler    = scheduler;
+        task._handle.promise().continuation = handle;
+        return task._handle;
+    }
+
+    /// @brief Returns the result of the task.
+    T await_resume() {
+        return task._handle.promise().result();
+    }
+};
+
+} // namespace internal
+
+/// @brief A coroutine which can await nonblocking operations (\ref NonBlockingResult objects owning their request),
+/// \ref Request objects and other tasks using \c co_await. Tasks are executed by a \ref CoroutineScheduler.
+///
+/// Awaiting a nonblocking operation suspends the task until the operation is complete and returns its result, e.g.,
+/// @code
+/// Task<std::vector<int>> receive_and_forward(Communicator<> const& comm) {
+///     auto data = co_await comm.irecv<int>(source(0), recv_count(42));
+///     process(data);
+///     // the send buffer is moved into the operation and returned once it is complete
+///     data = co_await comm.isend(send_buf_out(std::move(data)), destination(1));
+///     co_return data;
+/// }
+/// @endcode
+/// Note that statuses of awaited operations are not available, and that operations which block before returning a
+/// nonblocking result (e.g., \c irecv() without a receive count, which probes for the message first) block the
+/// scheduler.
+///
+/// @tparam T The type of the value returned by the coroutine.
+template <typename T>
+class Task {
+public:
+    using promise_type = internal::TaskPromise<T>; ///< The promise type of the coroutine.
+    using value_type   = T;                          ///< The type of the value returned by the coroutine.
+
+    Task(Task const&)            = delete; ///< Copy constructor is deleted.
+    Task& operator=(Task const&) = delete; ///< Copy assignment is deleted.
+
+    /// @brief Move constructor.
+    Task(Task&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+
+    /// @brief Move assignment operator.
+    Task& operator=(Task&& other) noexcept {
+        std::swap(_handle, other._handle);
+        return *this;
+    }
+
+    /// @brief Destroys the coroutine.
+    ~Task() {
+        if (_handle) {
+            _handle.destroy();
+        }
+    }
+
+    /// @brief Returns whether the coroutine has finished.
+    bool done() const {
+        return !_handle || _handle.done();
+    }
+
+    /// @brief Returns the value returned by the finished coroutine or rethrows its exception.
+    T result() {
+        KAMPING_ASSERT(_handle && _handle.done(), "The task has not finished yet.", assert::light);
+        return _handle.promise().result();
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : _handle(handle) {}
+
+    friend promise_type;
+    friend class CoroutineScheduler;
+    friend struct internal::TaskAwaiter<T>;
+
+    std::coroutine_handle<promise_type> _handle; ///< The coroutine.
+};
+
+/// @brief A single-threaded scheduler executing \ref Task coroutines and resuming them when the nonblocking operations
+/// they await are complete.
+///
+/// The requests of all suspended coroutines are tested for completion using a single call to \c MPI_Testsome in each
+/// scheduling round, so many exchanges can be kept in flight without hand-written state machines.
+class CoroutineScheduler {
+public:
+    /// @brief Creates a scheduler without tasks.
+    CoroutineScheduler() = default;
+
+    CoroutineScheduler(CoroutineScheduler const&)            = delete; ///< Copy constructor is deleted.
+    CoroutineScheduler& operator=(CoroutineScheduler const&) = delete; ///< Copy assignment is deleted.
+
+    /// @brief Adds \p task to the tasks executed by this scheduler. It is started by the next call to \ref poll() or
+    /// \ref run().
+    /// @param task The task, which is owned by the scheduler until it has finished.
+    void spawn(Task<> task) {
+        task._handle.promise().scheduler = this;
+        _ready.push_back(task._handle);
+        _tasks.push_back(std::move(task));
+    }
+
+    /// @brief Runs \p task and all other spawned tasks until \p task has finished, and returns its result.
+    template <typename T>
+    T run_until_complete(Task<T> task) {
+        task._handle.promise().scheduler = this;
+        _ready.push_back(task._handle);
+        while (!task.done()) {
+            poll();
+        }
+        return task.result();
+    }
+
+    /// @brief Runs all spawned tasks until they have finished.
+    ///
+    /// If a spawned task throws an exception, it is rethrown after all tasks have finished.
+    void run() {
+        while (poll()) {
+        }
+        std::vector<Task<>> tasks = std::move(_tasks);
+        _tasks.clear();
+        for (auto& task: tasks) {
+            task.result();
+        }
+    }
+
+    /// @brief Resumes all coroutines which are ready, and tests the requests of all suspended coroutines for
+    /// completion once. Can be used to interleave the execution of the coroutines with other work.
+    /// @return Whether there are coroutines which have not finished yet.
+    bool poll() {
+        while (!_ready.empty()) {
+            std::coroutine_handle<> handle = _ready.front();
+            _ready.pop_front();
+            handle.resume();
+        }
+        if (!_requests.empty()) {
+            test_requests();
+        }
+        return !_ready.empty() || !_requests.empty();
+    }
+
+    /// @brief Returns the number of coroutines waiting for the completion of a request.
+    size_t num_pending_requests() const {
+        return _requests.size();
+    }
+
+private:
+    friend void internal::suspend_on_request(CoroutineScheduler&, MPI_Request*, std::coroutine_handle<>);
+
+    /// @brief Tests all pending requests using \c MPI_Testsome and schedules the coroutines of the completed ones.
+    void test_requests() {
+        _completed_indices.resize(_requests.size());
+        int                  num_completed;
+        [[maybe_unused]] int err = MPI_Testsome(
+            asserting_cast<int>(_requests.size()),
+            _requests.data(),
+            &num_completed,
+            _completed_indices.data(),
+            MPI_STATUSES_IGNORE
+        );
+        THROW_IF_MPI_ERROR(err, MPI_Testsome);
+        if (num_completed == MPI_UNDEFINED || num_completed == 0) {
+            return;
+        }
+        for (int i = 0; i < num_completed; ++i) {
+            size_t const index = asserting_cast<size_t>(_completed_indices[asserting_cast<size_t>(i)]);
+            // The request has been freed by MPI_Testsome, so the awaited operation only has to retrieve its result.
+            *_waiters[index].request = MPI_REQUEST_NULL;
+            _ready.push_back(_waiters[index].handle);
+            _waiters[index].request = nullptr;
+        }
+        size_t remaining = 0;
+        for (size_t index = 0; index < _requests.size(); ++index) {
+            if (_waiters[index].request != nullptr) {
+                _requests[remaining] = _requests[index];
+                _waiters[remaining]  = _waiters[index];
+                ++remaining;
+            }
+        }
+        _requests.resize(remaining);
+        _waiters.resize(remaining);
+    }
+
+    /// @brief A coroutine waiting for the completion of a request.
+    struct Waiter {
+        MPI_Request*            request; ///< The location of the request in the awaited object.
+        std::coroutine_handle<> handle;  ///< The suspended coroutine.
+    };
+
+    std::vector<Task<>>                 _tasks;             ///< The spawned tasks.
+    std::deque<std::coroutine_handle<>> _ready;             ///< The coroutines which can be resumed.
+    std::vector<MPI_Request>            _requests;          ///< The requests of the suspended coroutines.
+    std::vector<Waiter>                 _waiters;           ///< The suspended coroutines.
+    std::vector<int>                    _completed_indices; ///< Buffer for the indices returned by MPI_Testsome.
+};
+
+namespace internal {
+
+inline void suspend_on_request(CoroutineScheduler& scheduler, MPI_Request* request, std::coroutine_handle<> handle) {
+    scheduler._requests.push_back(*request);
+    scheduler._waiters.push_back(CoroutineScheduler::Waiter{request, handle});
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() {
+    return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+template <typename Awaitable>
+decltype(auto) TaskPromiseBase::await_transform(Awaitable&& awaitable) {
+    using awaitable_type = std::remove_cvref_t<Awaitable>;
+    if constexpr (is_nonblocking_result<awaitable_type>::value) {
+        static_assert(
+            awaitable_type::owns_request,
+            "Only nonblocking results owning their request can be awaited. Await the request instead."
+        );
+        static_assert(!std::is_lvalue_reference_v<Awaitable>, "Nonblocking results have to be moved into co_await.");
+        KAMPING_ASSERT(scheduler != nullptr, "The task is not executed by a scheduler.", assert::light);
+        return NonBlockingResultAwaiter<awaitable_type>{std::move(awaitable), scheduler};
+    } else if constexpr (std::is_same_v<awaitable_type, Request>) {
+        KAMPING_ASSERT(scheduler != nullptr, "The task is not executed by a scheduler.", assert::light);
+        return RequestAwaiter{&awaitable, scheduler};
+    } else if constexpr (is_task<awaitable_type>::value) {
+        static_assert(!std::is_lvalue_reference_v<Awaitable>, "Tasks have to be moved into co_await.");
+        return TaskAwaiter<typename awaitable_type::value_type>{std::move(awaitable), scheduler};
+    } else {
+        return std::forward<Awaitable>(awaitable);
+    }
+}
+
+} // namespace internal
+
+} // namespace kamping
@@ -0,0 +1,151 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Functions for reading an input file in parallel, such that each rank obtains a balanced part of it.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/allreduce.hpp"
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/file.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/named_parameters.hpp"
+#include "kamping/p2p/sendrecv.hpp"
+
+namespace kamping {
+
+/// @brief A range [begin, end) of elements.
+struct ElementRange {
+    size_t begin; ///< The first element of the range.
+    size_t end;   ///< One past the last element of the range.
+
+    /// @brief Returns the number of elements in the range.
+    size_t size() const {
+        return end - begin;
+    }
+};
+
+/// @brief Splits \p num_elements elements into \p num_parts contiguous ranges whose sizes differ by at most one, and
+/// returns the range of part \p part.
+inline ElementRange balanced_partition(size_t num_elements, size_t part, size_t num_parts) {
+    size_t const base_size = num_elements / num_parts;
+    size_t const remainder = num_elements % num_parts;
+    size_t const begin     = part * base_size + std::min(part, remainder);
+    return ElementRange{begin, begin + base_size + (part < remainder ? 1 : 0)};
+}
+
+/// @brief Reads a balanced part of a file of elements of type \p T on each rank, i.e., the file is split into as many
+/// contiguous ranges of (almost) the same size as there are ranks, and rank \c i reads the \c i-th range. This is a
+/// collective operation on \p comm.
+///
+/// The ranges are read using a single collective \c MPI_File_read_at_all.
+///
+/// @tparam T The type of the elements in the file. The size of the file has to be a multiple of \c sizeof(T).
+/// @param comm The communicator.
+/// @param path The path of the file, which has to be the same on all ranks.
+/// @param hints Hints for the MPI implementation.
+/// @return The elements of the range of this rank.
+template <typename T = char, typename Comm>
+std::vector<T> read_balanced(Comm const& comm, std::string const& path, FileHints const& hints = FileHints()) {
+    File<> const file(comm, path, MPI_MODE_RDONLY, hints);
+    size_t const file_size = asserting_cast<size_t>(file.size());
+    KAMPING_ASSERT(file_size % sizeof(T) == 0, "The file size is not a multiple of the element size.", assert::light);
+    ElementRange const range = balanced_partition(file_size / sizeof(T), comm.rank(), comm.size());
+
+    std::vector<T> data(range.size());
+    file.set_view<T>();
+    file.read_at_all(recv_buf(data), file_offset(asserting_cast<MPI_Offset>(range.begin)));
+    return data;
+}
+
+/// @brief Reads a file of records separated by \p delimiter in parallel, such that each rank obtains a contiguous
+/// sequence of complete records. This is a collective operation on \p comm.
+///
+/// The file is split into balanced byte ranges, which are read using a single collective \c MPI_File_read_at_all. A
+/// record belongs to the rank whose range contains its first byte, so each rank sends the part of its range up to its
+/// first record start to its left neighbor using a single \c sendrecv. Records are only longer than a range for tiny
+/// inputs or huge records. If this happens for any rank, the parts are instead sent directly to their owners using an
+/// \c alltoallv.
+///
+/// @param comm The communicator.
+/// @param path The path of the file, which has to be the same on all ranks.
+/// @param delimiter The byte terminating each record. It is contained in the returned data (except for the last record
+/// of the file if the file does not end with a delimiter).
+/// @param hints Hints for the MPI implementation.
+/// @return The records of this rank. The records of all ranks, ordered by rank, form the whole file.
+template <typename Comm>
+std::vector<char> read_delimited(
+    Comm const& comm, std::string const& path, char delimiter = '\n', FileHints const& hints = FileHints()
+) {
+    File<> const       file(comm, path, MPI_MODE_RDONLY, hints);
+    ElementRange const range = balanced_partition(asserting_cast<size_t>(file.size()), comm.rank(), comm.size());
+
+    // Also read the byte before the range, which tells whether a record starts at the beginning of the range.
+    bool const        read_previous = range.begin > 0 && range.size() > 0;
+    std::vector<char> data(range.size() + (read_previous ? 1 : 0));
+    file.read_at_all(recv_buf(data), file_offset(asserting_cast<MPI_Offset>(range.begin - (read_previous ? 1 : 0))));
+
+    // The bytes before the first record start in this range belong to a record starting on a previous rank.
+    size_t prefix_size = 0;
+    if (read_previous) {
+        auto const first_delimiter = std::find(data.begin(), data.end(), delimiter);
+        prefix_size                = first_delimiter == data.end()
+                                         ? range.size()
+                                         : static_cast<size_t>(std::distance(data.begin(), first_delimiter));
+    }
+    bool const has_record_start = comm.rank() == 0 || (range.size() > 0 && prefix_size < range.size());
+    auto const prefix_begin     = data.begin() + (read_previous ? 1 : 0);
+    auto const prefix_end       = prefix_begin + static_cast<std::ptrdiff_t>(prefix_size);
+
+    std::vector<char> prefix(prefix_begin, prefix_end);
+    std::vector<char> result(prefix_end, data.end());
+    data = std::vector<char>();
+
+    bool const all_have_record_start =
+        comm.allreduce_single(send_buf(has_record_start), op(ops::logical_and<>{}));
+    if (all_have_record_start) {
+        // The common case: each rank completes its last record using the prefix of its right neighbor.
+        std::vector<char> const suffix = comm.template sendrecv<char>(
+            send_buf(prefix),
+            destination(comm.rank_shifted_cyclic(-1)),
+            source(comm.rank_shifted_cyclic(1))
+        );
+        if (comm.rank() + 1 < comm.size()) {
+            result.insert(result.end(), suffix.begin(), suffix.end());
+        }
+    } else {
+        // The prefix belongs to the last rank before this one with a record start.
+        auto const has_start = comm.allgather(send_buf(static_cast<int>(has_record_start)));
+        size_t     owner     = comm.rank();
+        while (owner > 0 && (owner == comm.rank() || !has_start[owner])) {
+            --owner;
+        }
+        std::vector<int> send_counts(comm.size(), 0);
+        send_counts[owner] = asserting_cast<int>(prefix.size());
+        std::vector<char> const suffixes = comm.alltoallv(send_buf(prefix), kamping::send_counts(send_counts));
+        result.insert(result.end(), suffixes.begin(), suffixes.end());
+    }
+    return result;
+}
+
+} // namespace kamping
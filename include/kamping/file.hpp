@@ -0,0 +1,459 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief An abstraction around `MPI_File` for parallel file I/O using MPI-IO.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/data_buffer.hpp"
+#include "kamping/error_handling.hpp"
+#include "kamping/large_count.hpp"
+#include "kamping/mpi_datatype.hpp"
+#include "kamping/named_parameter_check.hpp"
+#include "kamping/named_parameter_selection.hpp"
+#include "kamping/named_parameters.hpp"
+#include "kamping/parameter_objects.hpp"
+#include "kamping/result.hpp"
+
+namespace kamping {
+
+/// @brief Hints passed to MPI when opening a \ref File. Unset hints are left to the MPI implementation.
+///
+/// The hints are reserved by the MPI standard or understood by ROMIO, the MPI-IO implementation of most MPI
+/// libraries. Implementations ignore hints they do not support.
+struct FileHints {
+    std::optional<bool>   collective_buffering; ///< Whether to use collective buffering (two-phase I/O).
+    std::optional<int>    cb_nodes;             ///< The number of aggregators performing the collective I/O.
+    std::optional<size_t> cb_buffer_size;       ///< The buffer size of each aggregator in bytes.
+    std::optional<int>    striping_factor;      ///< The number of I/O devices to stripe a new file across.
+    std::optional<size_t> striping_unit;        ///< The size of the stripes of a new file in bytes.
+
+    /// @brief Creates an \c MPI_Info object containing the hints, which has to be freed by the caller.
+    MPI_Info to_mpi_info() const {
+        MPI_Info info;
+        MPI_Info_create(&info);
+        auto const set = [&](char const* key, std::string const& value) {
+            MPI_Info_set(info, key, value.c_str());
+        };
+        if (collective_buffering) {
+            set("collective_buffering", *collective_buffering ? "true" : "false");
+            // ROMIO ignores the reserved key above and uses its own keys instead
+            set("romio_cb_read", *collective_buffering ? "enable" : "disable");
+            set("romio_cb_write", *collective_buffering ? "enable" : "disable");
+        }
+        if (cb_nodes) {
+            set("cb_nodes", std::to_string(*cb_nodes));
+        }
+        if (cb_buffer_size) {
+            set("cb_buffer_size", std::to_string(*cb_buffer_size));
+        }
+        if (striping_factor) {
+            set("striping_factor", std::to_string(*striping_factor));
+        }
+        if (striping_unit) {
+            set("striping_unit", std::to_string(*striping_unit));
+        }
+        return info;
+    }
+};
+
+/// @brief A file opened collectively by all ranks of a communicator using \c MPI_File_open.
+///
+/// The file is accessed using explicit offsets, given by \ref kamping::file_offset(). The offsets are in units of the
+/// elementary type of the file view, i.e., in bytes for the default view. After calling \ref set_view<T>(), they are
+/// in elements of type \c T.
+///
+/// Reading operations (\ref read_at(), \ref read_at_all(), \ref iread_at() and \ref iread_at_all()) accept the
+/// following parameters:
+/// - \ref kamping::file_offset() the position to read from (required).
+/// - \ref kamping::recv_buf() the buffer to read into. If omitted, a new buffer is allocated, whose value type has to
+/// be given as template parameter.
+/// - \ref kamping::recv_count() the number of elements to read. If omitted, the size of the receive buffer is used.
+/// - \ref kamping::status() or \ref kamping::status_out() to obtain the number of elements actually read, which may be
+/// less than requested at the end of the file (blocking operations only).
+/// - \ref kamping::request() the request to use (non-blocking operations only).
+///
+/// Writing operations (\ref write_at(), \ref write_at_all(), \ref iwrite_at() and \ref iwrite_at_all()) accept the
+/// following parameters:
+/// - \ref kamping::file_offset() the position to write to (required).
+/// - \ref kamping::send_buf() the data to write (required).
+/// - \ref kamping::status() or \ref kamping::status_out() (blocking operations only).
+/// - \ref kamping::request() the request to use (non-blocking operations only).
+///
+/// Operations ending with \c _all are collective and have to be called by all ranks, which allows MPI to combine the
+/// accesses of all ranks into few large contiguous accesses (see \ref FileHints). Errors are reported by throwing a
+/// \ref MpiErrorException, as file handles use \c MPI_ERRORS_RETURN by default.
+///
+/// @tparam DefaultContainerType The container type used for buffers allocated by reading operations.
+template <template <typename...> typename DefaultContainerType = std::vector>
+class File {
+public:
+    /// @brief Opens the file at \p path. This is a collective operation on \p comm.
+    /// @param comm The communicator.
+    /// @param path The path of the file, which has to be the same on all ranks.
+    /// @param access_mode The access mode, e.g., \c MPI_MODE_RDONLY or \c MPI_MODE_CREATE | \c MPI_MODE_WRONLY.
+    /// @param hints Hints for the MPI implementation.
+    template <typename Comm>
+    File(Comm const& comm, std::string const& path, int access_mode, FileHints const& hints = FileHints()) {
+        MPI_Info info = hints.to_mpi_info();
+        int      err  = MPI_File_open(comm.mpi_communicator(), path.c_str(), access_mode, info, &_file);
+        MPI_Info_free(&info);
+        THROW_IF_MPI_ERROR(err, MPI_File_open);
+    }
+
+    /// @brief Copying is not allowed.
+    File(File const&) = delete;
+    /// @brief Copying is not allowed.
+    File& operator=(File const&) = delete;
+
+    /// @brief Move constructor.
+    File(File&& other) noexcept : _file(std::exchange(other._file, MPI_FILE_NULL)) {}
+
+    /// @brief Move assignment.
+    File& operator=(File&& other) noexcept {
+        std::swap(_file, other._file);
+        return *this;
+    }
+
+    /// @brief Closes the file. This is a collective operation.
+    ~File() {
+        if (_file != MPI_FILE_NULL) {
+            MPI_File_close(&_file);
+        }
+    }
+
+    /// @brief Deletes the file at \p path. This is not a collective operation.
+    static void remove(std::string const& path) {
+        int const err = MPI_File_delete(path.c_str(), MPI_INFO_NULL);
+        THROW_IF_MPI_ERROR(err, MPI_File_delete);
+    }
+
+    /// @brief Returns the underlying MPI file handle.
+    MPI_File mpi_file() const {
+        return _file;
+    }
+
+    /// @brief Returns the size of the file in bytes.
+    MPI_Offset size() const {
+        MPI_Offset size;
+        int const  err = MPI_File_get_size(_file, &size);
+        THROW_IF_MPI_ERROR(err, MPI_File_get_size);
+        return size;
+    }
+
+    /// @brief Truncates or extends the file to \p size bytes. This is a collective operation.
+    void resize(MPI_Offset size) const {
+        int const err = MPI_File_set_size(_file, size);
+        THROW_IF_MPI_ERROR(err, MPI_File_set_size);
+    }
+
+    /// @brief Transfers all previous writes to the storage device. This is a collective operation.
+    void sync() const {
+        int const err = MPI_File_sync(_file);
+        THROW_IF_MPI_ERROR(err, MPI_File_sync);
+    }
+
+    /// @brief Sets the file view such that the file is accessed in elements of type \p T starting at byte \p
+    /// displacement. Afterwards, file offsets are given in elements of type \p T relative to \p displacement. This is a
+    /// collective operation.
+    /// @tparam T The elementary type of the view.
+    /// @param displacement The offset of the view in the file in bytes.
+    /// @param filetype The layout of the elements visible to this rank. Defaults to a contiguous sequence of elements
+    /// of type \p T. Has to be derived from \c mpi_datatype<T>().
+    /// @param info Hints for the MPI implementation.
+    template <typename T>
+    void set_view(
+        MPI_Offset displacement = 0, MPI_Datatype filetype = mpi_datatype<T>(), MPI_Info info = MPI_INFO_NULL
+    ) const {
+        int const err = MPI_File_set_view(_file, displacement, mpi_datatype<T>(), filetype, "native", info);
+        THROW_IF_MPI_ERROR(err, MPI_File_set_view);
+    }
+
+    /// @brief Reads from the file using \c MPI_File_read_at. See \ref File for the accepted parameters.
+    template <typename recv_value_type_tparam = internal::unused_tparam, typename... Args>
+    auto read_at(Args... args) const {
+        return read<recv_value_type_tparam>(MPI_File_read_at, "MPI_File_read_at", std::move(args)...);
+    }
+
+    /// @brief Reads from the file collectively using \c MPI_File_read_at_all. See \ref File for the accepted
+    /// parameters.
+    template <typename recv_value_type_tparam = internal::unused_tparam, typename... Args>
+    auto read_at_all(Args... args) const {
+        return read<recv_value_type_tparam>(MPI_File_read_at_all, "MPI_File_read_at_all", std::move(args)...);
+    }
+
+    /// @brief Starts reading from the file using \c MPI_File_iread_at. See \ref File for the accepted parameters.
+    /// @return A \ref NonBlockingResult, which returns the receive buffer when completed (if allocated by KaMPIng).
+    template <typename recv_value_type_tparam = internal::unused_tparam, typename... Args>
+    auto iread_at(Args... args) const {
+        return iread<recv_value_type_tparam>(MPI_File_iread_at, "MPI_File_iread_at", std::move(args)...);
+    }
+
+    /// @brief Starts reading from the file collectively using \c MPI_File_iread_at_all. See \ref File for the accepted
+    /// parameters.
+    /// @return A \ref NonBlockingResult, which returns the receive buffer when completed (if allocated by KaMPIng).
+    template <typename recv_value_type_tparam = internal::unused_tparam, typename... Args>
+    auto iread_at_all(Args... args) const {
+        return iread<recv_value_type_tparam>(MPI_File_iread_at_all, "MPI_File_iread_at_all", std::move(args)...);
+    }
+
+    /// @brief Writes to the file using \c MPI_File_write_at. See \ref File for the accepted parameters.
+    template <typename... Args>
+    auto write_at(Args... args) const {
+        return write(MPI_File_write_at, "MPI_File_write_at", std::move(args)...);
+    }
+
+    /// @brief Writes to the file collectively using \c MPI_File_write_at_all. See \ref File for the accepted
+    /// parameters.
+    template <typename... Args>
+    auto write_at_all(Args... args) const {
+        return write(MPI_File_write_at_all, "MPI_File_write_at_all", std::move(args)...);
+    }
+
+    /// @brief Starts writing to the file using \c MPI_File_iwrite_at. See \ref File for the accepted parameters.
+    /// @return A \ref NonBlockingResult, which keeps the send buffer alive until completion if it has been moved into
+    /// the call.
+    template <typename... Args>
+    auto iwrite_at(Args... args) const {
+        return iwrite(MPI_File_iwrite_at, "MPI_File_iwrite_at", std::move(args)...);
+    }
+
+    /// @brief Starts writing to the file collectively using \c MPI_File_iwrite_at_all. See \ref File for the accepted
+    /// parameters.
+    /// @return A \ref NonBlockingResult, which keeps the send buffer alive until completion if it has been moved into
+    /// the call.
+    template <typename... Args>
+    auto iwrite_at_all(Args... args) const {
+        return iwrite(MPI_File_iwrite_at_all, "MPI_File_iwrite_at_all", std::move(args)...);
+    }
+
+private:
+    /// @brief Signature of \c MPI_File_read_at and \c MPI_File_read_at_all.
+    using ReadFunction = int (*)(MPI_File, MPI_Offset, void*, int, MPI_Datatype, MPI_Status*);
+    /// @brief Signature of \c MPI_File_iread_at and \c MPI_File_iread_at_all.
+    using IReadFunction = int (*)(MPI_File, MPI_Offset, void*, int, MPI_Datatype, MPI_Request*);
+    /// @brief Signature of \c MPI_File_write_at and \c MPI_File_write_at_all.
+    using WriteFunction = int (*)(MPI_File, MPI_Offset, void const*, int, MPI_Datatype, MPI_Status*);
+    /// @brief Signature of \c MPI_File_iwrite_at and \c MPI_File_iwrite_at_all.
+    using IWriteFunction = int (*)(MPI_File, MPI_Offset, void const*, int, MPI_Datatype, MPI_Request*);
+
+    /// @brief Throws an \ref MpiErrorException if \p err is not \c MPI_SUCCESS.
+    static void check_error(int err, char const* function_name) {
+        THROWING_KAMPING_ASSERT_SPECIFIED(
+            err == MPI_SUCCESS,
+            function_name << " failed!",
+            kamping::MpiErrorException,
+            err
+        );
+    }
+
+    /// @brief Returns the offset passed via \ref kamping::file_offset().
+    template <typename... Args>
+    static MPI_Offset offset(Args&... args) {
+        return internal::select_parameter_type<internal::ParameterType::file_offset>(args...)
+            .construct_buffer_or_rebind()
+            .get_single_element();
+    }
+
+    /// @brief Returns the receive buffer, resized to the number of elements to read.
+    template <typename recv_value_type_tparam, typename... Args>
+    static auto prepare_recv_buf(Args&... args) {
+        using default_recv_buf_type =
+            decltype(kamping::recv_buf(alloc_new<DefaultContainerType<recv_value_type_tparam>>));
+        auto recv_buf =
+            internal::select_parameter_type_or_default<internal::ParameterType::recv_buf, default_recv_buf_type>(
+                std::tuple<>(),
+                args...
+            )
+                .template construct_buffer_or_rebind<DefaultContainerType>();
+        using recv_value_type = typename std::remove_reference_t<decltype(recv_buf)>::value_type;
+        static_assert(
+            !std::is_same_v<recv_value_type, internal::unused_tparam>,
+            "No recv_buf parameter provided and no receive value given as template parameter. One of these is required."
+        );
+
+        size_t count;
+        if constexpr (internal::has_parameter_type<internal::ParameterType::recv_count, Args...>()) {
+            auto recv_count = internal::select_parameter_type<internal::ParameterType::recv_count>(args...)
+                                  .construct_buffer_or_rebind();
+            static_assert(!internal::has_to_be_computed<decltype(recv_count)>, "The receive count has to be given.");
+            count = asserting_cast<size_t>(recv_count.get_single_element());
+        } else {
+            static_assert(
+                !std::remove_reference_t<decltype(recv_buf)>::is_lib_allocated,
+                "Either a receive buffer or a receive count has to be given."
+            );
+            count = recv_buf.size();
+        }
+        recv_buf.resize_if_requested([&]() { return count; });
+        KAMPING_ASSERT(recv_buf.size() >= count, "Recv buffer is not large enough.", assert::light);
+        return std::pair(std::move(recv_buf), count);
+    }
+
+    /// @brief Implementation of the blocking reading operations.
+    template <typename recv_value_type_tparam, typename... Args>
+    auto read(ReadFunction read_function, char const* function_name, Args... args) const {
+        KAMPING_CHECK_PARAMETERS(
+            Args,
+            KAMPING_REQUIRED_PARAMETERS(file_offset),
+            KAMPING_OPTIONAL_PARAMETERS(recv_buf, recv_count, status)
+        );
+        auto [recv_buf, count] = prepare_recv_buf<recv_value_type_tparam>(args...);
+        using recv_value_type  = typename std::remove_reference_t<decltype(recv_buf)>::value_type;
+
+        using default_status_param_type = decltype(kamping::status(kamping::ignore<>));
+        auto status =
+            internal::select_parameter_type_or_default<internal::ParameterType::status, default_status_param_type>(
+                {},
+                args...
+            )
+                .construct_buffer_or_rebind();
+
+        // Reads of more than 2^31 - 1 elements use a single element of a derived datatype.
+        internal::CountAndType const count_and_type(count, mpi_datatype<recv_value_type>());
+        int const                    err = read_function(
+            _file,
+            offset(args...),
+            recv_buf.data(),
+            count_and_type.count(),
+            count_and_type.type(),
+            internal::status_param_to_native_ptr(status)
+        );
+        check_error(err, function_name);
+        return internal::make_mpi_result<std::tuple<Args...>>(std::move(recv_buf), std::move(status));
+    }
+
+    /// @brief Implementation of the non-blocking reading operations.
+    template <typename recv_value_type_tparam, typename... Args>
+    auto iread(IReadFunction iread_function, char const* function_name, Args... args) const {
+        KAMPING_CHECK_PARAMETERS(
+            Args,
+            KAMPING_REQUIRED_PARAMETERS(file_offset),
+            KAMPING_OPTIONAL_PARAMETERS(recv_buf, recv_count, request)
+        );
+        auto [recv_buf, count] = prepare_recv_buf<recv_value_type_tparam>(args...);
+        using recv_value_type  = typename std::remove_reference_t<decltype(recv_buf)>::value_type;
+
+        using default_request_param = decltype(kamping::request());
+        auto&& request_param =
+            internal::select_parameter_type_or_default<internal::ParameterType::request, default_request_param>(
+                std::tuple{},
+                args...
+            );
+
+        // store the receive buffer on the heap to ensure pointer stability until completion
+        auto buffers_on_heap = internal::move_buffer_to_heap(std::move(recv_buf));
+        internal::CountAndType const count_and_type(count, mpi_datatype<recv_value_type>());
+        int const                    err = iread_function(
+            _file,
+            offset(args...),
+            internal::select_parameter_type_in_tuple<internal::ParameterType::recv_buf>(*buffers_on_heap).data(),
+            count_and_type.count(),
+            count_and_type.type(),
+            request_param.underlying().request_ptr()
+        );
+        check_error(err, function_name);
+        return internal::make_nonblocking_result<std::tuple<Args...>>(
+            std::move(request_param),
+            std::move(buffers_on_heap)
+        );
+    }
+
+    /// @brief Implementation of the blocking writing operations.
+    template <typename... Args>
+    auto write(WriteFunction write_function, char const* function_name, Args... args) const {
+        KAMPING_CHECK_PARAMETERS(
+            Args,
+            KAMPING_REQUIRED_PARAMETERS(send_buf, file_offset),
+            KAMPING_OPTIONAL_PARAMETERS(status)
+        );
+        auto const send_buf =
+            internal::select_parameter_type<internal::ParameterType::send_buf>(args...).construct_buffer_or_rebind();
+        using send_value_type = std::remove_const_t<typename std::remove_reference_t<decltype(send_buf)>::value_type>;
+
+        using default_status_param_type = decltype(kamping::status(kamping::ignore<>));
+        auto status =
+            internal::select_parameter_type_or_default<internal::ParameterType::status, default_status_param_type>(
+                {},
+                args...
+            )
+                .construct_buffer_or_rebind();
+
+        internal::CountAndType const count_and_type(send_buf.size(), mpi_datatype<send_value_type>());
+        int const                    err = write_function(
+            _file,
+            offset(args...),
+            send_buf.data(),
+            count_and_type.count(),
+            count_and_type.type(),
+            internal::status_param_to_native_ptr(status)
+        );
+        check_error(err, function_name);
+        return internal::make_mpi_result<std::tuple<Args...>>(std::move(status));
+    }
+
+    /// @brief Implementation of the non-blocking writing operations.
+    template <typename... Args>
+    auto iwrite(IWriteFunction iwrite_function, char const* function_name, Args... args) const {
+        KAMPING_CHECK_PARAMETERS(
+            Args,
+            KAMPING_REQUIRED_PARAMETERS(send_buf, file_offset),
+            KAMPING_OPTIONAL_PARAMETERS(request)
+        );
+        auto send_buf =
+            internal::select_parameter_type<internal::ParameterType::send_buf>(args...).construct_buffer_or_rebind();
+        using send_value_type = std::remove_const_t<typename std::remove_reference_t<decltype(send_buf)>::value_type>;
+
+        using default_request_param = decltype(kamping::request());
+        auto&& request_param =
+            internal::select_parameter_type_or_default<internal::ParameterType::request, default_request_param>(
+                std::tuple{},
+                args...
+            );
+
+        // store the send buffer on the heap to ensure pointer stability until completion
+        auto        buffers_on_heap = internal::move_buffer_to_heap(std::move(send_buf));
+        auto const& heap_send_buf =
+            internal::select_parameter_type_in_tuple<internal::ParameterType::send_buf>(*buffers_on_heap);
+        internal::CountAndType const count_and_type(heap_send_buf.size(), mpi_datatype<send_value_type>());
+        int const                    err = iwrite_function(
+            _file,
+            offset(args...),
+            heap_send_buf.data(),
+            count_and_type.count(),
+            count_and_type.type(),
+            request_param.underlying().request_ptr()
+        );
+        check_error(err, function_name);
+        return internal::make_nonblocking_result<std::tuple<Args...>>(
+            std::move(request_param),
+            std::move(buffers_on_heap)
+        );
+    }
+
+    MPI_File _file = MPI_FILE_NULL; ///< The file handle.
+};
+
+} // namespace kamping
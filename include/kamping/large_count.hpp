@@ -0,0 +1,282 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// @brief Helpers for communicating more than `2^31 - 1` elements with a single operation.
+///
+/// The classic MPI interface describes counts and displacements using \c int. MPI-4 added large-count variants (e.g.,
+/// \c MPI_Alltoallv_c) taking \c MPI_Count and \c MPI_Aint instead. For MPI libraries not providing these, a large
+/// number of elements can still be communicated by describing them using a single derived datatype, which is sent
+/// with a count of one.
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/named_parameter_check.hpp"
+#include "kamping/named_parameter_selection.hpp"
+#include "kamping/named_parameter_types.hpp"
+#include "kamping/types/scoped_datatype.hpp"
+
+namespace kamping::internal {
+
+/// @brief Checks whether \p count can be passed as a classic \c int count to MPI.
+template <typename T>
+constexpr bool fits_in_int(T count) {
+    static_assert(std::is_integral_v<T>);
+    return in_range<int>(count);
+}
+
+/// @brief Creates a (non-committed) derived datatype describing \p count consecutive elements of type \p base_type
+/// starting \p byte_offset bytes after the buffer address.
+///
+/// The elements are grouped into `count / max_block_length` blocks of \p max_block_length elements, described by a
+/// single \c MPI_Type_vector, plus one block containing the remaining elements. Both are combined using \c
+/// MPI_Type_create_struct, which takes the (potentially large) displacements as \c MPI_Aint. Sending one element of
+/// the resulting type is equivalent to sending \p count elements of \p base_type.
+///
+/// @param count The number of elements described by the type.
+/// @param base_type The type of each element.
+/// @param byte_offset The offset of the first element in bytes.
+/// @param max_block_length The maximum number of elements in a block. Only has to be changed for testing purposes.
+/// @return The created type. Has to be committed before use and freed by the caller.
+inline MPI_Datatype large_contiguous_type(
+    MPI_Count    count,
+    MPI_Datatype base_type,
+    MPI_Aint     byte_offset      = 0,
+    int          max_block_length = std::numeric_limits<int>::max()
+) {
+    KAMPING_ASSERT(count >= 0, "The number of elements must not be negative.");
+    KAMPING_ASSERT(max_block_length > 0, "The maximum block length must be positive.");
+    MPI_Aint lower_bound;
+    MPI_Aint extent;
+    int      err = MPI_Type_get_extent(base_type, &lower_bound, &extent);
+    KAMPING_ASSERT(err == MPI_SUCCESS, "MPI_Type_get_extent failed");
+
+    MPI_Count const num_full_blocks = count / max_block_length;
+    int const       remainder       = static_cast<int>(count % max_block_length);
+
+    std::array<int, 2>          block_lengths;
+    std::array<MPI_Aint, 2>     displacements;
+    std::array<MPI_Datatype, 2> types;
+    int                         num_entries = 0;
+    MPI_Datatype                full_blocks = MPI_DATATYPE_NULL;
+    if (num_full_blocks > 0) {
+        err = MPI_Type_vector(
+            asserting_cast<int>(num_full_blocks),
+            max_block_length,
+            max_block_length,
+            base_type,
+            &full_blocks
+        );
+        KAMPING_ASSERT(err == MPI_SUCCESS, "MPI_Type_vector failed");
+        block_lengths[0] = 1;
+        displacements[0] = byte_offset;
+        types[0]         = full_blocks;
+        ++num_entries;
+    }
+    if (remainder > 0 || num_entries == 0) {
+        block_lengths[static_cast<size_t>(num_entries)] = remainder;
+        displacements[static_cast<size_t>(num_entries)] =
+            byte_offset + static_cast<MPI_Aint>(num_full_blocks) * max_block_length * extent;
+        types[static_cast<size_t>(num_entries)] = base_type;
+        ++num_entries;
+    }
+
+    MPI_Datatype type;
+    err = MPI_Type_create_struct(num_entries, block_lengths.data(), displacements.data(), types.data(), &type);
+    KAMPING_ASSERT(err == MPI_SUCCESS, "MPI_Type_create_struct failed");
+    if (full_blocks != MPI_DATATYPE_NULL) {
+        err = MPI_Type_free(&full_blocks);
+        KAMPING_ASSERT(err == MPI_SUCCESS, "MPI_Type_free failed");
+    }
+    return type;
+}
+
+/// @brief Count and datatype to pass to a classic MPI function for transferring a given number of elements.
+///
+/// If the number of elements fits into an \c int, the base type is used directly. Otherwise, all elements are
+/// described by a single derived datatype created using \ref large_contiguous_type(), and the count is one. The derived
+/// datatype is freed on destruction. As MPI allows freeing a datatype while a communication using it is pending, this
+/// object only has to be kept alive until the communication has been started.
+class CountAndType {
+public:
+    /// @brief Describes \p count elements of type \p base_type.
+    template <typename T>
+    CountAndType(T count, MPI_Datatype base_type) {
+        static_assert(std::is_integral_v<T>);
+        if (fits_in_int(count)) {
+            _count = static_cast<int>(count);
+            _type  = base_type;
+        } else {
+            _large_type = types::ScopedDatatype(large_contiguous_type(asserting_cast<MPI_Count>(count), base_type));
+            _count      = 1;
+            _type       = _large_type.data_type();
+        }
+    }
+
+    /// @brief The count to pass to MPI.
+    int count() const {
+        return _count;
+    }
+
+    /// @brief The datatype to pass to MPI.
+    MPI_Datatype type() const {
+        return _type;
+    }
+
+    /// @brief Returns \c true if the elements are described by a derived large-count datatype.
+    bool uses_large_type() const {
+        return _large_type.data_type() != MPI_DATATYPE_NULL;
+    }
+
+private:
+    types::ScopedDatatype _large_type; ///< The derived datatype if the count does not fit into an \c int.
+    int                   _count;      ///< The count to pass to MPI.
+    MPI_Datatype          _type;       ///< The datatype to pass to MPI.
+};
+
+/// @brief Checks if the parameter with parameter type \p ptype is contained in \p Args and holds counts (or
+/// displacements) of another type than \c int. Collectives use this to select their large-count variant.
+template <ParameterType ptype, typename... Args>
+constexpr bool parameter_uses_large_counts() {
+    if constexpr (has_parameter_type<ptype, Args...>()) {
+        using buffer_type = typename buffer_type_with_requested_parameter_type<ptype, Args...>::DataBufferType;
+        return !std::is_same_v<std::remove_const_t<typename buffer_type::value_type>, int>;
+    } else {
+        return false;
+    }
+}
+
+/// @brief Name of the MPI function called by \ref alltoallv_large_count(), used for error reporting.
+#if MPI_VERSION >= 4
+constexpr char const* alltoallv_large_count_name = "MPI_Alltoallv_c";
+#else
+constexpr char const* alltoallv_large_count_name = "MPI_Alltoallw";
+#endif
+
+/// @brief Calls an \c MPI_Alltoallv with counts and displacements of an arbitrary integral type \p CountType.
+///
+/// If the MPI library supports MPI-4, \c MPI_Alltoallv_c is used. Otherwise, the block exchanged with each rank is
+/// described by a derived datatype which also contains the displacement of the block (see \ref
+/// large_contiguous_type()), and the data is exchanged using \c MPI_Alltoallw with a count of one and a displacement
+/// of zero for each rank.
+///
+/// @return The error code returned by MPI.
+template <typename CountType>
+int alltoallv_large_count(
+    void const*      send_buf,
+    CountType const* send_counts,
+    CountType const* send_displs,
+    MPI_Datatype     send_type,
+    void*            recv_buf,
+    CountType const* recv_counts,
+    CountType const* recv_displs,
+    MPI_Datatype     recv_type,
+    MPI_Comm         comm,
+    size_t           comm_size
+) {
+#if MPI_VERSION >= 4
+    std::vector<MPI_Count> mpi_send_counts(comm_size);
+    std::vector<MPI_Aint>  mpi_send_displs(comm_size);
+    std::vector<MPI_Count> mpi_recv_counts(comm_size);
+    std::vector<MPI_Aint>  mpi_recv_displs(comm_size);
+    for (size_t i = 0; i < comm_size; ++i) {
+        mpi_send_counts[i] = asserting_cast<MPI_Count>(send_counts[i]);
+        mpi_send_displs[i] = asserting_cast<MPI_Aint>(send_displs[i]);
+        mpi_recv_counts[i] = asserting_cast<MPI_Count>(recv_counts[i]);
+        mpi_recv_displs[i] = asserting_cast<MPI_Aint>(recv_displs[i]);
+    }
+    return MPI_Alltoallv_c(
+        send_buf,               // send_buf
+        mpi_send_counts.data(), // send_counts
+        mpi_send_displs.data(), // send_displs
+        send_type,              // send_type
+        recv_buf,               // recv_buf
+        mpi_recv_counts.data(), // recv_counts
+        mpi_recv_displs.data(), // recv_displs
+        recv_type,              // recv_type
+        comm                    // comm
+    );
+#else
+    MPI_Aint lower_bound;
+    MPI_Aint send_extent;
+    MPI_Aint recv_extent;
+    MPI_Type_get_extent(send_type, &lower_bound, &send_extent);
+    MPI_Type_get_extent(recv_type, &lower_bound, &recv_extent);
+
+    std::vector<types::ScopedDatatype> send_types;
+    std::vector<types::ScopedDatatype> recv_types;
+    std::vector<MPI_Datatype>          mpi_send_types(comm_size);
+    std::vector<MPI_Datatype>          mpi_recv_types(comm_size);
+    send_types.reserve(comm_size);
+    recv_types.reserve(comm_size);
+    for (size_t i = 0; i < comm_size; ++i) {
+        send_types.emplace_back(large_contiguous_type(
+            asserting_cast<MPI_Count>(send_counts[i]),
+            send_type,
+            asserting_cast<MPI_Aint>(send_displs[i]) * send_extent
+        ));
+        recv_types.emplace_back(large_contiguous_type(
+            asserting_cast<MPI_Count>(recv_counts[i]),
+            recv_type,
+            asserting_cast<MPI_Aint>(recv_displs[i]) * recv_extent
+        ));
+        mpi_send_types[i] = send_types.back().data_type();
+        mpi_recv_types[i] = recv_types.back().data_type();
+    }
+    std::vector<int> const ones(comm_size, 1);
+    std::vector<int> const zeros(comm_size, 0);
+    return MPI_Alltoallw(
+        send_buf,              // send_buf
+        ones.data(),           // send_counts
+        zeros.data(),          // send_displs
+        mpi_send_types.data(), // send_types
+        recv_buf,              // recv_buf
+        ones.data(),           // recv_counts
+        zeros.data(),          // recv_displs
+        mpi_recv_types.data(), // recv_types
+        comm                   // comm
+    );
+#endif
+}
+
+/// @brief Returns the number of elements of type \p data_type received in the message described by \p status. In
+/// contrast to \c MPI_Get_count, this also works for messages containing more than `2^31 - 1` elements.
+inline MPI_Count large_count(MPI_Status const& status, MPI_Datatype data_type) {
+#if MPI_VERSION >= 4
+    MPI_Count count;
+    MPI_Get_count_c(&status, data_type, &count);
+    return count;
+#else
+    // MPI_Get_elements_x counts basic elements, which are bytes when asking for MPI_BYTE.
+    MPI_Count num_bytes;
+    MPI_Count type_size;
+    MPI_Get_elements_x(&status, MPI_BYTE, &num_bytes);
+    MPI_Type_size_x(data_type, &type_size);
+    if (num_bytes == MPI_UNDEFINED || type_size == 0) {
+        return MPI_UNDEFINED;
+    }
+    return num_bytes / type_size;
+#endif
+}
+
+} // namespace kamping::internal
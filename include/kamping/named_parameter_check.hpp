@@ -415,4 +415,21 @@ template <typename DataBufferType>
 static constexpr bool buffer_uses_serialization = internal::is_serialization_buffer_v<
     typename std::remove_const_t<std::remove_reference_t<DataBufferType>>::MemberTypeWithConstAndRef>;
 
+/// @brief Checks if the parameter with parameter type \p ptype is contained in \p Args and has been passed as a
+/// serialization buffer (see \ref kamping::as_serialized() and \ref kamping::as_deserializable()).
+template <ParameterType ptype, typename... Args>
+constexpr bool parameter_uses_serialization() {
+    if constexpr (has_parameter_type<ptype, Args...>()) {
+        using buffer_builder_type = buffer_type_with_requested_parameter_type<ptype, Args...>;
+        return buffer_uses_serialization<typename buffer_builder_type::DataBufferType>;
+    } else {
+        return false;
+    }
+}
+
+/// @brief The type of the serialization buffer passed as parameter with parameter type \p ptype in \p Args.
+template <ParameterType ptype, typename... Args>
+using serialization_buffer_type_t = std::remove_const_t<std::remove_reference_t<
+    typename buffer_type_with_requested_parameter_type<ptype, Args...>::DataBufferType::MemberTypeWithConstAndRef>>;
+
 } // namespace kamping::internal
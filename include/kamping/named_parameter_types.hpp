@@ -63,6 +63,11 @@ enum class ParameterType {
     send_tag,         ///< Tag used to represent the message send tag in a \c MPI call.
     recv_tag,         ///< Tag used to represent the message recv tag in a \c MPI call.
     send_mode,        ///< Tag used to represent the send mode used by a send operation.
+    algorithm,        ///< Tag used to represent the algorithm used by a collective operation.
+    target,           ///< Tag used to represent the target rank of a one-sided \c MPI call.
+    target_disp,      ///< Tag used to represent the displacement in the target window of a one-sided \c MPI call.
+    compare_value,    ///< Tag used to represent the value to compare with in \c MPI_Compare_and_swap.
+    file_offset,      ///< Tag used to represent the offset in a file accessed by an \c MPI-IO call.
     values_on_rank_0, ///< Tag used to represent the value of the exclusive scan
                       ///< operation on rank 0.
     send_type,        ///< Tag used to represent a send type in an \c MPI call.
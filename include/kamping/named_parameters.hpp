@@ -34,6 +34,32 @@ namespace kamping {
 namespace internal {
 /// @brief An unused template parameter
 struct unused_tparam {};
+
+/// @brief The value type expected for a container of type \p Container passed as counts or displacements. This is \c
+/// int, unless the container holds integers wider than \c int, which selects the large-count variant of the
+/// operations supporting it (e.g., \ref Communicator::alltoallv_large_count()).
+template <typename Container, typename Enable = void>
+struct count_value_type {
+    using type = int; ///< The expected value type.
+};
+
+/// @brief The value type expected for a container of type \p Container passed as counts or displacements. This is \c
+/// int, unless the container holds integers wider than \c int, which selects the large-count variant of the
+/// operations supporting it (e.g., \ref Communicator::alltoallv_large_count()).
+template <typename Container>
+struct count_value_type<Container, std::void_t<typename std::remove_reference_t<Container>::value_type>> {
+    /// @brief The value type of the container.
+    using container_value_type = std::remove_const_t<typename std::remove_reference_t<Container>::value_type>;
+    /// @brief The expected value type.
+    using type = std::conditional_t<
+        std::is_integral_v<container_value_type> && (sizeof(container_value_type) > sizeof(int)),
+        container_value_type,
+        int>;
+};
+
+/// @brief The value type expected for a container of type \p Container passed as counts or displacements.
+template <typename Container>
+using count_value_type_t = typename count_value_type<Container>::type;
 } // namespace internal
 
 namespace params {
@@ -208,7 +234,7 @@ auto send_counts(Container&& container) {
         internal::BufferModifiability::constant,
         internal::BufferType::in_buffer,
         BufferResizePolicy::no_resize,
-        int>(std::forward<Container>(container));
+        internal::count_value_type_t<Container>>(std::forward<Container>(container));
 }
 
 /// @brief Passes the initializer list as send counts to the underlying call.
@@ -250,7 +276,7 @@ auto send_counts_out(Container&& container) {
         internal::BufferModifiability::modifiable,
         internal::BufferType::out_buffer,
         resize_policy,
-        int>(std::forward<Container>(container));
+        internal::count_value_type_t<Container>>(std::forward<Container>(container));
 }
 
 /// @brief Indicates to construct an object of type \p Container, into which the send counts deduced by KaMPIng will be
@@ -273,7 +299,7 @@ auto send_counts_out(AllocNewT<Container>) {
         internal::BufferModifiability::modifiable,
         internal::BufferType::out_buffer,
         BufferResizePolicy::resize_to_fit,
-        int>(alloc_new<Container>);
+        internal::count_value_type_t<Container>>(alloc_new<Container>);
 }
 
 /// @brief Indicates to construct a container with type \p Container<int>, into which the send counts deduced by KaMPIng
@@ -371,7 +397,7 @@ auto recv_counts(Container&& container) {
         internal::BufferModifiability::constant,
         internal::BufferType::in_buffer,
         BufferResizePolicy::no_resize,
-        int>(std::forward<Container>(container));
+        internal::count_value_type_t<Container>>(std::forward<Container>(container));
 }
 
 /// @brief Passes the initializer list as recv counts to the underlying call.
@@ -419,7 +445,7 @@ auto recv_counts_out(Container&& container) {
         internal::BufferModifiability::modifiable,
         internal::BufferType::out_buffer,
         resize_policy,
-        int>(std::forward<Container>(container));
+        internal::count_value_type_t<Container>>(std::forward<Container>(container));
 }
 
 /// @brief Indicates to construct an object of type \p Container, into which the recv counts deduced by KaMPIng will be
@@ -442,7 +468,7 @@ auto recv_counts_out(AllocNewT<Data> container) {
         internal::BufferModifiability::modifiable,
         internal::BufferType::out_buffer,
         BufferResizePolicy::resize_to_fit,
-        int>(container);
+        internal::count_value_type_t<Data>>(container);
 }
 
 /// @brief Indicates to construct a container with type \p Container<int>, into which the recv counts deduced by KaMPIng
@@ -579,7 +605,7 @@ auto send_displs(Container&& container) {
         internal::BufferModifiability::constant,
         internal::BufferType::in_buffer,
         BufferResizePolicy::no_resize,
-        int>(std::forward<Container>(container));
+        internal::count_value_type_t<Container>>(std::forward<Container>(container));
 }
 
 /// @brief Passes the initializer list as send displacements to the underlying call.
@@ -621,7 +647,7 @@ auto send_displs_out(Container&& container) {
         internal::BufferModifiability::modifiable,
         internal::BufferType::out_buffer,
         resize_policy,
-        int>(std::forward<Container>(container));
+        internal::count_value_type_t<Container>>(std::forward<Container>(container));
 }
 
 /// @brief Indicates to construct an object of type \p Container, into which the send displacements deduced by KaMPIng
@@ -643,7 +669,7 @@ auto send_displs_out(AllocNewT<Container>) {
         internal::BufferModifiability::modifiable,
         internal::BufferType::out_buffer,
         BufferResizePolicy::resize_to_fit,
-        int>(alloc_new<Container>);
+        internal::count_value_type_t<Container>>(alloc_new<Container>);
 }
 
 /// @brief Indicates to construct a container with type \p Container<int>, into which the send displacements deduced by
@@ -702,7 +728,7 @@ auto recv_displs(Container&& container) {
         internal::BufferModifiability::constant,
         internal::BufferType::in_buffer,
         BufferResizePolicy::no_resize,
-        int>(std::forward<Container>(container));
+        internal::count_value_type_t<Container>>(std::forward<Container>(container));
 }
 
 /// @brief Passes the initializer list as receive displacements to the underlying call.
@@ -744,7 +770,7 @@ auto recv_displs_out(Container&& container) {
         internal::BufferModifiability::modifiable,
         internal::BufferType::out_buffer,
         resize_policy,
-        int>(std::forward<Container>(container));
+        internal::count_value_type_t<Container>>(std::forward<Container>(container));
 }
 
 /// @brief Indicates to construct an object of type \p Container, into which the receive displacements deduced by
@@ -766,7 +792,7 @@ auto recv_displs_out(AllocNewT<Container>) {
         internal::BufferModifiability::modifiable,
         internal::BufferType::out_buffer,
         BufferResizePolicy::resize_to_fit,
-        int>(alloc_new<Container>);
+        internal::count_value_type_t<Container>>(alloc_new<Container>);
 }
 
 /// @brief Indicates to construct a container with type \p Container<int>, into which the receive displacements deduced
@@ -1059,6 +1085,70 @@ inline auto source(internal::rank_null_t) {
     return internal::RankDataBuffer<internal::RankType::null, internal::ParameterType::source>{};
 }
 
+/// @brief Passes \p rank as target rank to the underlying one-sided call, e.g., \ref Window::put().
+///
+/// @param rank The target rank.
+/// @return The corresponding parameter object.
+/// @see \ref docs/parameter_handling.md for general information about parameter handling in KaMPIng.
+inline auto target(int rank) {
+    return internal::RankDataBuffer<internal::RankType::value, internal::ParameterType::target>(rank);
+}
+
+/// @brief Passes \p rank as target rank to the underlying one-sided call, e.g., \ref Window::put().
+///
+/// @param rank The target rank.
+/// @return The corresponding parameter object.
+/// @see \ref docs/parameter_handling.md for general information about parameter handling in KaMPIng.
+inline auto target(size_t rank) {
+    return target(asserting_cast<int>(rank));
+}
+
+/// @brief Passes \p disp as displacement in the target window to the underlying one-sided call, e.g., \ref
+/// Window::put(). The displacement is given in units of the window's displacement unit.
+///
+/// @param disp The target displacement.
+/// @return The corresponding parameter object.
+/// @see \ref docs/parameter_handling.md for general information about parameter handling in KaMPIng.
+inline auto target_disp(MPI_Aint disp) {
+    return internal::make_data_buffer_builder<
+        internal::ParameterType::target_disp,
+        internal::BufferModifiability::constant,
+        internal::BufferType::in_buffer,
+        BufferResizePolicy::no_resize,
+        MPI_Aint>(std::move(disp));
+}
+
+/// @brief Passes \p value as the value to compare the target element with to \ref Window::compare_and_swap().
+///
+/// @tparam T The type of the value.
+/// @param value The value to compare with.
+/// @return The corresponding parameter object.
+/// @see \ref docs/parameter_handling.md for general information about parameter handling in KaMPIng.
+template <typename T>
+inline auto compare_value(T&& value) {
+    return internal::make_data_buffer_builder<
+        internal::ParameterType::compare_value,
+        internal::BufferModifiability::constant,
+        internal::BufferType::in_buffer,
+        BufferResizePolicy::no_resize>(std::forward<T>(value));
+}
+
+/// @brief Passes \p offset as the position in a file at which \ref File::read_at(), \ref File::write_at() and their
+/// variants access the file. The offset is given in units of the elementary type of the file view, i.e., in bytes for
+/// the default view and in elements of type \c T after calling \ref File::set_view<T>().
+///
+/// @param offset The offset.
+/// @return The corresponding parameter object.
+/// @see \ref docs/parameter_handling.md for general information about parameter handling in KaMPIng.
+inline auto file_offset(MPI_Offset offset) {
+    return internal::make_data_buffer_builder<
+        internal::ParameterType::file_offset,
+        internal::BufferModifiability::constant,
+        internal::BufferType::in_buffer,
+        BufferResizePolicy::no_resize,
+        MPI_Offset>(std::move(offset));
+}
+
 /// @brief Indicates to use \c MPI_ANY_TAG as tag in the underlying call.
 ///
 /// @return The corresponding parameter object.
@@ -1202,6 +1292,16 @@ inline auto send_mode(SendModeTag) {
     return internal::SendModeParameter<SendModeTag>{};
 }
 
+/// @brief Passes the algorithm to use for an alltoallv exchange to the underlying call.
+/// Pass any of the tags from the \c kamping::alltoallv_algorithms namespace.
+///
+/// @return The corresponding parameter object.
+/// @see \ref docs/parameter_handling.md for general information about parameter handling in KaMPIng.
+template <typename AlgorithmTag>
+inline auto alltoallv_algorithm(AlgorithmTag algorithm) {
+    return internal::AlltoallvAlgorithmParameter<AlgorithmTag>{algorithm};
+}
+
 /// @brief Passes a reduction operation to ther underlying call. Accepts function objects, lambdas, function pointers or
 /// native \c MPI_Op as argument.
 ///
@@ -24,6 +24,7 @@
 #include "kamping/data_buffer.hpp"
 #include "kamping/implementation_helpers.hpp"
 #include "kamping/kassert/kassert.hpp"
+#include "kamping/large_count.hpp"
 #include "kamping/named_parameter_check.hpp"
 #include "kamping/named_parameter_selection.hpp"
 #include "kamping/named_parameter_types.hpp"
@@ -143,40 +144,46 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::irecv(Args... args
     KAMPING_ASSERT(internal::is_valid_rank_in_comm(source_param, *this, true, true));
     int source = source_param.rank_signed();
     int tag    = tag_param.tag();
+
+    size_t recv_count;
     if constexpr (internal::has_to_be_computed<decltype(recv_count_param)>) {
         Status probe_status = this->probe(source_param.clone(), tag_param.clone(), status_out()).extract_status();
         source              = probe_status.source_signed();
         tag                 = probe_status.tag();
-        recv_count_param.underlying() = asserting_cast<int>(probe_status.count(recv_type.get_single_element()));
+        // Messages with more than 2^31 - 1 elements are received as a single element of a derived datatype.
+        recv_count =
+            asserting_cast<size_t>(internal::large_count(probe_status.native(), recv_type.get_single_element()));
+        if constexpr (internal::has_parameter_type<internal::ParameterType::recv_count, Args...>()) {
+            recv_count_param.underlying() = asserting_cast<int>(recv_count);
+        }
+    } else {
+        recv_count = asserting_cast<size_t>(recv_count_param.get_single_element());
     }
 
     // Ensure that we do not touch the recv buffer if MPI_PROC_NULL is passed,
     // because this is what the standard guarantees.
     if constexpr (std::remove_reference_t<decltype(source_param)>::rank_type != internal::RankType::null) {
-        auto compute_required_recv_buf_size = [&] {
-            return asserting_cast<size_t>(recv_count_param.get_single_element());
-        };
-        recv_buf.resize_if_requested(compute_required_recv_buf_size);
+        recv_buf.resize_if_requested([&] { return recv_count; });
         KAMPING_ASSERT(
             // if the recv type is user provided, kamping cannot make any assumptions about the required size of the
             // recv buffer
-            recv_type_is_in_param || recv_buf.size() >= compute_required_recv_buf_size(),
+            recv_type_is_in_param || recv_buf.size() >= recv_count,
             "Recv buffer is not large enough to hold all received elements.",
             assert::light
         );
     }
 
+    internal::CountAndType const count_and_type(recv_count, recv_type.get_single_element());
+
     // store all parameters/buffers for which we have to ensure pointer stability until completion of the immediate MPI
     // call on the heap.
     auto buffers_on_heap = move_buffer_to_heap(std::move(recv_buf), std::move(recv_count_param), std::move(recv_type));
 
     [[maybe_unused]] int err = MPI_Irecv(
         internal::select_parameter_type_in_tuple<internal::ParameterType::recv_buf>(*buffers_on_heap)
-            .data(), // recvbuf,
-        internal::select_parameter_type_in_tuple<internal::ParameterType::recv_count>(*buffers_on_heap)
-            .get_single_element(), // count,
-        internal::select_parameter_type_in_tuple<internal::ParameterType::recv_type>(*buffers_on_heap)
-            .get_single_element(),               // datatype
+            .data(),                             // recvbuf,
+        count_and_type.count(),                  // count,
+        count_and_type.type(),                   // datatype
         source,                                  // source
         tag,                                     // tag
         this->mpi_communicator(),                // comm
@@ -22,6 +22,7 @@
 #include "kamping/communicator.hpp"
 #include "kamping/implementation_helpers.hpp"
 #include "kamping/kassert/kassert.hpp"
+#include "kamping/large_count.hpp"
 #include "kamping/named_parameter_check.hpp"
 #include "kamping/named_parameter_selection.hpp"
 #include "kamping/named_parameter_types.hpp"
@@ -96,8 +97,22 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::isend(Args... args
         )
             .construct_buffer_or_rebind();
     if constexpr (has_to_be_computed<decltype(send_count)>) {
-        send_count.underlying() = asserting_cast<int>(send_buf.size());
+        if constexpr (internal::has_parameter_type<internal::ParameterType::send_count, Args...>()) {
+            // a send count requested via send_count_out() has to be representable as int
+            send_count.underlying() = asserting_cast<int>(send_buf.size());
+        } else if (internal::fits_in_int(send_buf.size())) {
+            send_count.underlying() = static_cast<int>(send_buf.size());
+        }
     }
+    // If no send count is given, buffers with more than 2^31 - 1 elements are sent as a single element of a derived
+    // datatype.
+    auto const count_and_type = [&] {
+        if constexpr (has_to_be_computed<decltype(send_count)>) {
+            return internal::CountAndType(send_buf.size(), send_type.get_single_element());
+        } else {
+            return internal::CountAndType(send_count.get_single_element(), send_type.get_single_element());
+        }
+    }();
 
     auto const&    destination = internal::select_parameter_type<internal::ParameterType::destination>(args...);
     constexpr auto rank_type   = std::remove_reference_t<decltype(destination)>::rank_type;
@@ -149,8 +164,8 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::isend(Args... args
     if constexpr (std::is_same_v<send_mode, internal::standard_mode_t>) {
         [[maybe_unused]] int err = MPI_Isend(
             send_buf_ptr,                            // send_buf
-            send_count.get_single_element(),         // send_count
-            send_type.get_single_element(),          // send_type
+            count_and_type.count(),                  // send_count
+            count_and_type.type(),                   // send_type
             destination.rank_signed(),               // destination
             tag,                                     // tag
             this->mpi_communicator(),                // comm
@@ -160,8 +175,8 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::isend(Args... args
     } else if constexpr (std::is_same_v<send_mode, internal::buffered_mode_t>) {
         [[maybe_unused]] int err = MPI_Ibsend(
             send_buf_ptr,                            // send_buf
-            send_count.get_single_element(),         // send_count
-            send_type.get_single_element(),          // send_type
+            count_and_type.count(),                  // send_count
+            count_and_type.type(),                   // send_type
             destination.rank_signed(),               // destination
             tag,                                     // tag
             this->mpi_communicator(),                // comm
@@ -171,8 +186,8 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::isend(Args... args
     } else if constexpr (std::is_same_v<send_mode, internal::synchronous_mode_t>) {
         [[maybe_unused]] int err = MPI_Issend(
             send_buf_ptr,                            // send_buf
-            send_count.get_single_element(),         // send_count
-            send_type.get_single_element(),          // send_type
+            count_and_type.count(),                  // send_count
+            count_and_type.type(),                   // send_type
             destination.rank_signed(),               // destination
             tag,                                     // tag
             this->mpi_communicator(),                // comm
@@ -182,8 +197,8 @@ auto kamping::Communicator<DefaultContainerType, Plugins...>::isend(Args... args
     } else if constexpr (std::is_same_v<send_mode, internal::ready_mode_t>) {
         [[maybe_unused]] int err = MPI_Irsend(
             send_buf_ptr,                            // send_buf
-            send_count.get_single_element(),         // send_count
-            send_type.get_single_element(),          // send_type
+            count_and_type.count(),                  // send_count
+            count_and_type.type(),                   // send_type
             destination.rank_signed(),               // destination
             tag,                                     // tag
             this->mpi_communicator(),                // comm
@@ -22,6 +22,7 @@
 #include "kamping/communicator.hpp"
 #include "kamping/implementation_helpers.hpp"
 #include "kamping/kassert/kassert.hpp"
+#include "kamping/large_count.hpp"
 #include "kamping/named_parameter_check.hpp"
 #include "kamping/named_parameter_selection.hpp"
 #include "kamping/named_parameter_types.hpp"
@@ -91,8 +92,22 @@ void kamping::Communicator<DefaultContainerType, Plugins...>::send(Args... args)
         )
             .construct_buffer_or_rebind();
     if constexpr (has_to_be_computed<decltype(send_count)>) {
-        send_count.underlying() = asserting_cast<int>(send_buf.size());
+        if constexpr (internal::has_parameter_type<internal::ParameterType::send_count, Args...>()) {
+            // a send count requested via send_count_out() has to be representable as int
+            send_count.underlying() = asserting_cast<int>(send_buf.size());
+        } else if (internal::fits_in_int(send_buf.size())) {
+            send_count.underlying() = static_cast<int>(send_buf.size());
+        }
     }
+    // If no send count is given, buffers with more than 2^31 - 1 elements are sent as a single element of a derived
+    // datatype.
+    auto const count_and_type = [&] {
+        if constexpr (has_to_be_computed<decltype(send_count)>) {
+            return internal::CountAndType(send_buf.size(), send_type.get_single_element());
+        } else {
+            return internal::CountAndType(send_count.get_single_element(), send_type.get_single_element());
+        }
+    }();
 
     auto const&    destination = internal::select_parameter_type<internal::ParameterType::destination>(args...);
     constexpr auto rank_type   = std::remove_reference_t<decltype(destination)>::rank_type;
@@ -130,41 +145,41 @@ void kamping::Communicator<DefaultContainerType, Plugins...>::send(Args... args)
 
     if constexpr (std::is_same_v<send_mode, internal::standard_mode_t>) {
         [[maybe_unused]] int err = MPI_Send(
-            send_buf.data(),                 // send_buf
-            send_count.get_single_element(), // send_count
-            send_type.get_single_element(),  // send_type
-            destination.rank_signed(),       // destination
-            tag,                             // tag
+            send_buf.data(),           // send_buf
+            count_and_type.count(),    // send_count
+            count_and_type.type(),     // send_type
+            destination.rank_signed(), // destination
+            tag,                       // tag
             this->mpi_communicator()
         );
         this->mpi_error_hook(err, "MPI_Send");
     } else if constexpr (std::is_same_v<send_mode, internal::buffered_mode_t>) {
         [[maybe_unused]] int err = MPI_Bsend(
-            send_buf.data(),                 // send_buf
-            send_count.get_single_element(), // send_count
-            send_type.get_single_element(),  // send_type
-            destination.rank_signed(),       // destination
-            tag,                             // tag
+            send_buf.data(),           // send_buf
+            count_and_type.count(),    // send_count
+            count_and_type.type(),     // send_type
+            destination.rank_signed(), // destination
+            tag,                       // tag
             this->mpi_communicator()
         );
         this->mpi_error_hook(err, "MPI_Bsend");
     } else if constexpr (std::is_same_v<send_mode, internal::synchronous_mode_t>) {
         [[maybe_unused]] int err = MPI_Ssend(
-            send_buf.data(),                 // send_buf
-            send_count.get_single_element(), // send_count
-            send_type.get_single_element(),  // send_type
-            destination.rank_signed(),       // destination
-            tag,                             // tag
+            send_buf.data(),           // send_buf
+            count_and_type.count(),    // send_count
+            count_and_type.type(),     // send_type
+            destination.rank_signed(), // destination
+            tag,                       // tag
             this->mpi_communicator()
         );
         this->mpi_error_hook(err, "MPI_Ssend");
     } else if constexpr (std::is_same_v<send_mode, internal::ready_mode_t>) {
         [[maybe_unused]] int err = MPI_Rsend(
-            send_buf.data(),                 // send_buf
-            send_count.get_single_element(), // send_count
-            send_type.get_single_element(),  // send_type
-            destination.rank_signed(),       // destination
-            tag,                             // tag
+            send_buf.data(),           // send_buf
+            count_and_type.count(),    // send_count
+            count_and_type.type(),     // send_type
+            destination.rank_signed(), // destination
+            tag,                       // tag
             this->mpi_communicator()
         );
         this->mpi_error_hook(err, "MPI_Rsend");
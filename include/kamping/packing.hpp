@@ -0,0 +1,447 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// @brief KaMPIng's native packing format for (nested) containers of trivially copyable types.
+///
+/// Packing is a lightweight alternative to serialization via cereal for the common case of nested containers such as
+/// `std::vector<std::vector<int>>`, `std::vector<std::string>` or `std::pair<std::vector<T>, std::vector<U>>`. A
+/// packed object consists of length-prefixed contiguous blocks: each container is stored as its number of elements
+/// followed by its elements. Containers of trivially copyable elements are copied with a single \c std::memcpy, and the
+/// packed size of an object can be computed in a single pass before packing, such that no intermediate buffer has to
+/// grow while packing.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kamping {
+namespace internal {
+
+/// @brief Type trait to check if \p T can be packed using KaMPIng's native packing format.
+/// Trivially copyable types can always be packed.
+template <typename T>
+struct is_packable : std::is_trivially_copyable<T> {};
+
+/// @brief \c std::vector is packable if its elements are packable.
+template <typename T, typename Allocator>
+struct is_packable<std::vector<T, Allocator>> : is_packable<T> {};
+
+/// @brief \c std::vector<bool> does not store its elements contiguously and can therefore not be packed.
+template <typename Allocator>
+struct is_packable<std::vector<bool, Allocator>> : std::false_type {};
+
+/// @brief \c std::basic_string is packable if its characters are packable.
+template <typename CharT, typename Traits, typename Allocator>
+struct is_packable<std::basic_string<CharT, Traits, Allocator>> : is_packable<CharT> {};
+
+/// @brief \c std::array is packable if its elements are packable.
+template <typename T, size_t N>
+struct is_packable<std::array<T, N>> : is_packable<T> {};
+
+/// @brief \c std::pair is packable if both of its members are packable.
+template <typename First, typename Second>
+struct is_packable<std::pair<First, Second>> : std::conjunction<is_packable<First>, is_packable<Second>> {};
+
+/// @brief \c std::tuple is packable if all of its members are packable.
+template <typename... Ts>
+struct is_packable<std::tuple<Ts...>> : std::conjunction<is_packable<Ts>...> {};
+
+/// @brief Type used to store the number of elements of a packed container.
+using packed_length_type = std::uint64_t;
+
+/// @brief Writes packed data to a contiguous memory region. The caller is responsible to provide enough memory.
+struct PointerWriter {
+    char* position; ///< Position to write the next bytes to.
+
+    /// @brief Copies \p count bytes starting at \p data to the current position.
+    void write(void const* data, size_t count) {
+        std::memcpy(position, data, count);
+        position += count;
+    }
+};
+
+/// @brief Reads packed data from a contiguous memory region.
+struct PointerReader {
+    char const* position; ///< Position to read the next bytes from.
+    char const* end;      ///< Position past the last readable byte.
+
+    /// @brief Copies \p count bytes from the current position to \p data.
+    /// @throws std::out_of_range if less than \p count bytes are left to read.
+    void read(void* data, size_t count) {
+        if (static_cast<size_t>(end - position) < count) {
+            throw std::out_of_range("The packed data ends before the object to unpack is complete.");
+        }
+        std::memcpy(data, position, count);
+        position += count;
+    }
+
+    /// @brief Skips \p count bytes.
+    /// @throws std::out_of_range if less than \p count bytes are left to read.
+    void skip(size_t count) {
+        if (static_cast<size_t>(end - position) < count) {
+            throw std::out_of_range("The packed data ends before the object to unpack is complete.");
+        }
+        position += count;
+    }
+
+    /// @brief Checks that at least \p num_elements elements of \p element_size bytes each are left to read.
+    /// @throws std::out_of_range if less bytes are left to read.
+    void expect(size_t num_elements, size_t element_size) const {
+        if (element_size != 0 && static_cast<size_t>(end - position) / element_size < num_elements) {
+            throw std::out_of_range("The packed data ends before the object to unpack is complete.");
+        }
+    }
+};
+
+/// @brief Writes packed data to a \c std::ostream.
+struct StreamWriter {
+    std::ostream& stream; ///< The stream to write to.
+
+    /// @brief Writes \p count bytes starting at \p data to the stream.
+    void write(void const* data, size_t count) {
+        stream.write(static_cast<char const*>(data), static_cast<std::streamsize>(count));
+    }
+};
+
+/// @brief Reads packed data from a \c std::istream.
+struct StreamReader {
+    std::istream& stream; ///< The stream to read from.
+
+    /// @brief Reads \p count bytes from the stream into \p data.
+    /// @throws std::out_of_range if the stream ends before \p count bytes have been read.
+    void read(void* data, size_t count) {
+        if (!stream.read(static_cast<char*>(data), static_cast<std::streamsize>(count))) {
+            throw std::out_of_range("The packed data ends before the object to unpack is complete.");
+        }
+    }
+
+    /// @brief Does nothing, as the number of bytes left in a stream is not known in advance. A stream ending early is
+    /// detected by \ref read().
+    void expect(size_t, size_t) const {}
+};
+
+/// @brief Implements packing for a single type. The primary template handles trivially copyable types, which are
+/// copied byte-wise.
+template <typename T>
+struct Packer {
+    static_assert(
+        std::is_trivially_copyable_v<T>,
+        "Only (nested containers of) trivially copyable types can be packed."
+    );
+
+    /// @brief Lower bound on the number of bytes a packed value of this type occupies.
+    static constexpr size_t min_size = sizeof(T);
+
+    /// @brief Returns the number of bytes \p value occupies when packed.
+    static constexpr size_t size(T const&) {
+        return sizeof(T);
+    }
+
+    /// @brief Packs \p value using \p writer.
+    template <typename Writer>
+    static void write(T const& value, Writer& writer) {
+        writer.write(&value, sizeof(T));
+    }
+
+    /// @brief Unpacks \p value using \p reader.
+    template <typename Reader>
+    static void read(Reader& reader, T& value) {
+        reader.read(&value, sizeof(T));
+    }
+};
+
+/// @brief Packs a contiguous container, i.e., its number of elements followed by its elements. Containers of
+/// trivially copyable elements are copied as a single block.
+template <typename Container>
+struct ContiguousContainerPacker {
+    using value_type = typename Container::value_type; ///< Type of the elements.
+
+    /// @brief Lower bound on the number of bytes a packed container occupies, i.e., the size of an empty one.
+    static constexpr size_t min_size = sizeof(packed_length_type);
+
+    /// @brief Returns the number of bytes \p container occupies when packed.
+    static size_t size(Container const& container) {
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            return sizeof(packed_length_type) + container.size() * sizeof(value_type);
+        } else {
+            size_t packed_size = sizeof(packed_length_type);
+            for (auto const& element: container) {
+                packed_size += Packer<value_type>::size(element);
+            }
+            return packed_size;
+        }
+    }
+
+    /// @brief Packs \p container using \p writer.
+    template <typename Writer>
+    static void write(Container const& container, Writer& writer) {
+        packed_length_type const length = container.size();
+        writer.write(&length, sizeof(packed_length_type));
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            writer.write(container.data(), container.size() * sizeof(value_type));
+        } else {
+            for (auto const& element: container) {
+                Packer<value_type>::write(element, writer);
+            }
+        }
+    }
+
+    /// @brief Unpacks \p container using \p reader. The container is resized to the number of packed elements.
+    template <typename Reader>
+    static void read(Reader& reader, Container& container) {
+        packed_length_type length;
+        reader.read(&length, sizeof(packed_length_type));
+        // check the length against the remaining data first, so that corrupted data cannot trigger a huge allocation
+        reader.expect(static_cast<size_t>(length), Packer<value_type>::min_size);
+        container.resize(static_cast<size_t>(length));
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            reader.read(container.data(), container.size() * sizeof(value_type));
+        } else {
+            for (auto& element: container) {
+                Packer<value_type>::read(reader, element);
+            }
+        }
+    }
+};
+
+/// @brief Packing for \c std::vector.
+template <typename T, typename Allocator>
+struct Packer<std::vector<T, Allocator>> : ContiguousContainerPacker<std::vector<T, Allocator>> {};
+
+/// @brief Packing for \c std::basic_string.
+template <typename CharT, typename Traits, typename Allocator>
+struct Packer<std::basic_string<CharT, Traits, Allocator>>
+    : ContiguousContainerPacker<std::basic_string<CharT, Traits, Allocator>> {};
+
+/// @brief Packing for \c std::array. As the number of elements is known at compile time, no length is stored.
+template <typename T, size_t N>
+struct Packer<std::array<T, N>> {
+    /// @brief Lower bound on the number of bytes a packed array occupies.
+    static constexpr size_t min_size = N * Packer<T>::min_size;
+
+    /// @brief Returns the number of bytes \p array occupies when packed.
+    static size_t size(std::array<T, N> const& array) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            return sizeof(array);
+        } else {
+            size_t packed_size = 0;
+            for (auto const& element: array) {
+                packed_size += Packer<T>::size(element);
+            }
+            return packed_size;
+        }
+    }
+
+    /// @brief Packs \p array using \p writer.
+    template <typename Writer>
+    static void write(std::array<T, N> const& array, Writer& writer) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            writer.write(array.data(), sizeof(array));
+        } else {
+            for (auto const& element: array) {
+                Packer<T>::write(element, writer);
+            }
+        }
+    }
+
+    /// @brief Unpacks \p array using \p reader.
+    template <typename Reader>
+    static void read(Reader& reader, std::array<T, N>& array) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            reader.read(array.data(), sizeof(array));
+        } else {
+            for (auto& element: array) {
+                Packer<T>::read(reader, element);
+            }
+        }
+    }
+};
+
+/// @brief Packing for \c std::pair. The members are packed one after another.
+template <typename First, typename Second>
+struct Packer<std::pair<First, Second>> {
+    /// @brief Lower bound on the number of bytes a packed pair occupies.
+    static constexpr size_t min_size = Packer<First>::min_size + Packer<Second>::min_size;
+
+    /// @brief Returns the number of bytes \p pair occupies when packed.
+    static size_t size(std::pair<First, Second> const& pair) {
+        return Packer<First>::size(pair.first) + Packer<Second>::size(pair.second);
+    }
+
+    /// @brief Packs \p pair using \p writer.
+    template <typename Writer>
+    static void write(std::pair<First, Second> const& pair, Writer& writer) {
+        Packer<First>::write(pair.first, writer);
+        Packer<Second>::write(pair.second, writer);
+    }
+
+    /// @brief Unpacks \p pair using \p reader.
+    template <typename Reader>
+    static void read(Reader& reader, std::pair<First, Second>& pair) {
+        Packer<First>::read(reader, pair.first);
+        Packer<Second>::read(reader, pair.second);
+    }
+};
+
+/// @brief Packing for \c std::tuple. The members are packed one after another.
+template <typename... Ts>
+struct Packer<std::tuple<Ts...>> {
+    /// @brief Lower bound on the number of bytes a packed tuple occupies.
+    static constexpr size_t min_size = (size_t{0} + ... + Packer<Ts>::min_size);
+
+    /// @brief Returns the number of bytes \p tuple occupies when packed.
+    static size_t size(std::tuple<Ts...> const& tuple) {
+        return std::apply(
+            [](auto const&... members) { return (size_t{0} + ... + packed_member_size(members)); },
+            tuple
+        );
+    }
+
+    /// @brief Packs \p tuple using \p writer.
+    template <typename Writer>
+    static void write(std::tuple<Ts...> const& tuple, Writer& writer) {
+        std::apply([&](auto const&... members) { (write_member(members, writer), ...); }, tuple);
+    }
+
+    /// @brief Unpacks \p tuple using \p reader.
+    template <typename Reader>
+    static void read(Reader& reader, std::tuple<Ts...>& tuple) {
+        std::apply([&](auto&... members) { (read_member(reader, members), ...); }, tuple);
+    }
+
+private:
+    template <typename T>
+    static size_t packed_member_size(T const& member) {
+        return Packer<T>::size(member);
+    }
+
+    template <typename T, typename Writer>
+    static void write_member(T const& member, Writer& writer) {
+        Packer<T>::write(member, writer);
+    }
+
+    template <typename T, typename Reader>
+    static void read_member(Reader& reader, T& member) {
+        Packer<T>::read(reader, member);
+    }
+};
+
+/// @brief Writes \p value as a \c uint64_t using \p writer. Binary formats built on top of the packing readers and
+/// writers use this for sizes and counts.
+template <typename Writer>
+void write_uint64(Writer& writer, uint64_t value) {
+    Packer<uint64_t>::write(value, writer);
+}
+
+/// @brief Reads a \c uint64_t written by \ref write_uint64() using \p reader.
+template <typename Reader>
+uint64_t read_uint64(Reader& reader) {
+    uint64_t value;
+    Packer<uint64_t>::read(reader, value);
+    return value;
+}
+
+} // namespace internal
+
+/// @brief \c true if objects of type \p T can be packed using KaMPIng's native packing format, i.e., if \p T is
+/// trivially copyable or a (nested) \c std::vector, \c std::basic_string, \c std::array, \c std::pair or \c std::tuple
+/// of packable types.
+template <typename T>
+constexpr bool is_packable_v = internal::is_packable<std::remove_cv_t<T>>::value;
+
+/// @brief Returns the number of bytes \p value occupies when packed with KaMPIng's native packing format.
+template <typename T>
+size_t packed_size(T const& value) {
+    static_assert(is_packable_v<T>, "Only (nested containers of) trivially copyable types can be packed.");
+    return internal::Packer<T>::size(value);
+}
+
+/// @brief Packs \p value into the memory starting at \p out, which has to provide at least \ref packed_size() bytes.
+/// @return Pointer past the last written byte.
+template <typename T>
+char* pack(T const& value, char* out) {
+    static_assert(is_packable_v<T>, "Only (nested containers of) trivially copyable types can be packed.");
+    internal::PointerWriter writer{out};
+    internal::Packer<T>::write(value, writer);
+    return writer.position;
+}
+
+/// @brief Unpacks an object previously packed with \ref pack() from the \p size bytes starting at \p in into \p
+/// value.
+/// @return Pointer past the last read byte.
+/// @throws std::out_of_range if the object to unpack extends beyond the \p size bytes starting at \p in.
+template <typename T>
+char const* unpack(char const* in, size_t size, T& value) {
+    static_assert(is_packable_v<T>, "Only (nested containers of) trivially copyable types can be packed.");
+    internal::PointerReader reader{in, in + size};
+    internal::Packer<T>::read(reader, value);
+    return reader.position;
+}
+
+/// @brief Output archive writing KaMPIng's native packing format to a \c std::ostream. The interface mirrors the one of
+/// cereal's archives, such that it can be used wherever KaMPIng accepts an output archive, e.g.,
+/// `as_serialized<PackingOutputArchive, PackingInputArchive>(data)`. Serialization buffers using this archive bypass
+/// the stream and pack directly into the communication buffer (see \ref as_packed()).
+class PackingOutputArchive {
+public:
+    /// @brief Constructs an archive writing to \p stream.
+    explicit PackingOutputArchive(std::ostream& stream) : _writer{stream} {}
+
+    /// @brief Packs all passed objects one after another.
+    template <typename... Ts>
+    void operator()(Ts const&... values) {
+        static_assert(
+            (is_packable_v<Ts> && ...),
+            "Only (nested containers of) trivially copyable types can be packed."
+        );
+        (internal::Packer<Ts>::write(values, _writer), ...);
+    }
+
+private:
+    internal::StreamWriter _writer; ///< Writer to the underlying stream.
+};
+
+/// @brief Input archive reading KaMPIng's native packing format from a \c std::istream. Counterpart of \ref
+/// PackingOutputArchive.
+class PackingInputArchive {
+public:
+    /// @brief Constructs an archive reading from \p stream.
+    explicit PackingInputArchive(std::istream& stream) : _reader{stream} {}
+
+    /// @brief Unpacks all passed objects one after another.
+    template <typename... Ts>
+    void operator()(Ts&... values) {
+        static_assert(
+            (is_packable_v<Ts> && ...),
+            "Only (nested containers of) trivially copyable types can be packed."
+        );
+        (internal::Packer<Ts>::read(_reader, values), ...);
+    }
+
+private:
+    internal::StreamReader _reader; ///< Reader from the underlying stream.
+};
+
+} // namespace kamping
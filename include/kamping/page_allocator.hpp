@@ -0,0 +1,197 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// @brief An allocator obtaining whole pages from the operating system, which can request transparent huge pages and
+/// bind the memory to the NUMA node of the calling thread.
+///
+/// Large receive buffers (e.g., of an alltoallv exchange) span many pages. Backing them with huge pages reduces TLB
+/// misses, and binding them to the local NUMA node avoids remote memory traffic when the received data is processed.
+/// Both are only supported on Linux. On other platforms, and for allocations smaller than \ref
+/// PagePolicy::min_bytes, memory is allocated using \c operator \c new.
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#ifdef __linux__
+    #include <linux/mempolicy.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace kamping {
+
+/// @brief Configures the memory obtained by a \ref PageAllocator.
+///
+/// @tparam huge_pages_ Whether to request transparent huge pages for the memory (using `madvise(MADV_HUGEPAGE)`).
+/// @tparam bind_to_local_numa_node_ Whether to bind the memory to the NUMA node of the thread performing the
+/// allocation (using `mbind(MPOL_PREFERRED)`). Pages are still allocated on other nodes if the local node is full.
+/// @tparam touch_on_allocation_ If true, all pages are touched by the allocating thread right after allocation, such
+/// that they are physically allocated (on the local NUMA node under the first-touch policy). Otherwise, pages are
+/// physically allocated when they are first written to, e.g., by MPI when receiving data.
+template <bool huge_pages_, bool bind_to_local_numa_node_, bool touch_on_allocation_>
+struct PagePolicy {
+    static constexpr bool   huge_pages              = huge_pages_;              ///< Request transparent huge pages.
+    static constexpr bool   bind_to_local_numa_node = bind_to_local_numa_node_; ///< Bind to the local NUMA node.
+    static constexpr bool   touch_on_allocation     = touch_on_allocation_;     ///< Touch pages on allocation.
+    static constexpr size_t min_bytes               = size_t{1} << 16; ///< Smaller allocations use \c operator \c new.
+};
+
+/// @brief Default \ref PagePolicy: Huge pages bound to the local NUMA node, physically allocated on first write.
+using numa_local_huge_pages = PagePolicy<true, true, false>;
+
+namespace internal {
+/// @brief Returns the size of a page.
+inline size_t page_size() {
+#ifdef __linux__
+    static size_t const size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+/// @brief Allocates \p num_bytes bytes of whole pages according to \p Policy.
+template <typename Policy>
+void* allocate_pages(size_t num_bytes) {
+#ifdef __linux__
+    void* ptr = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    // Both hints are best effort, e.g., transparent huge pages may be disabled or mbind may not be permitted.
+    if constexpr (Policy::huge_pages) {
+        madvise(ptr, num_bytes, MADV_HUGEPAGE);
+    }
+    if constexpr (Policy::bind_to_local_numa_node) {
+        unsigned cpu;
+        unsigned node;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+            constexpr size_t           bits_per_word = std::numeric_limits<unsigned long>::digits;
+            std::vector<unsigned long> node_mask(node / bits_per_word + 1, 0);
+            node_mask[node / bits_per_word] = 1ul << (node % bits_per_word);
+            // the kernel expects the number of bits in the mask plus one
+            syscall(
+                SYS_mbind,
+                ptr,
+                num_bytes,
+                MPOL_PREFERRED,
+                node_mask.data(),
+                node_mask.size() * bits_per_word + 1,
+                0
+            );
+        }
+    }
+    if constexpr (Policy::touch_on_allocation) {
+        for (size_t offset = 0; offset < num_bytes; offset += page_size()) {
+            static_cast<char volatile*>(ptr)[offset] = 0;
+        }
+    }
+    return ptr;
+#else
+    return ::operator new(num_bytes);
+#endif
+}
+
+/// @brief Returns the pages at \p ptr of \p num_bytes bytes obtained by \ref allocate_pages().
+inline void deallocate_pages(void* ptr, size_t num_bytes) noexcept {
+#ifdef __linux__
+    munmap(ptr, num_bytes);
+#else
+    (void)num_bytes;
+    ::operator delete(ptr);
+#endif
+}
+} // namespace internal
+
+/// @brief STL-compatible allocator obtaining memory directly from the operating system as configured by \p Policy.
+///
+/// Each allocation of at least \ref PagePolicy::min_bytes bytes is backed by its own pages, so this allocator is
+/// intended for large buffers which are reused (e.g., using `Communicator<numa_local_vector>` or
+/// `recv_buf(alloc_new<numa_local_vector<T>>)`). Combine it with \ref DefaultInitAllocator to avoid touching the pages
+/// when resizing a container.
+///
+/// @tparam T The type to allocate.
+/// @tparam Policy The \ref PagePolicy.
+template <typename T, typename Policy = numa_local_huge_pages>
+class PageAllocator {
+public:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "PageAllocator does not support over-aligned types.");
+
+    /// @brief The value type.
+    using value_type = T;
+
+    /// @brief The allocator is stateless, so memory can be moved along with the allocator.
+    using propagate_on_container_move_assignment = std::true_type;
+
+    /// @brief Memory allocated by one allocator instance can always be deallocated by another.
+    using is_always_equal = std::true_type;
+
+    PageAllocator() noexcept = default;
+
+    /// @brief Copy constructor for allocators with different value type.
+    template <typename U>
+    PageAllocator(PageAllocator<U, Policy> const&) noexcept {}
+
+    /// @brief Allocates storage for \p n objects of type \c T.
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        size_t const num_bytes = n * sizeof(T);
+        if (num_bytes < Policy::min_bytes) {
+            return static_cast<T*>(::operator new(num_bytes));
+        }
+        return static_cast<T*>(internal::allocate_pages<Policy>(num_bytes));
+    }
+
+    /// @brief Deallocates the storage referenced by \p p, which must have been obtained by \ref allocate() with the
+    /// same \p n.
+    void deallocate(T* p, size_t n) noexcept {
+        size_t const num_bytes = n * sizeof(T);
+        if (num_bytes < Policy::min_bytes) {
+            ::operator delete(p);
+            return;
+        }
+        internal::deallocate_pages(p, num_bytes);
+    }
+};
+
+/// @brief All page allocators with the same policy are equal.
+template <typename T, typename U, typename Policy>
+bool operator==(PageAllocator<T, Policy> const&, PageAllocator<U, Policy> const&) noexcept {
+    return true;
+}
+
+/// @brief All page allocators with the same policy are equal.
+template <typename T, typename U, typename Policy>
+bool operator!=(PageAllocator<T, Policy> const&, PageAllocator<U, Policy> const&) noexcept {
+    return false;
+}
+
+/// @brief A \c std::vector backed by huge pages bound to the NUMA node of the allocating thread (see \ref
+/// numa_local_huge_pages). Can be used as default container type of a communicator, e.g.,
+/// `Communicator<numa_local_vector>`.
+template <typename T>
+class numa_local_vector : public std::vector<T, PageAllocator<T>> {
+public:
+    using std::vector<T, PageAllocator<T>>::vector;
+};
+
+} // namespace kamping
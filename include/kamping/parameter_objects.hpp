@@ -481,6 +481,50 @@ struct SendModeParameter : private CopyMoveEnabler<> {
     using send_mode                               = SendModeTag;              ///< The send mode.
 };
 
+/// @brief Tag for the \c MPI_Alltoallv provided by the MPI implementation.
+struct builtin_alltoallv_t {
+    static constexpr char const* mpi_function_name = "MPI_Alltoallv"; ///< Name used for error reporting.
+};
+/// @brief Tag for the pairwise exchange alltoallv algorithm.
+struct pairwise_alltoallv_t {
+    static constexpr char const* mpi_function_name = "MPI_Sendrecv"; ///< Name used for error reporting.
+};
+/// @brief Tag for the throttled linear alltoallv algorithm. Calling it returns a tag with the given window size.
+struct throttled_linear_alltoallv_t {
+    static constexpr char const* mpi_function_name = "MPI_Waitall"; ///< Name used for error reporting.
+
+    size_t window = 32; ///< The maximum number of receives (and sends) in flight at the same time.
+
+    /// @brief Returns the tag for the throttled linear algorithm with at most \p window_size requests in flight.
+    constexpr throttled_linear_alltoallv_t operator()(size_t window_size) const {
+        return throttled_linear_alltoallv_t{window_size};
+    }
+};
+/// @brief Tag for Bruck's alltoallv algorithm.
+struct bruck_alltoallv_t {
+    static constexpr char const* mpi_function_name = "MPI_Recv"; ///< Name used for error reporting.
+};
+/// @brief List of all available alltoallv algorithms.
+using alltoallv_algorithm_list =
+    type_list<builtin_alltoallv_t, pairwise_alltoallv_t, throttled_linear_alltoallv_t, bruck_alltoallv_t>;
+
+/// @brief Parameter object for alltoallv_algorithm encapsulating the algorithm tag.
+/// @tparam AlgorithmTag The algorithm.
+template <typename AlgorithmTag>
+struct AlltoallvAlgorithmParameter : private CopyMoveEnabler<> {
+    static_assert(alltoallv_algorithm_list::contains<AlgorithmTag>, "Unsupported alltoallv algorithm.");
+    static constexpr ParameterType parameter_type = ParameterType::algorithm; ///< The parameter type.
+    using algorithm_type                          = AlgorithmTag;             ///< The algorithm.
+
+    /// @brief Constructs the parameter object using the default configuration of the algorithm.
+    AlltoallvAlgorithmParameter() = default;
+
+    /// @brief Constructs the parameter object for \p algorithm_.
+    explicit AlltoallvAlgorithmParameter(AlgorithmTag algorithm_) : algorithm(algorithm_) {}
+
+    AlgorithmTag algorithm{}; ///< The algorithm (including its configuration).
+};
+
 /// @brief returns a pointer to the \c MPI_Status encapsulated by the provided status parameter object.
 /// @tparam StatusParam The type of the status parameter object.
 /// @param param The status parameter object.
@@ -566,6 +610,24 @@ static constexpr internal::synchronous_mode_t synchronous{}; ///< global constan
 static constexpr internal::ready_mode_t       ready{};       ///< global constant for ready send mode
 } // namespace send_modes
 
+/// @brief Algorithms which can be used by \ref Communicator::alltoallv() (see \ref kamping::alltoallv_algorithm()).
+namespace alltoallv_algorithms {
+/// @brief Use \c MPI_Alltoallv as provided by the MPI implementation (default).
+static constexpr internal::builtin_alltoallv_t builtin{};
+/// @brief Exchange the blocks in `p` steps. In step `k`, each rank sends to one rank and receives from another one
+/// using \c MPI_Sendrecv, such that each rank has exactly one incoming and one outgoing message at a time. If `p` is a
+/// power of two, rank `i` exchanges with rank `i XOR k` (1-factorization), otherwise it sends to `i + k` and receives
+/// from `i - k`.
+static constexpr internal::pairwise_alltoallv_t pairwise{};
+/// @brief Post non-blocking receives and sends in batches of a limited size (32 by default), and wait for each batch
+/// to complete before starting the next one. Use `throttled_linear(window)` to change the batch size.
+static constexpr internal::throttled_linear_alltoallv_t throttled_linear{};
+/// @brief Bruck's algorithm, which exchanges the data in `ceil(log2(p))` rounds by forwarding blocks via intermediate
+/// ranks. Each element is sent up to `ceil(log2(p))` times, so this is only beneficial for small blocks, where latency
+/// dominates.
+static constexpr internal::bruck_alltoallv_t bruck{};
+} // namespace alltoallv_algorithms
+
 /// @brief Tag for parameters that can be omitted on some PEs (e.g., root PE, or non-root PEs).
 template <typename T = void>
 constexpr internal::ignore_t<T> ignore{};
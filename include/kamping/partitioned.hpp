@@ -0,0 +1,433 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Partitioned point-to-point communication, in which the parts of a message are contributed independently.
+///
+/// MPI-4 added partitioned communication (\c MPI_Psend_init, \c MPI_Precv_init), where a send buffer is split into
+/// partitions which are transferred as soon as they are marked ready, e.g., by the thread producing them. For MPI
+/// libraries not providing it, partitioned communication is emulated using one persistent point-to-point request per
+/// partition.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/error_handling.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/mpi_datatype.hpp"
+#include "kamping/named_parameter_check.hpp"
+#include "kamping/named_parameter_selection.hpp"
+#include "kamping/named_parameters.hpp"
+#include "kamping/parameter_objects.hpp"
+#include "kamping/span.hpp"
+
+namespace kamping {
+namespace internal {
+
+/// @brief Returns the tag passed via \ref kamping::tag(), or the default tag of \p comm if it is omitted.
+template <typename Comm, typename... Args>
+int partitioned_tag(Comm const& comm, Args&... args) {
+    using default_tag_buf_type = decltype(kamping::tag(comm.default_tag()));
+    auto&& tag_param           = select_parameter_type_or_default<ParameterType::tag, default_tag_buf_type>(
+        std::tuple(comm.default_tag()),
+        args...
+    );
+    static_assert(
+        std::remove_reference_t<decltype(tag_param)>::tag_type == TagType::value,
+        "Please provide a tag for the message."
+    );
+    return tag_param.tag();
+}
+
+/// @brief Common part of \ref PartitionedSend and \ref PartitionedRecv: the partitioned buffer and the persistent
+/// request(s) of the operation.
+template <typename T>
+class PartitionedOperation {
+public:
+    /// @brief The type of the elements.
+    using value_type = T;
+
+    /// @brief Copying is not allowed.
+    PartitionedOperation(PartitionedOperation const&) = delete;
+    /// @brief Copying is not allowed.
+    PartitionedOperation& operator=(PartitionedOperation const&) = delete;
+
+    /// @brief Move constructor.
+    PartitionedOperation(PartitionedOperation&&) noexcept = default;
+
+    /// @brief Move assignment.
+    PartitionedOperation& operator=(PartitionedOperation&& other) noexcept {
+        std::swap(_data, other._data);
+        std::swap(_num_partitions, other._num_partitions);
+        std::swap(_requests, other._requests);
+        return *this;
+    }
+
+    /// @brief Frees the persistent request(s). The operation must not be active.
+    ~PartitionedOperation() {
+        for (auto& request: _requests) {
+            if (request != MPI_REQUEST_NULL) {
+                MPI_Request_free(&request);
+            }
+        }
+    }
+
+    /// @brief Returns the number of partitions.
+    size_t num_partitions() const {
+        return _num_partitions;
+    }
+
+    /// @brief Returns the number of elements in each partition.
+    size_t partition_size() const {
+        return _num_partitions == 0 ? 0 : _data.size() / _num_partitions;
+    }
+
+    /// @brief Returns the elements of partition \p partition.
+    Span<T> partition(size_t partition) const {
+        KAMPING_ASSERT(partition < _num_partitions, "Partition index out of range.", assert::light);
+        return Span<T>(_data.data() + partition * partition_size(), partition_size());
+    }
+
+    /// @brief Returns the whole (partitioned) buffer.
+    Span<T> data() const {
+        return _data;
+    }
+
+    /// @brief Tests whether the current round of the operation has completed. The operation can be started again
+    /// afterwards.
+    bool test() {
+        int                  succeeded = false;
+        [[maybe_unused]] int err =
+            MPI_Testall(asserting_cast<int>(_requests.size()), _requests.data(), &succeeded, MPI_STATUSES_IGNORE);
+        THROW_IF_MPI_ERROR(err, MPI_Testall);
+        return static_cast<bool>(succeeded);
+    }
+
+    /// @brief Waits for the current round of the operation to complete. The operation can be started again
+    /// afterwards.
+    void wait() {
+        [[maybe_unused]] int err =
+            MPI_Waitall(asserting_cast<int>(_requests.size()), _requests.data(), MPI_STATUSES_IGNORE);
+        THROW_IF_MPI_ERROR(err, MPI_Waitall);
+    }
+
+protected:
+    /// @brief Splits \p data into \p num_partitions partitions of equal size.
+    PartitionedOperation(Span<T> data, size_t num_partitions) : _data(data), _num_partitions(num_partitions) {
+        KAMPING_ASSERT(num_partitions > 0, "There has to be at least one partition.", assert::light);
+        KAMPING_ASSERT(
+            data.size() % num_partitions == 0,
+            "The buffer size has to be a multiple of the number of partitions.",
+            assert::light
+        );
+    }
+
+    Span<T>                  _data;           ///< The partitioned buffer.
+    size_t                   _num_partitions; ///< The number of partitions.
+    std::vector<MPI_Request> _requests; ///< The partitioned request (MPI-4) or one persistent request per partition.
+};
+
+} // namespace internal
+
+/// @brief A persistent partitioned send operation, using \c MPI_Psend_init if available.
+///
+/// Each round of the operation is started by \ref start(). Afterwards, each partition is marked as ready by \ref
+/// pready() as soon as it has been filled (e.g., by the thread producing it), which allows its transfer to overlap
+/// with the production of the other partitions. The round is completed by \ref wait() or \ref test() after all
+/// partitions have been marked as ready. With \ref ThreadLevel::multiple, \ref pready() may be called concurrently by
+/// multiple threads.
+///
+/// Without MPI-4, each partition is sent by its own persistent send request (\c MPI_Send_init). To keep the messages
+/// in the order in which the receiver posts them, a partition is only sent after all previous partitions have been
+/// marked as ready. In this case, concurrently active partitioned operations between the same pair of ranks have to
+/// use different tags.
+///
+/// Example:
+/// @code
+/// auto send = PartitionedSend<double>::init(comm, Span<double>(data), num_threads, destination(destination_rank));
+/// send.start();
+/// #pragma omp parallel
+/// {
+///     produce(send.partition(omp_get_thread_num()));
+///     send.pready(omp_get_thread_num());
+/// }
+/// send.wait();
+/// @endcode
+///
+/// @tparam T The type of the elements.
+template <typename T>
+class PartitionedSend : public internal::PartitionedOperation<T> {
+public:
+    /// @brief Initializes a partitioned send of \p data, split into \p num_partitions partitions of equal size. This
+    /// is a local operation.
+    ///
+    /// The following parameters are required:
+    /// - \ref kamping::destination() the receiving rank, which has to use the same partitioning.
+    ///
+    /// The following parameters are optional:
+    /// - \ref kamping::tag() the tag of the message. Defaults to the communicator's default tag.
+    ///
+    /// @param comm The communicator.
+    /// @param data The buffer to send, which has to outlive the operation.
+    /// @param num_partitions The number of partitions. Has to divide the size of \p data.
+    /// @param args All required and any number of the optional parameters described above.
+    template <typename Comm, typename... Args>
+    static PartitionedSend init(Comm const& comm, Span<T> data, size_t num_partitions, Args... args) {
+        KAMPING_CHECK_PARAMETERS(Args, KAMPING_REQUIRED_PARAMETERS(destination), KAMPING_OPTIONAL_PARAMETERS(tag));
+        auto const& destination = internal::select_parameter_type<internal::ParameterType::destination>(args...);
+        static_assert(
+            std::remove_reference_t<decltype(destination)>::rank_type == internal::RankType::value,
+            "Please provide an explicit destination."
+        );
+        int const dest = destination.rank_signed();
+        int const tag  = internal::partitioned_tag(comm, args...);
+
+        PartitionedSend send(data, num_partitions);
+#if MPI_VERSION >= 4
+        send._requests.resize(1, MPI_REQUEST_NULL);
+        int const err = MPI_Psend_init(
+            data.data(),                                      // buf
+            asserting_cast<int>(num_partitions),              // partitions
+            asserting_cast<MPI_Count>(send.partition_size()), // count
+            mpi_datatype<T>(),                                // datatype
+            dest,                                             // dest
+            tag,                                              // tag
+            comm.mpi_communicator(),                          // comm
+            MPI_INFO_NULL,                                    // info
+            &send._requests.front()                           // request
+        );
+        THROW_IF_MPI_ERROR(err, MPI_Psend_init);
+#else
+        send._requests.resize(num_partitions, MPI_REQUEST_NULL);
+        // all partitions are marked as ready until the first round is started
+        send._ready = std::make_unique<ReadyState>();
+        send._ready->is_ready.assign(num_partitions, true);
+        send._ready->num_started = num_partitions;
+        for (size_t partition = 0; partition < num_partitions; ++partition) {
+            int const err = MPI_Send_init(
+                send.partition(partition).data(),
+                asserting_cast<int>(send.partition_size()),
+                mpi_datatype<T>(),
+                dest,
+                tag,
+                comm.mpi_communicator(),
+                &send._requests[partition]
+            );
+            THROW_IF_MPI_ERROR(err, MPI_Send_init);
+        }
+#endif
+        return send;
+    }
+
+    /// @brief Starts a new round of the operation. No partition is transferred before it is marked as ready.
+    void start() {
+#if MPI_VERSION >= 4
+        int const err = MPI_Start(&this->_requests.front());
+        THROW_IF_MPI_ERROR(err, MPI_Start);
+#else
+        std::lock_guard<std::mutex> lock(_ready->mutex);
+        _ready->is_ready.assign(this->num_partitions(), false);
+        _ready->num_started = 0;
+#endif
+    }
+
+    /// @brief Marks partition \p partition as ready, i.e., it will not be modified before the round is complete.
+    void pready(size_t partition) {
+        KAMPING_ASSERT(partition < this->num_partitions(), "Partition index out of range.", assert::light);
+#if MPI_VERSION >= 4
+        int const err = MPI_Pready(asserting_cast<int>(partition), this->_requests.front());
+        THROW_IF_MPI_ERROR(err, MPI_Pready);
+#else
+        std::lock_guard<std::mutex> lock(_ready->mutex);
+        KAMPING_ASSERT(
+            !_ready->is_ready[partition],
+            "Partition is already marked as ready or the operation has not been started.",
+            assert::light
+        );
+        _ready->is_ready[partition] = true;
+        // start the longest prefix of ready partitions, such that the messages are sent in order
+        while (_ready->num_started < this->num_partitions() && _ready->is_ready[_ready->num_started]) {
+            int const err = MPI_Start(&this->_requests[_ready->num_started]);
+            THROW_IF_MPI_ERROR(err, MPI_Start);
+            ++_ready->num_started;
+        }
+#endif
+    }
+
+    /// @brief Marks the partitions in `[begin, end)` as ready.
+    void pready_range(size_t begin, size_t end) {
+        KAMPING_ASSERT(begin <= end && end <= this->num_partitions(), "Partition range out of range.", assert::light);
+#if MPI_VERSION >= 4
+        if (begin < end) {
+            int const err = MPI_Pready_range(
+                asserting_cast<int>(begin),
+                asserting_cast<int>(end - 1),
+                this->_requests.front()
+            );
+            THROW_IF_MPI_ERROR(err, MPI_Pready_range);
+        }
+#else
+        for (size_t partition = begin; partition < end; ++partition) {
+            pready(partition);
+        }
+#endif
+    }
+
+    /// @brief Waits for the current round to complete. All partitions have to be marked as ready before.
+    void wait() {
+        assert_all_ready();
+        internal::PartitionedOperation<T>::wait();
+    }
+
+    /// @brief Tests whether the current round has completed. All partitions have to be marked as ready before.
+    bool test() {
+        assert_all_ready();
+        return internal::PartitionedOperation<T>::test();
+    }
+
+private:
+    /// @brief Creates the operation without initializing the request(s).
+    PartitionedSend(Span<T> data, size_t num_partitions) : internal::PartitionedOperation<T>(data, num_partitions) {}
+
+    /// @brief Checks that all partitions have been marked as ready. Only possible when emulating partitioned
+    /// communication, as MPI-4 completes the operation only after all partitions are ready.
+    void assert_all_ready() const {
+#if MPI_VERSION < 4
+        KAMPING_ASSERT(
+            _ready->num_started == this->num_partitions(),
+            "All partitions have to be marked as ready before completing the operation.",
+            assert::light
+        );
+#endif
+    }
+
+#if MPI_VERSION < 4
+    /// @brief Tracks which partitions of the current round have been marked as ready.
+    struct ReadyState {
+        std::mutex        mutex;           ///< Protects the state against concurrent calls to \ref pready().
+        std::vector<bool> is_ready;        ///< Whether each partition has been marked as ready.
+        size_t            num_started = 0; ///< The number of (leading) partitions whose transfer has been started.
+    };
+
+    std::unique_ptr<ReadyState> _ready; ///< The state of the current round.
+#endif
+};
+
+/// @brief A persistent partitioned receive operation, using \c MPI_Precv_init if available.
+///
+/// Each round of the operation is started by \ref start(). Afterwards, \ref parrived() tests whether a single
+/// partition has arrived, which allows consuming partitions before the whole message has been received. The round is
+/// completed by \ref wait() or \ref test(). With \ref ThreadLevel::multiple, \ref parrived() may be called
+/// concurrently by multiple threads.
+///
+/// Without MPI-4, each partition is received by its own persistent receive request (\c MPI_Recv_init).
+///
+/// @tparam T The type of the elements.
+template <typename T>
+class PartitionedRecv : public internal::PartitionedOperation<T> {
+public:
+    /// @brief Initializes a partitioned receive into \p data, split into \p num_partitions partitions of equal size.
+    /// This is a local operation.
+    ///
+    /// The following parameters are required:
+    /// - \ref kamping::source() the sending rank, which has to use the same partitioning. Receiving from an arbitrary
+    /// source is not supported.
+    ///
+    /// The following parameters are optional:
+    /// - \ref kamping::tag() the tag of the message. Defaults to the communicator's default tag. Receiving messages
+    /// with an arbitrary tag is not supported.
+    ///
+    /// @param comm The communicator.
+    /// @param data The receive buffer, which has to outlive the operation.
+    /// @param num_partitions The number of partitions. Has to divide the size of \p data.
+    /// @param args All required and any number of the optional parameters described above.
+    template <typename Comm, typename... Args>
+    static PartitionedRecv init(Comm const& comm, Span<T> data, size_t num_partitions, Args... args) {
+        KAMPING_CHECK_PARAMETERS(Args, KAMPING_REQUIRED_PARAMETERS(source), KAMPING_OPTIONAL_PARAMETERS(tag));
+        auto const& source = internal::select_parameter_type<internal::ParameterType::source>(args...);
+        static_assert(
+            std::remove_reference_t<decltype(source)>::rank_type == internal::RankType::value,
+            "Please provide an explicit source."
+        );
+        int const src = source.rank_signed();
+        int const tag = internal::partitioned_tag(comm, args...);
+
+        PartitionedRecv recv(data, num_partitions);
+#if MPI_VERSION >= 4
+        recv._requests.resize(1, MPI_REQUEST_NULL);
+        int const err = MPI_Precv_init(
+            data.data(),                                      // buf
+            asserting_cast<int>(num_partitions),              // partitions
+            asserting_cast<MPI_Count>(recv.partition_size()), // count
+            mpi_datatype<T>(),                                // datatype
+            src,                                              // source
+            tag,                                              // tag
+            comm.mpi_communicator(),                          // comm
+            MPI_INFO_NULL,                                    // info
+            &recv._requests.front()                           // request
+        );
+        THROW_IF_MPI_ERROR(err, MPI_Precv_init);
+#else
+        recv._requests.resize(num_partitions, MPI_REQUEST_NULL);
+        for (size_t partition = 0; partition < num_partitions; ++partition) {
+            int const err = MPI_Recv_init(
+                recv.partition(partition).data(),
+                asserting_cast<int>(recv.partition_size()),
+                mpi_datatype<T>(),
+                src,
+                tag,
+                comm.mpi_communicator(),
+                &recv._requests[partition]
+            );
+            THROW_IF_MPI_ERROR(err, MPI_Recv_init);
+        }
+#endif
+        return recv;
+    }
+
+    /// @brief Starts a new round of the operation.
+    void start() {
+        int const err = MPI_Startall(asserting_cast<int>(this->_requests.size()), this->_requests.data());
+        THROW_IF_MPI_ERROR(err, MPI_Startall);
+    }
+
+    /// @brief Tests whether partition \p partition of the current round has arrived. Does not complete the round.
+    bool parrived(size_t partition) {
+        KAMPING_ASSERT(partition < this->num_partitions(), "Partition index out of range.", assert::light);
+        int flag = false;
+#if MPI_VERSION >= 4
+        int const err = MPI_Parrived(this->_requests.front(), asserting_cast<int>(partition), &flag);
+        THROW_IF_MPI_ERROR(err, MPI_Parrived);
+#else
+        int const err = MPI_Request_get_status(this->_requests[partition], &flag, MPI_STATUS_IGNORE);
+        THROW_IF_MPI_ERROR(err, MPI_Request_get_status);
+#endif
+        return static_cast<bool>(flag);
+    }
+
+private:
+    /// @brief Creates the operation without initializing the request(s).
+    PartitionedRecv(Span<T> data, size_t num_partitions) : internal::PartitionedOperation<T>(data, num_partitions) {}
+};
+
+} // namespace kamping
@@ -0,0 +1,301 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/collectives/allreduce.hpp"
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/named_parameter_selection.hpp"
+#include "kamping/named_parameter_types.hpp"
+#include "kamping/plugin/plugin_helpers.hpp"
+#include "kamping/span.hpp"
+#include "kamping/utils/ragged_view.hpp"
+
+/// @file
+/// @brief Plugin providing an alltoallv exchange in rounds with a bounded receive buffer.
+
+#pragma once
+
+namespace kamping::plugin {
+
+namespace chunked_alltoall {
+
+/// @brief Parameter types used for the ChunkedAlltoall plugin.
+enum class ParameterType {
+    memory_budget, ///< Tag used to represent the maximum size of the receive buffer used in each round.
+    on_chunk       ///< Tag used to represent the callback invoked for each received \ref chunked_alltoall::Chunk.
+};
+
+/// @brief The data exchanged in a single round of \ref ChunkedAlltoall::alltoallv_chunked().
+///
+/// The views are only valid during the invocation of the callback passed via \ref chunked_alltoall::on_chunk(), as
+/// the receive buffer is reused in the next round.
+/// @tparam T Type of the exchanged elements.
+template <typename T>
+class Chunk {
+public:
+    /// @brief Constructs a chunk.
+    Chunk(RaggedView<T const> received, RaggedView<T const> sent, size_t round)
+        : _received(received),
+          _sent(sent),
+          _round(round) {}
+
+    /// @brief The elements received in this round. Block \c i contains the elements received from rank \c i, which
+    /// directly follow the elements received from rank \c i in the previous rounds.
+    RaggedView<T const> const& received() const {
+        return _received;
+    }
+
+    /// @brief The regions of the send buffer which have been sent in this round. Block \c i contains the elements sent
+    /// to rank \c i. These regions are not accessed again and can therefore be released by the caller.
+    RaggedView<T const> const& sent() const {
+        return _sent;
+    }
+
+    /// @brief The index of this round, starting at zero.
+    size_t round() const {
+        return _round;
+    }
+
+private:
+    RaggedView<T const> _received; ///< The elements received in this round.
+    RaggedView<T const> _sent;     ///< The regions of the send buffer sent in this round.
+    size_t              _round;    ///< The index of this round.
+};
+
+/// @brief The maximum number of bytes of the receive buffer used in each round of \ref
+/// ChunkedAlltoall::alltoallv_chunked().
+/// @param num_bytes The memory budget in bytes. At least one element is exchanged per round, even if the budget is
+/// smaller than a single element.
+/// @return The corresponding parameter object.
+inline auto memory_budget(size_t num_bytes) {
+    return internal::make_data_buffer<
+        ParameterType,
+        ParameterType::memory_budget,
+        internal::BufferModifiability::constant,
+        internal::BufferType::in_buffer,
+        BufferResizePolicy::no_resize,
+        size_t>(std::move(num_bytes));
+}
+
+/// @brief Generates a wrapper for a callback invoked for each round of \ref ChunkedAlltoall::alltoallv_chunked(). Its
+/// call operator has to accept a \ref chunked_alltoall::Chunk as sole parameter.
+template <typename Callback>
+auto on_chunk(Callback&& cb) {
+    using namespace kamping::internal;
+    constexpr BufferOwnership ownership =
+        std::is_rvalue_reference_v<Callback&&> ? BufferOwnership::owning : BufferOwnership::referencing;
+
+    constexpr BufferModifiability modifiability = std::is_const_v<std::remove_reference_t<Callback>>
+                                                      ? BufferModifiability::constant
+                                                      : BufferModifiability::modifiable;
+
+    return GenericDataBuffer<
+        std::remove_reference_t<Callback>,
+        ParameterType,
+        ParameterType::on_chunk,
+        modifiability,
+        ownership,
+        BufferType::in_buffer>(std::forward<Callback>(cb));
+}
+
+namespace internal {
+/// @brief Distributes \p budget elements among the sources with remaining elements \p remaining as evenly as possible
+/// (water-filling), i.e., every source gets the same share unless it has fewer remaining elements, in which case the
+/// surplus is distributed among the other sources.
+/// @param remaining The number of elements still to be received from each source.
+/// @param budget The number of elements which may be received in total.
+/// @param quota Output: The number of elements to receive from each source. Has to have the same size as \p remaining.
+inline void distribute_budget(std::vector<size_t> const& remaining, size_t budget, std::vector<size_t>& quota) {
+    std::vector<size_t> sources;
+    for (size_t source = 0; source < remaining.size(); ++source) {
+        quota[source] = 0;
+        if (remaining[source] > 0) {
+            sources.push_back(source);
+        }
+    }
+    std::sort(sources.begin(), sources.end(), [&](size_t lhs, size_t rhs) {
+        return remaining[lhs] < remaining[rhs];
+    });
+    size_t budget_left = budget;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        size_t const share  = budget_left / (sources.size() - i);
+        size_t const source = sources[i];
+        quota[source]       = std::min(remaining[source], share);
+        budget_left -= quota[source];
+    }
+    // hand out the rest of the budget lost to rounding, such that each round makes progress
+    for (size_t i = sources.size(); i > 0 && budget_left > 0; --i) {
+        size_t const source = sources[i - 1];
+        size_t const extra  = std::min(remaining[source] - quota[source], budget_left);
+        quota[source] += extra;
+        budget_left -= extra;
+    }
+}
+} // namespace internal
+
+} // namespace chunked_alltoall
+
+/// @brief Plugin providing an alltoallv exchange which is split into rounds such that the receive buffer never
+/// exceeds a given memory budget.
+/// @see \ref ChunkedAlltoall::alltoallv_chunked() for more information.
+template <typename Comm, template <typename...> typename DefaultContainerType>
+class ChunkedAlltoall : public plugin::PluginBase<Comm, DefaultContainerType, ChunkedAlltoall> {
+public:
+    template <typename... Args>
+    void alltoallv_chunked(Args... args) const;
+};
+
+/// @brief Alltoallv exchange in rounds with a bounded receive buffer.
+///
+/// A plain \c MPI_Alltoallv needs a receive buffer holding all received elements at once, which in addition to the
+/// send buffer may exceed the available memory when redistributing large data sets. This exchange instead proceeds in
+/// rounds: In each round, each rank receives at most as many elements as fit into the memory budget, distributed as
+/// evenly as possible among the sources which still have elements to send. After each round, the callback passed via
+/// \ref chunked_alltoall::on_chunk() is invoked with a \ref chunked_alltoall::Chunk containing the received elements
+/// as well as the regions of the send buffer which have been sent in this round. Afterwards, the receive buffer is
+/// reused for the next round.
+///
+/// Each round consists of an \c MPI_Alltoall to announce the number of elements each rank accepts from each source,
+/// an \c MPI_Alltoallv exchanging the data and an \c MPI_Allreduce to detect whether all data has been exchanged.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the data that is sent to each rank. The size of this buffer has to be at
+/// least the sum of the send_counts argument.
+///
+/// - \ref kamping::send_counts() containing the number of elements to send to each rank.
+///
+/// - \ref chunked_alltoall::on_chunk() containing a callback which is invoked with a \ref chunked_alltoall::Chunk
+/// after each round.
+///
+/// The following parameters are optional:
+/// - \ref kamping::send_displs() containing the offsets of the messages in send_buf. If omitted, this is calculated as
+/// the exclusive prefix-sum of `send_counts`.
+///
+/// - \ref chunked_alltoall::memory_budget() containing the maximum size of the receive buffer in bytes. Defaults to 64
+/// MiB.
+///
+/// @tparam Args Automatically deducted template parameters.
+/// @param args All required and any number of the optional parameters described above.
+template <typename Comm, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+void ChunkedAlltoall<Comm, DefaultContainerType>::alltoallv_chunked(Args... args) const {
+    auto& self = this->to_communicator();
+
+    // Get send_buf
+    auto const& send_buf =
+        kamping::internal::select_parameter_type<kamping::internal::ParameterType::send_buf>(args...)
+            .construct_buffer_or_rebind();
+    using send_value_type = std::remove_const_t<typename std::remove_reference_t<decltype(send_buf)>::value_type>;
+
+    // Get send_counts
+    auto const& send_counts =
+        kamping::internal::select_parameter_type<kamping::internal::ParameterType::send_counts>(args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    KAMPING_ASSERT(send_counts.size() >= self.size(), "Send counts buffer is not large enough.", assert::light);
+
+    // Get send_displs
+    using default_send_displs_type = decltype(kamping::send_displs_out(alloc_new<DefaultContainerType<int>>));
+    auto send_displs               = kamping::internal::
+        select_parameter_type_or_default<kamping::internal::ParameterType::send_displs, default_send_displs_type>(
+            std::tuple<>(),
+            args...
+        )
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    if constexpr (kamping::internal::has_to_be_computed<decltype(send_displs)>) {
+        send_displs.resize_if_requested([&]() { return self.size(); });
+        std::exclusive_scan(send_counts.data(), send_counts.data() + self.size(), send_displs.data(), 0);
+    }
+    KAMPING_ASSERT(send_displs.size() >= self.size(), "Send displs buffer is not large enough.", assert::light);
+
+    // Get memory budget
+    using memory_budget_param_type = std::
+        integral_constant<chunked_alltoall::ParameterType, chunked_alltoall::ParameterType::memory_budget>;
+    constexpr size_t default_memory_budget = size_t{64} << 20;
+    using default_memory_budget_type       = decltype(chunked_alltoall::memory_budget(default_memory_budget));
+    auto&& memory_budget_param =
+        kamping::internal::select_parameter_type_or_default<memory_budget_param_type, default_memory_budget_type>(
+            std::tuple(default_memory_budget),
+            args...
+        );
+    size_t const budget = std::max<size_t>(memory_budget_param.get_single_element() / sizeof(send_value_type), 1);
+
+    // Get callback
+    using on_chunk_param_type =
+        std::integral_constant<chunked_alltoall::ParameterType, chunked_alltoall::ParameterType::on_chunk>;
+    auto&& on_chunk_cb = kamping::internal::select_parameter_type<on_chunk_param_type>(args...);
+
+    // Number of elements still to be received from each source
+    DefaultContainerType<int> recv_counts =
+        self.alltoall(kamping::send_buf(Span<int const>(send_counts.data(), self.size())));
+    std::vector<size_t> remaining(self.size());
+    for (size_t source = 0; source < self.size(); ++source) {
+        remaining[source] = asserting_cast<size_t>(recv_counts[source]);
+    }
+
+    std::vector<size_t>                   quota(self.size());
+    DefaultContainerType<int>             round_recv_counts(self.size());
+    DefaultContainerType<int>             round_recv_displs(self.size());
+    DefaultContainerType<int>             round_send_counts(self.size());
+    DefaultContainerType<int>             round_send_displs(self.size());
+    std::vector<int>                      already_sent(self.size(), 0);
+    DefaultContainerType<send_value_type> recv_buf;
+    bool                                  done = false;
+    for (size_t round = 0; !done; ++round) {
+        // Each rank decides how many elements it accepts from each source and announces this to the sources.
+        chunked_alltoall::internal::distribute_budget(remaining, budget, quota);
+        for (size_t source = 0; source < self.size(); ++source) {
+            round_recv_counts[source] = asserting_cast<int>(quota[source]);
+            remaining[source] -= quota[source];
+        }
+        std::exclusive_scan(round_recv_counts.begin(), round_recv_counts.end(), round_recv_displs.begin(), 0);
+        self.alltoall(kamping::send_buf(round_recv_counts), kamping::recv_buf(round_send_counts));
+        for (size_t dest = 0; dest < self.size(); ++dest) {
+            round_send_displs[dest] = send_displs.data()[dest] + already_sent[dest];
+            already_sent[dest] += round_send_counts[dest];
+        }
+
+        self.alltoallv(
+            kamping::send_buf(Span<send_value_type const>(send_buf.data(), send_buf.size())),
+            kamping::send_counts(round_send_counts),
+            kamping::send_displs(round_send_displs),
+            kamping::recv_counts(round_recv_counts),
+            kamping::recv_displs(round_recv_displs),
+            kamping::recv_buf<resize_to_fit>(recv_buf)
+        );
+
+        chunked_alltoall::Chunk<send_value_type> const chunk(
+            RaggedView<send_value_type const>(recv_buf, round_recv_counts, round_recv_displs),
+            RaggedView<send_value_type const>(
+                Span<send_value_type const>(send_buf.data(), send_buf.size()),
+                round_send_counts,
+                round_send_displs
+            ),
+            round
+        );
+        on_chunk_cb.underlying()(chunk);
+
+        bool const locally_done =
+            std::all_of(remaining.begin(), remaining.end(), [](size_t count) { return count == 0; });
+        done = self.allreduce_single(kamping::send_buf(locally_done), op(ops::logical_and<>{}));
+    }
+}
+
+} // namespace kamping::plugin
@@ -72,6 +72,25 @@ struct PredicateDispatchAlltoall {
     }
 };
 
+/// @brief Predicate to check whether an argument provided to alltoallv_dispatch shall be discarded in the internal
+/// call to the grid alltoallv.
+struct PredicateDispatchAlltoallGrid {
+    /// @brief Function to check whether an argument provided to \ref DispatchAlltoall::alltoallv_dispatch() shall be
+    /// discarded in the grid alltoallv call.
+    ///
+    /// @tparam Arg Argument to be checked.
+    /// @return \c True (i.e. discard) iff Arg is discarded by \ref PredicateDispatchAlltoall or Arg's parameter_type is
+    /// `algorithm`, which only applies to the builtin alltoallv.
+    template <typename Arg>
+    static constexpr bool discard() {
+        using algorithm_entry =
+            std::integral_constant<kamping::internal::ParameterType, kamping::internal::ParameterType::algorithm>;
+        using ptype_entry =
+            std::integral_constant<kamping::internal::parameter_type_t<Arg>, kamping::internal::parameter_type_v<Arg>>;
+        return PredicateDispatchAlltoall::discard<Arg>() || std::is_same_v<ptype_entry, algorithm_entry>;
+    }
+};
+
 } // namespace internal
 
 } // namespace dispatch_alltoall
@@ -98,6 +117,8 @@ public:
     /// - \ref dispatch_alltoall::comm_volume_threshold() containing the threshold for the maximum bottleneck
     /// communication volume in bytes indicating to switch from grid to builtin alltoall exchange. If ommitted, a
     /// threshold value of 2000 bytes is used.
+    /// - \ref kamping::alltoallv_algorithm() specifying the algorithm used if the builtin alltoallv exchange is
+    /// chosen (see \ref Communicator::alltoallv()). It is ignored by the grid exchange.
     /// - \ref kamping::recv_counts() containing the number of elements to receive from each rank.
     /// This parameter is mandatory if \ref kamping::recv_type() is given.
     ///
@@ -146,7 +167,10 @@ public:
                 initialize();
                 return _grid_communicator.value().alltoallv(kamping::send_counts(send_counts), std::move(argsargs)...);
             };
-            return std::apply(callable, filter_args());
+            return std::apply(
+                callable,
+                filter_args_into_tuple<dispatch_alltoall::internal::PredicateDispatchAlltoallGrid>(args...)
+            );
         }
 
         // otherwise resort to builtin MPI_Alltoallv.
@@ -0,0 +1,370 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/error_handling.hpp"
+#include "kamping/named_parameter_selection.hpp"
+#include "kamping/named_parameter_types.hpp"
+#include "kamping/p2p/irecv.hpp"
+#include "kamping/p2p/isend.hpp"
+#include "kamping/plugin/plugin_helpers.hpp"
+#include "kamping/request.hpp"
+#include "kamping/span.hpp"
+
+/// @file
+/// @brief File containing the StreamingAlltoall plugin.
+
+#pragma once
+
+namespace kamping::plugin {
+
+namespace streaming_alltoall {
+
+/// @brief Parameter types used for the StreamingAlltoall plugin.
+enum class ParameterType {
+    max_outstanding, ///< Tag used to represent the maximum number of receives and sends which are in flight at once.
+    on_block ///< Tag used to represent the callback invoked for each block received in \ref
+             ///< StreamingAlltoall::alltoallv_streaming().
+};
+
+/// @brief The maximum number of receive requests and the maximum number of send requests which are in flight at the
+/// same time in \ref StreamingAlltoall::alltoallv_streaming().
+/// @param num_requests The maximum number of outstanding requests (per direction). Has to be positive.
+/// @return The corresponding parameter object.
+inline auto max_outstanding(size_t num_requests) {
+    return internal::make_data_buffer<
+        ParameterType,
+        ParameterType::max_outstanding,
+        internal::BufferModifiability::constant,
+        internal::BufferType::in_buffer,
+        BufferResizePolicy::no_resize,
+        size_t>(std::move(num_requests));
+}
+
+/// @brief Generates a wrapper for a callback invoked for each block received in \ref
+/// StreamingAlltoall::alltoallv_streaming(). It gets called via `cb(source, block)`, where `source` is the rank (as
+/// `size_t`) the block has been received from and `block` is a \ref kamping::Span referring to the received elements.
+template <typename Callback>
+auto on_block(Callback&& cb) {
+    using namespace kamping::internal;
+    constexpr BufferOwnership ownership =
+        std::is_rvalue_reference_v<Callback&&> ? BufferOwnership::owning : BufferOwnership::referencing;
+
+    constexpr BufferModifiability modifiability = std::is_const_v<std::remove_reference_t<Callback>>
+                                                      ? BufferModifiability::constant
+                                                      : BufferModifiability::modifiable;
+
+    return GenericDataBuffer<
+        std::remove_reference_t<Callback>,
+        ParameterType,
+        ParameterType::on_block,
+        modifiability,
+        ownership,
+        BufferType::in_buffer>(std::forward<Callback>(cb));
+}
+
+namespace internal {
+
+/// @brief Frees the duplicate communicator cached by \ref streaming_comm() when the communicator it is attached to is
+/// freed.
+inline int free_streaming_comm(MPI_Comm, int, void* attribute_val, void*) {
+    auto* comm = static_cast<MPI_Comm*>(attribute_val);
+    int   err  = MPI_Comm_free(comm);
+    delete comm;
+    return err;
+}
+
+/// @brief Returns the attribute key under which \ref streaming_comm() caches the duplicate communicator.
+inline int streaming_comm_keyval() {
+    static int const keyval = [] {
+        int new_keyval = MPI_KEYVAL_INVALID;
+        MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &free_streaming_comm, &new_keyval, nullptr);
+        return new_keyval;
+    }();
+    return keyval;
+}
+
+/// @brief Retrieves the communicator used for the point-to-point messages of \ref
+/// StreamingAlltoall::alltoallv_streaming() on \p comm.
+///
+/// On first use, \p comm is duplicated using \c MPI_Comm_dup (which is collective, as is the exchange). The duplicate
+/// is cached as attribute of \p comm, so it is shared by all \ref Communicator objects wrapping \p comm, and freed
+/// together with \p comm. It is separate from the one used by the alltoallv algorithms, as the callback may start
+/// another exchange while blocks are still in flight.
+///
+/// @param comm The communicator the exchange is called on.
+/// @param exchange_comm Set to the duplicate of \p comm.
+/// @return The MPI error code.
+inline int streaming_comm(MPI_Comm comm, MPI_Comm& exchange_comm) {
+    int const keyval = streaming_comm_keyval();
+    void*     cached = nullptr;
+    int       found  = false;
+    int       err    = MPI_Comm_get_attr(comm, keyval, &cached, &found);
+    if (err != MPI_SUCCESS) {
+        return err;
+    }
+    if (!found) {
+        auto* duplicate = new MPI_Comm(MPI_COMM_NULL);
+        err             = MPI_Comm_dup(comm, duplicate);
+        if (err != MPI_SUCCESS) {
+            delete duplicate;
+            return err;
+        }
+        err = MPI_Comm_set_attr(comm, keyval, duplicate);
+        if (err != MPI_SUCCESS) {
+            MPI_Comm_free(duplicate);
+            delete duplicate;
+            return err;
+        }
+        cached = duplicate;
+    }
+    exchange_comm = *static_cast<MPI_Comm*>(cached);
+    return MPI_SUCCESS;
+}
+
+} // namespace internal
+
+} // namespace streaming_alltoall
+
+/// @brief Plugin providing an alltoallv exchange which hands each received block to a callback as soon as it has
+/// arrived.
+/// @see \ref StreamingAlltoall::alltoallv_streaming() for more information.
+template <typename Comm, template <typename...> typename DefaultContainerType>
+class StreamingAlltoall : public plugin::PluginBase<Comm, DefaultContainerType, StreamingAlltoall> {
+public:
+    template <typename... Args>
+    auto alltoallv_streaming(Args... args) const;
+};
+
+/// @brief Alltoallv exchange based on non-blocking point-to-point communication, which invokes a callback for each
+/// received block while the remaining blocks are still in flight.
+///
+/// With \c MPI_Alltoallv, no received data can be processed until the whole exchange has completed. This exchange
+/// instead posts an \c MPI_Irecv and an \c MPI_Isend for each pair of ranks with a non-empty block, and invokes the
+/// callback passed via \ref streaming_alltoall::on_block() as soon as the block from a source has arrived. This allows
+/// to overlap local post-processing (such as merging sorted sequences) with the communication of the remaining
+/// blocks. To avoid congestion, at most \ref streaming_alltoall::max_outstanding() receives and sends are in flight at
+/// the same time. Rank `i` sends to ranks `i + 1, i + 2, ...` and receives from ranks `i - 1, i - 2, ...` (modulo the
+/// size of the communicator) in this order, such that the posted receives match the first messages being sent. The
+/// blocks are exchanged on a duplicate of the communicator, such that they never match point-to-point messages of the
+/// application, including those sent from within the callback.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the data that is sent to each rank. The size of this buffer has to be at
+/// least the sum of the send_counts argument.
+///
+/// - \ref kamping::send_counts() containing the number of elements to send to each rank.
+///
+/// - \ref streaming_alltoall::on_block() containing a callback which is invoked via `cb(source, block)` for each
+/// non-empty block received. The block refers to the returned receive buffer.
+///
+/// The following parameters are optional:
+/// - \ref kamping::send_displs() containing the offsets of the messages in send_buf. If omitted, this is calculated as
+/// the exclusive prefix-sum of `send_counts`.
+///
+/// - \ref kamping::recv_counts() containing the number of elements to receive from each rank. If omitted, these are
+/// exchanged using an additional \c MPI_Alltoall.
+///
+/// - \ref streaming_alltoall::max_outstanding() containing the maximum number of receives (and sends) in flight.
+/// Defaults to 32.
+///
+/// - \ref kamping::tag() the tag used for the point-to-point messages on the duplicate communicator. Defaults to the
+/// communicator's default tag (\ref Communicator::default_tag()).
+///
+/// @tparam Args Automatically deducted template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return The receive buffer (of type `DefaultContainerType<T>`) containing the blocks received from all ranks in
+/// rank order, as returned by \ref Communicator::alltoallv().
+template <typename Comm, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+auto StreamingAlltoall<Comm, DefaultContainerType>::alltoallv_streaming(Args... args) const {
+    auto& self = this->to_communicator();
+
+    // Get send_buf
+    auto const& send_buf =
+        kamping::internal::select_parameter_type<kamping::internal::ParameterType::send_buf>(args...)
+            .construct_buffer_or_rebind();
+    using send_value_type = std::remove_const_t<typename std::remove_reference_t<decltype(send_buf)>::value_type>;
+
+    // Get send_counts
+    auto const& send_counts =
+        kamping::internal::select_parameter_type<kamping::internal::ParameterType::send_counts>(args...)
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    KAMPING_ASSERT(send_counts.size() >= self.size(), "Send counts buffer is not large enough.", assert::light);
+
+    // Get send_displs
+    using default_send_displs_type = decltype(kamping::send_displs_out(alloc_new<DefaultContainerType<int>>));
+    auto send_displs               = kamping::internal::
+        select_parameter_type_or_default<kamping::internal::ParameterType::send_displs, default_send_displs_type>(
+            std::tuple<>(),
+            args...
+        )
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    if constexpr (kamping::internal::has_to_be_computed<decltype(send_displs)>) {
+        send_displs.resize_if_requested([&]() { return self.size(); });
+        std::exclusive_scan(send_counts.data(), send_counts.data() + self.size(), send_displs.data(), 0);
+    }
+    KAMPING_ASSERT(send_displs.size() >= self.size(), "Send displs buffer is not large enough.", assert::light);
+
+    // Get recv_counts
+    using default_recv_counts_type = decltype(kamping::recv_counts_out(alloc_new<DefaultContainerType<int>>));
+    auto recv_counts               = kamping::internal::
+        select_parameter_type_or_default<kamping::internal::ParameterType::recv_counts, default_recv_counts_type>(
+            std::tuple<>(),
+            args...
+        )
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    if constexpr (kamping::internal::has_to_be_computed<decltype(recv_counts)>) {
+        recv_counts.resize_if_requested([&]() { return self.size(); });
+        self.alltoall(
+            kamping::send_buf(Span<int const>(send_counts.data(), self.size())),
+            kamping::recv_buf(Span<int>(recv_counts.data(), self.size()))
+        );
+    }
+    KAMPING_ASSERT(recv_counts.size() >= self.size(), "Recv counts buffer is not large enough.", assert::light);
+
+    // Get max_outstanding
+    using max_outstanding_param_type =
+        std::integral_constant<streaming_alltoall::ParameterType, streaming_alltoall::ParameterType::max_outstanding>;
+    constexpr size_t default_max_outstanding = 32;
+    using default_max_outstanding_type = decltype(streaming_alltoall::max_outstanding(default_max_outstanding));
+    auto&& max_outstanding_param =
+        kamping::internal::select_parameter_type_or_default<max_outstanding_param_type, default_max_outstanding_type>(
+            std::tuple(default_max_outstanding),
+            args...
+        );
+    size_t const window = max_outstanding_param.get_single_element();
+    KAMPING_ASSERT(window > 0, "The number of outstanding requests has to be positive.", assert::light);
+
+    // Get tag
+    using default_tag_buf_type = decltype(kamping::tag(self.default_tag()));
+    auto&& tag_param           = kamping::internal::select_parameter_type_or_default<
+        kamping::internal::ParameterType::tag,
+        default_tag_buf_type>(std::tuple(self.default_tag()), args...);
+
+    // Get callback
+    using on_block_param_type =
+        std::integral_constant<streaming_alltoall::ParameterType, streaming_alltoall::ParameterType::on_block>;
+    auto&& on_block_cb = kamping::internal::select_parameter_type<on_block_param_type>(args...);
+
+    MPI_Comm exchange_mpi_comm;
+    int      err = streaming_alltoall::internal::streaming_comm(self.mpi_communicator(), exchange_mpi_comm);
+    self.mpi_error_hook(err, "MPI_Comm_dup");
+    Communicator<DefaultContainerType> const exchange_comm(exchange_mpi_comm);
+
+    DefaultContainerType<int> recv_displs(self.size());
+    std::exclusive_scan(recv_counts.data(), recv_counts.data() + self.size(), recv_displs.begin(), 0);
+    int const recv_buf_size = std::accumulate(recv_counts.data(), recv_counts.data() + self.size(), 0);
+    DefaultContainerType<send_value_type> recv_buf(asserting_cast<size_t>(recv_buf_size));
+
+    // The first `window` slots hold receive requests, the remaining ones send requests. Each slot is reused as soon as
+    // its request has completed.
+    std::vector<MPI_Request> requests(2 * window, MPI_REQUEST_NULL);
+    std::vector<size_t>      slot_source(window);
+    size_t                   next_recv_step = 0;
+    size_t                   next_send_step = 0;
+    size_t                   num_pending    = 0;
+
+    // Posts the next non-empty receive (in the order i - 1, i - 2, ...) into the receive slot `slot`.
+    auto post_next_recv = [&](size_t slot) {
+        for (; next_recv_step < self.size(); ++next_recv_step) {
+            size_t const source = (self.rank() + self.size() - next_recv_step) % self.size();
+            int const    count  = recv_counts.data()[source];
+            if (count == 0) {
+                continue;
+            }
+            exchange_comm.irecv(
+                kamping::recv_buf<no_resize>(
+                    Span<send_value_type>(recv_buf.data() + recv_displs[source], asserting_cast<size_t>(count))
+                ),
+                kamping::recv_count(count),
+                kamping::source(source),
+                kamping::tag(tag_param.tag()),
+                kamping::request(PooledRequest<size_t>{slot, requests[slot]})
+            );
+            slot_source[slot] = source;
+            ++next_recv_step;
+            ++num_pending;
+            return;
+        }
+    };
+    // Posts the next non-empty send (in the order i + 1, i + 2, ...) into the send slot `slot`.
+    auto post_next_send = [&](size_t slot) {
+        for (; next_send_step < self.size(); ++next_send_step) {
+            size_t const dest  = (self.rank() + next_send_step) % self.size();
+            int const    count = send_counts.data()[dest];
+            if (count == 0) {
+                continue;
+            }
+            exchange_comm.isend(
+                kamping::send_buf(Span<send_value_type const>(
+                    send_buf.data() + send_displs.data()[dest],
+                    asserting_cast<size_t>(count)
+                )),
+                kamping::send_count(count),
+                kamping::destination(dest),
+                kamping::tag(tag_param.tag()),
+                kamping::request(PooledRequest<size_t>{slot, requests[slot]})
+            );
+            ++next_send_step;
+            return;
+        }
+    };
+
+    for (size_t slot = 0; slot < window; ++slot) {
+        post_next_recv(slot);
+        post_next_send(window + slot);
+    }
+    while (num_pending > 0) {
+        int index;
+        err = MPI_Waitany(asserting_cast<int>(requests.size()), requests.data(), &index, MPI_STATUS_IGNORE);
+        self.mpi_error_hook(err, "MPI_Waitany");
+        auto const slot = asserting_cast<size_t>(index);
+        if (slot < window) {
+            size_t const source = slot_source[slot];
+            --num_pending;
+            post_next_recv(slot);
+            on_block_cb.underlying()(
+                source,
+                Span<send_value_type>(
+                    recv_buf.data() + recv_displs[source],
+                    asserting_cast<size_t>(recv_counts.data()[source])
+                )
+            );
+        } else {
+            post_next_send(slot);
+        }
+    }
+    // All blocks have been received, but our own sends may still be in flight (or not posted yet).
+    while (next_send_step < self.size()) {
+        int index;
+        err = MPI_Waitany(asserting_cast<int>(window), requests.data() + window, &index, MPI_STATUS_IGNORE);
+        self.mpi_error_hook(err, "MPI_Waitany");
+        post_next_send(window + asserting_cast<size_t>(index));
+    }
+    err = MPI_Waitall(asserting_cast<int>(window), requests.data() + window, MPI_STATUSES_IGNORE);
+    self.mpi_error_hook(err, "MPI_Waitall");
+    return recv_buf;
+}
+
+} // namespace kamping::plugin
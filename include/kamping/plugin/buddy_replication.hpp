@@ -0,0 +1,429 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/allreduce.hpp"
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/distributed_input.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/named_parameters.hpp"
+#include "kamping/packing.hpp"
+#include "kamping/p2p/irecv.hpp"
+#include "kamping/p2p/isend.hpp"
+#include "kamping/plugin/plugin_helpers.hpp"
+#include "kamping/request_pool.hpp"
+
+/// @file
+/// @brief Plugin replicating the state of each rank in the memory of a buddy rank, from which it can be recovered
+/// after process failures.
+
+#pragma once
+
+namespace kamping::plugin {
+
+/// @brief Plugin which replicates registered per-rank state in the memory of a buddy rank, such that the state of
+/// failed ranks can be recovered by the survivors without reading a checkpoint from the file system.
+///
+/// Each rank registers the same containers in the same order using \ref add_replicated(). At checkpoint points, \ref
+/// replicate() takes a snapshot of the registered containers and sends it to the buddy rank using \c MPI_Isend, while
+/// the snapshots of the ranks this rank is the buddy of are received using \c MPI_Irecv. The snapshot is committed by
+/// \ref wait_for_replication() (or the next call to \ref replicate()), so the application can continue computing while
+/// the replication is in progress.
+///
+/// The buddy of rank \c i is rank \c i+1, and the buddy of the last rank is its left neighbor. After a failure, the
+/// communicator of the survivors (e.g., obtained using \c shrink() of the \ref UserLevelFailureMitigation plugin) is
+/// passed to \ref recover_from_buddies(). All survivors roll back to the last snapshot committed by all of them and
+/// adopt the snapshots of the failed ranks they are the buddy of. As each rank only adopts the snapshots of its
+/// neighbors, the concatenation of the elements of all ranks (ordered by rank) is the same as before the failure. The
+/// state is lost if a rank and its buddy fail at the same time.
+///
+/// A failure during a replication may leave some survivors with the new snapshot committed and others without.
+/// Therefore, each rank also keeps the snapshots of the previous replication, i.e., it stores two copies of its own
+/// state and of the state of the ranks it is the buddy of. Recovery requires that no rank has committed more than one
+/// replication ahead of another one, which holds if the ranks synchronize (e.g., by any collective operation) between
+/// two replications.
+///
+/// This plugin does not depend on a fault-tolerant MPI implementation and can be combined with the \ref
+/// UserLevelFailureMitigation plugin.
+template <typename Comm, template <typename...> typename DefaultContainerType>
+class BuddyReplication : public plugin::PluginBase<Comm, DefaultContainerType, BuddyReplication> {
+public:
+    /// @brief Frees pending replication requests.
+    ~BuddyReplication() {
+        abandon_replication();
+    }
+
+    /// @brief Registers \p container, whose content is replicated by \ref replicate() and restored by \ref
+    /// recover_from_buddies().
+    /// @tparam Container A container providing \c data(), \c size() and \c resize() with trivially copyable elements,
+    /// e.g., \c std::vector.
+    /// @param container The container, which has to outlive the communicator.
+    template <typename Container>
+    void add_replicated(Container& container) {
+        using value_type = typename Container::value_type;
+        static_assert(
+            std::is_trivially_copyable_v<value_type>,
+            "Only containers of trivially copyable elements can be replicated."
+        );
+        Entry entry;
+        entry.element_size = sizeof(value_type);
+        entry.size         = [&container]() noexcept {
+            return container.size();
+        };
+        entry.data = [&container]() noexcept {
+            return reinterpret_cast<char*>(container.data());
+        };
+        entry.resize = [&container](size_t size) {
+            container.resize(size);
+        };
+        _entries.push_back(std::move(entry));
+    }
+
+    /// @brief Returns the number of registered containers.
+    size_t num_replicated() const {
+        return _entries.size();
+    }
+
+    /// @brief Returns the buddy of rank \p rank in a communicator of size \p size, i.e., the rank storing the snapshot
+    /// of \p rank.
+    static size_t buddy(size_t rank, size_t size) {
+        KAMPING_ASSERT(size > 1, "A communicator of size one has no buddies.", assert::light);
+        return rank + 1 < size ? rank + 1 : rank - 1;
+    }
+
+    /// @brief Takes a snapshot of all registered containers and starts sending it to the buddy rank. This is a
+    /// collective operation, but it does not synchronize the ranks.
+    ///
+    /// A previous replication still in progress is completed first.
+    /// @param step A number identifying the snapshot (e.g., the iteration), which is returned by \ref
+    /// recover_from_buddies().
+    void replicate(uint64_t step = 0) {
+        wait_for_replication();
+        ++_num_replications;
+        auto const& comm = this->to_communicator();
+        if (!_replication_comm) {
+            // Use a separate communicator such that replication messages never match messages of the application.
+            MPI_Comm   replication_comm;
+            auto const ret = MPI_Comm_dup(comm.mpi_communicator(), &replication_comm);
+            comm.mpi_error_hook(ret, "MPI_Comm_dup");
+            _replication_comm.emplace(replication_comm, true);
+        }
+        _outgoing    = serialize(step);
+        _in_progress = true;
+        if (comm.size() == 1) {
+            return;
+        }
+
+        for (size_t const rank: {comm.rank() - 1, comm.rank() + 1}) {
+            if (rank < comm.size() && buddy(rank, comm.size()) == comm.rank()) {
+                _incoming.push_back(Snapshot{rank, 0, {}});
+            }
+        }
+        for (auto& snapshot: _incoming) {
+            _replication_comm->irecv(
+                recv_buf(snapshot.num_bytes),
+                recv_count(1),
+                source(snapshot.rank),
+                tag(size_tag),
+                request(_size_requests.get_request())
+            );
+        }
+        size_t const destination_rank = buddy(comm.rank(), comm.size());
+        _outgoing_num_bytes           = _outgoing.size();
+        _replication_comm->isend(
+            send_buf(_outgoing_num_bytes),
+            destination(destination_rank),
+            tag(size_tag),
+            request(_data_requests.get_request())
+        );
+        _replication_comm->isend(
+            send_buf(_outgoing),
+            destination(destination_rank),
+            tag(data_tag),
+            request(_data_requests.get_request())
+        );
+    }
+
+    /// @brief Waits until the replication started by the last call to \ref replicate() is complete and commits its
+    /// snapshots. Returns immediately if no replication is in progress.
+    void wait_for_replication() {
+        if (!_in_progress) {
+            return;
+        }
+        _size_requests.wait_all();
+        for (auto& snapshot: _incoming) {
+            snapshot.data.resize(asserting_cast<size_t>(snapshot.num_bytes));
+            _replication_comm->irecv(
+                recv_buf(snapshot.data),
+                recv_count(asserting_cast<int>(snapshot.num_bytes)),
+                source(snapshot.rank),
+                tag(data_tag),
+                request(_data_requests.get_request())
+            );
+        }
+        _data_requests.wait_all();
+
+        _previous  = std::move(_committed);
+        _committed = Generation{
+            _num_replications,
+            Snapshot{this->to_communicator().rank(), _outgoing.size(), std::move(_outgoing)},
+            std::move(_incoming)
+        };
+        reset_replication();
+    }
+
+    /// @brief Returns whether a replication started by \ref replicate() has not been committed yet.
+    bool replication_in_progress() const {
+        return _in_progress;
+    }
+
+    /// @brief Recovers the state after a failure, replaces this communicator by \p survivors and replicates the
+    /// recovered state on it. This is a collective operation on \p survivors.
+    ///
+    /// The survivors agree on the last replication committed by all of them. Each survivor restores its registered
+    /// containers from its snapshot of this replication and prepends (or appends) the snapshots of the failed ranks it
+    /// is the buddy of. A replication in progress is abandoned. If the snapshots of a failed rank and its buddy are
+    /// both lost, or if the survivors are more than one replication apart, a \c kassert::KassertException is thrown on
+    /// all survivors.
+    ///
+    /// @param survivors The communicator of the surviving ranks of this communicator, whose relative order has to be
+    /// the same as in this communicator, e.g., the result of \c shrink().
+    /// @param rebalance If true, the elements of each container are redistributed evenly among the survivors
+    /// afterwards (see \ref balanced_partition()), preserving their global order.
+    /// @return The step passed to \ref replicate() for the restored snapshots.
+    uint64_t recover_from_buddies(Comm survivors, bool rebalance = false) {
+        abandon_replication();
+        auto&        comm     = this->to_communicator();
+        size_t const old_rank = comm.rank();
+        size_t const old_size = comm.size();
+
+        // If the failure interrupted a replication, only some survivors may have committed it.
+        uint64_t const replication =
+            survivors.allreduce_single(send_buf(_committed.replication), op(ops::min<>{}));
+        THROWING_KAMPING_ASSERT(replication != 0, "There is no committed snapshot to recover from.");
+        Generation const* generation = nullptr;
+        for (Generation const* candidate: {&_committed, &_previous}) {
+            if (candidate->replication == replication) {
+                generation = candidate;
+            }
+        }
+        bool const all_available =
+            survivors.allreduce_single(send_buf(generation != nullptr), op(ops::logical_and<>{}));
+        THROWING_KAMPING_ASSERT(all_available, "The survivors are more than one replication apart.");
+
+        auto const        survivor_ranks = survivors.allgather(send_buf(old_rank));
+        std::vector<bool> alive(old_size, false);
+        for (size_t const rank: survivor_ranks) {
+            alive[rank] = true;
+        }
+        std::vector<Snapshot const*> snapshots{&generation->snapshot};
+        for (size_t rank = 0; rank < old_size; ++rank) {
+            if (alive[rank]) {
+                continue;
+            }
+            size_t const holder = buddy(rank, old_size);
+            THROWING_KAMPING_ASSERT(
+                alive[holder],
+                "The state of rank " << rank << " is lost, as its buddy rank " << holder << " failed as well."
+            );
+            if (holder == old_rank) {
+                auto const& replicas = generation->replicas;
+                auto const  replica  = std::find_if(replicas.begin(), replicas.end(), [&](Snapshot const& snapshot) {
+                    return snapshot.rank == rank;
+                });
+                KAMPING_ASSERT(replica != replicas.end(), "The snapshot of a failed rank is missing.", assert::light);
+                snapshots.push_back(&*replica);
+            }
+        }
+        std::sort(snapshots.begin(), snapshots.end(), [](Snapshot const* lhs, Snapshot const* rhs) {
+            return lhs->rank < rhs->rank;
+        });
+        uint64_t const step = restore(snapshots);
+
+        comm = std::move(survivors);
+        _replication_comm.reset();
+        _committed        = Generation{};
+        _previous         = Generation{};
+        _num_replications = replication;
+        if (rebalance) {
+            rebalance_entries();
+        }
+        replicate(step);
+        wait_for_replication();
+        return step;
+    }
+
+private:
+    static constexpr int size_tag = 0; ///< The tag of the messages containing the size of a snapshot.
+    static constexpr int data_tag = 1; ///< The tag of the messages containing a snapshot.
+
+    /// @brief A registered container.
+    struct Entry {
+        size_t                      element_size; ///< The size of an element in bytes.
+        std::function<size_t()>     size;         ///< Returns the number of elements.
+        std::function<char*()>      data;         ///< Returns a pointer to the elements.
+        std::function<void(size_t)> resize;       ///< Resizes the container.
+    };
+
+    /// @brief The serialized state of a rank, consisting of the step and the number of containers (one \c uint64_t
+    /// each), followed by the number of elements and the elements of each container.
+    struct Snapshot {
+        size_t            rank;      ///< The rank whose state this is.
+        uint64_t          num_bytes; ///< The size of the serialized state in bytes.
+        std::vector<char> data;      ///< The serialized state.
+    };
+
+    /// @brief The snapshots committed by a replication.
+    struct Generation {
+        uint64_t              replication = 0; ///< The number of the replication, starting at one. Zero if empty.
+        Snapshot              snapshot;        ///< The snapshot of this rank.
+        std::vector<Snapshot> replicas;        ///< The snapshots of the ranks this is the buddy of.
+    };
+
+    /// @brief Serializes the registered containers.
+    std::vector<char> serialize(uint64_t step) const {
+        size_t num_bytes = (2 + _entries.size()) * sizeof(uint64_t);
+        for (auto const& entry: _entries) {
+            num_bytes += entry.size() * entry.element_size;
+        }
+        std::vector<char>       bytes(num_bytes);
+        internal::PointerWriter writer{bytes.data()};
+        internal::write_uint64(writer, step);
+        internal::write_uint64(writer, _entries.size());
+        for (auto const& entry: _entries) {
+            internal::write_uint64(writer, entry.size());
+            writer.write(entry.data(), entry.size() * entry.element_size);
+        }
+        return bytes;
+    }
+
+    /// @brief Sets each registered container to the concatenation of its elements in \p snapshots.
+    /// @return The step of the snapshots.
+    uint64_t restore(std::vector<Snapshot const*> const& snapshots) {
+        // The position of the elements of each container in each snapshot as (pointer, number of elements).
+        std::vector<std::vector<std::pair<char const*, size_t>>> positions(snapshots.size());
+        std::vector<size_t>                                      total_counts(_entries.size(), 0);
+        uint64_t                                                 step = 0;
+        for (size_t i = 0; i < snapshots.size(); ++i) {
+            std::vector<char> const& bytes = snapshots[i]->data;
+            internal::PointerReader  reader{bytes.data(), bytes.data() + bytes.size()};
+            uint64_t const           snapshot_step = internal::read_uint64(reader);
+            THROWING_KAMPING_ASSERT(
+                i == 0 || snapshot_step == step,
+                "The snapshot of rank " << snapshots[i]->rank << " is of step " << snapshot_step << " instead of "
+                                        << step << "."
+            );
+            step = snapshot_step;
+            THROWING_KAMPING_ASSERT(
+                internal::read_uint64(reader) == _entries.size(),
+                "The snapshot of rank " << snapshots[i]->rank << " does not match the registered containers."
+            );
+            for (size_t j = 0; j < _entries.size(); ++j) {
+                size_t const count = asserting_cast<size_t>(internal::read_uint64(reader));
+                positions[i].emplace_back(reader.position, count);
+                reader.skip(count * _entries[j].element_size);
+                total_counts[j] += count;
+            }
+        }
+        for (size_t j = 0; j < _entries.size(); ++j) {
+            _entries[j].resize(total_counts[j]);
+            char* out = _entries[j].data();
+            for (size_t i = 0; i < snapshots.size(); ++i) {
+                auto const [elements, count] = positions[i][j];
+                std::memcpy(out, elements, count * _entries[j].element_size);
+                out += count * _entries[j].element_size;
+            }
+        }
+        return step;
+    }
+
+    /// @brief Redistributes the elements of each registered container evenly among the ranks of this communicator.
+    void rebalance_entries() {
+        auto const& comm = this->to_communicator();
+        for (auto& entry: _entries) {
+            size_t const local_count = entry.size();
+            auto const   counts      = comm.allgather(send_buf(local_count));
+            size_t       total_count = 0;
+            size_t       begin       = 0;
+            for (size_t rank = 0; rank < comm.size(); ++rank) {
+                begin += rank < comm.rank() ? counts[rank] : 0;
+                total_count += counts[rank];
+            }
+            size_t const     end = begin + local_count;
+            std::vector<int> byte_counts(comm.size(), 0);
+            for (size_t rank = 0; rank < comm.size(); ++rank) {
+                ElementRange const range = balanced_partition(total_count, rank, comm.size());
+                if (range.begin < end && begin < range.end) {
+                    size_t const overlap = std::min(end, range.end) - std::max(begin, range.begin);
+                    byte_counts[rank]    = asserting_cast<int>(overlap * entry.element_size);
+                }
+            }
+            std::vector<char> bytes(entry.data(), entry.data() + local_count * entry.element_size);
+            bytes = comm.alltoallv(send_buf(bytes), send_counts(byte_counts));
+            entry.resize(bytes.size() / entry.element_size);
+            std::memcpy(entry.data(), bytes.data(), bytes.size());
+        }
+    }
+
+    /// @brief Cancels and frees all pending replication requests and discards the uncommitted snapshots.
+    void abandon_replication() {
+        for (auto* pool: {&_size_requests, &_data_requests}) {
+            for (size_t i = 0; i < pool->num_requests(); ++i) {
+                MPI_Request& request = pool->request_ptr()[i];
+                if (request != MPI_REQUEST_NULL) {
+                    // Errors are ignored, as the communication partner may have failed.
+                    MPI_Cancel(&request);
+                    MPI_Request_free(&request);
+                }
+            }
+        }
+        _outgoing.clear();
+        reset_replication();
+    }
+
+    /// @brief Clears the state of the current replication.
+    void reset_replication() {
+        _incoming.clear();
+        _size_requests = RequestPool<DefaultContainerType>();
+        _data_requests = RequestPool<DefaultContainerType>();
+        _in_progress   = false;
+    }
+
+    std::vector<Entry>    _entries;                ///< The registered containers.
+    Generation            _committed;              ///< The snapshots of the last committed replication.
+    Generation            _previous;               ///< The snapshots of the replication committed before.
+    uint64_t              _num_replications = 0;   ///< The number of replications started.
+    std::vector<char>     _outgoing;               ///< The snapshot of this rank being replicated.
+    uint64_t              _outgoing_num_bytes = 0; ///< The size of the snapshot being replicated.
+    std::vector<Snapshot> _incoming;               ///< The snapshots being received.
+    bool                  _in_progress = false;    ///< Whether a replication has not been committed yet.
+    RequestPool<DefaultContainerType>                     _size_requests; ///< The requests receiving snapshot sizes.
+    RequestPool<DefaultContainerType>                     _data_requests; ///< The requests sending/receiving data.
+    std::optional<kamping::Communicator<DefaultContainerType>> _replication_comm; ///< Used for replication messages.
+};
+
+} // namespace kamping::plugin
@@ -0,0 +1,237 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/allreduce.hpp"
+#include "kamping/collectives/bcast.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/mpi_datatype.hpp"
+#include "kamping/named_parameter_check.hpp"
+#include "kamping/named_parameter_selection.hpp"
+#include "kamping/named_parameter_types.hpp"
+#include "kamping/plugin/plugin_helpers.hpp"
+#include "kamping/shared_memory_array.hpp"
+#include "kamping/span.hpp"
+
+/// @file
+/// @brief Plugin providing collectives which store their result only once per node in shared memory.
+
+#pragma once
+
+namespace kamping::plugin {
+
+/// @brief Plugin providing collectives whose result is stored only once per node in a \ref SharedMemoryArray instead
+/// of once per rank. This is useful for replicated read-only data (e.g., lookup tables), whose memory footprint per
+/// node is otherwise proportional to the number of ranks per node.
+///
+/// Each call splits the communicator into node-local communicators and a communicator of the node leaders (the ranks
+/// with node-local rank 0), so these operations are intended for large data which is replicated rarely.
+template <typename Comm, template <typename...> typename DefaultContainerType>
+class SharedMemory : public plugin::PluginBase<Comm, DefaultContainerType, SharedMemory> {
+public:
+    /// @brief Allocates a \ref SharedMemoryArray in which this rank owns a segment of \p local_size elements. This is a
+    /// collective operation.
+    /// @tparam T The type of the elements.
+    /// @param local_size The number of elements in the segment of this rank.
+    template <typename T>
+    SharedMemoryArray<T> shared_array(size_t local_size) const {
+        return SharedMemoryArray<T>::from_node_communicator(node_communicator(), local_size);
+    }
+
+    template <typename recv_value_type_tparam = kamping::internal::unused_tparam, typename... Args>
+    auto bcast_shared(Args... args) const;
+
+    template <typename... Args>
+    auto allgatherv_shared(Args... args) const;
+
+private:
+    /// @brief Returns a communicator containing all ranks sharing memory with this rank.
+    Communicator<> node_communicator() const {
+        return Communicator<>(this->to_communicator().split_to_shared_memory().disown_mpi_communicator(), true);
+    }
+};
+
+/// @brief Broadcasts data from the root to all ranks, storing it only once per node.
+///
+/// The root copies its data into shared memory of its node, from where the node leaders broadcast it directly into the
+/// shared memory of their nodes. The result is a \ref SharedMemoryArray in which the node leader owns all elements, so
+/// \ref SharedMemoryArray::all() returns the broadcasted data on all ranks.
+///
+/// The following parameter is required on the root rank:
+/// - \ref kamping::send_buf() containing the data to broadcast. Non-root ranks must either provide this buffer (its
+/// content is ignored) or the value type as template parameter.
+///
+/// The following parameter is optional:
+/// - \ref kamping::root() specifying an alternative root. If not present, the default root of the \c Communicator is
+/// used.
+///
+/// @tparam recv_value_type_tparam The type of the broadcasted elements. Only required if no \ref kamping::send_buf()
+/// is given.
+/// @tparam Args Automatically deducted template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return A \ref SharedMemoryArray containing the broadcasted data.
+template <typename Comm, template <typename...> typename DefaultContainerType>
+template <typename recv_value_type_tparam, typename... Args>
+auto SharedMemory<Comm, DefaultContainerType>::bcast_shared(Args... args) const {
+    using namespace kamping::internal;
+    KAMPING_CHECK_PARAMETERS(Args, KAMPING_REQUIRED_PARAMETERS(), KAMPING_OPTIONAL_PARAMETERS(send_buf, root));
+    auto& self = this->to_communicator();
+
+    auto&& root_param =
+        select_parameter_type_or_default<ParameterType::root, RootDataBuffer>(std::tuple(self.root()), args...);
+    int const root_rank = root_param.rank_signed();
+    KAMPING_ASSERT(self.is_valid_rank(root_rank), "Invalid rank as root.", assert::light);
+
+    // Get the data to broadcast, which is only required on the root
+    constexpr bool has_send_buf = has_parameter_type<ParameterType::send_buf, Args...>();
+    auto           data         = [&]() {
+        if constexpr (has_send_buf) {
+            auto const& buf  = select_parameter_type<ParameterType::send_buf>(args...).construct_buffer_or_rebind();
+            using value_type = std::remove_const_t<typename std::remove_reference_t<decltype(buf)>::value_type>;
+            return Span<value_type const>(buf.data(), buf.size());
+        } else {
+            return Span<recv_value_type_tparam const>();
+        }
+    }();
+    using value_type = std::remove_const_t<typename decltype(data)::value_type>;
+    static_assert(
+        !std::is_same_v<value_type, unused_tparam>,
+        "No send_buf parameter provided and no value type given as template parameter. One of these is required."
+    );
+    KAMPING_ASSERT(
+        !self.is_root(root_rank) || has_send_buf,
+        "send_buf must be provided on the root rank.",
+        assert::light
+    );
+
+    size_t const size = self.bcast_single(kamping::send_recv_buf(data.size()), kamping::root(root_rank));
+
+    Communicator<> node_comm     = node_communicator();
+    bool const     is_leader     = node_comm.rank() == 0;
+    bool const     node_has_root = node_comm.allreduce_single(
+        kamping::send_buf(self.is_root(root_rank)),
+        kamping::op(ops::logical_or<>{})
+    );
+    auto leader_comm = self.split(is_leader ? 0 : 1);
+
+    auto result = SharedMemoryArray<value_type>::from_node_communicator(std::move(node_comm), is_leader ? size : 0);
+    if (self.is_root(root_rank)) {
+        std::copy(data.begin(), data.end(), result.all().data());
+    }
+    result.sync();
+    if (is_leader && leader_comm.size() > 1) {
+        int const leader_root = leader_comm.allreduce_single(
+            kamping::send_buf(node_has_root ? leader_comm.rank_signed() : 0),
+            kamping::op(ops::max<>{})
+        );
+        leader_comm.bcast(kamping::send_recv_buf(result.all()), kamping::root(leader_root));
+    }
+    result.sync();
+    return result;
+}
+
+/// @brief Gathers the data of all ranks on all ranks, storing it only once per node.
+///
+/// Each rank copies its data into shared memory of its node, from where the node leaders exchange the data of their
+/// nodes. The result is a \ref SharedMemoryArray in which the node leader owns all elements, so \ref
+/// SharedMemoryArray::all() returns the concatenation of the data of all ranks (ordered by rank) on all ranks.
+///
+/// If the ranks of each node are consecutive, the leaders exchange the data in place using \c MPI_Allgatherv.
+/// Otherwise, the data of each node is packed before and unpacked after the exchange.
+///
+/// The following parameter is required:
+/// - \ref kamping::send_buf() containing the data contributed by this rank.
+///
+/// @tparam Args Automatically deducted template parameters.
+/// @param args All required parameters described above.
+/// @return A \ref SharedMemoryArray containing the gathered data.
+template <typename Comm, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+auto SharedMemory<Comm, DefaultContainerType>::allgatherv_shared(Args... args) const {
+    using namespace kamping::internal;
+    KAMPING_CHECK_PARAMETERS(Args, KAMPING_REQUIRED_PARAMETERS(send_buf), KAMPING_OPTIONAL_PARAMETERS());
+    auto& self = this->to_communicator();
+
+    auto const& send_buf = select_parameter_type<ParameterType::send_buf>(args...).construct_buffer_or_rebind();
+    using value_type     = std::remove_const_t<typename std::remove_reference_t<decltype(send_buf)>::value_type>;
+
+    // The position of the data of each rank in the result
+    auto const          counts = self.allgather(kamping::send_buf(send_buf.size()));
+    std::vector<size_t> displs(self.size());
+    std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), size_t{0});
+    size_t const total_size = displs.back() + counts.back();
+
+    Communicator<> node_comm   = node_communicator();
+    bool const     is_leader   = node_comm.rank() == 0;
+    auto const     node_ranks  = node_comm.allgather(kamping::send_buf(self.rank()));
+    bool const     consecutive = node_ranks.back() - node_ranks.front() + 1 == node_ranks.size();
+    bool const     all_consecutive =
+        self.allreduce_single(kamping::send_buf(consecutive), kamping::op(ops::logical_and<>{}));
+    auto leader_comm = self.split(is_leader ? 0 : 1);
+
+    auto result =
+        SharedMemoryArray<value_type>::from_node_communicator(std::move(node_comm), is_leader ? total_size : 0);
+    std::copy_n(send_buf.data(), send_buf.size(), result.all().data() + displs[self.rank()]);
+    result.sync();
+    if (is_leader && leader_comm.size() > 1) {
+        size_t node_size = 0;
+        for (size_t rank: node_ranks) {
+            node_size += counts[rank];
+        }
+        auto const node_sizes = leader_comm.allgather(kamping::send_buf(asserting_cast<int>(node_size)));
+        if (all_consecutive) {
+            // The data of each node is already at its final position, as the leaders are ordered by rank.
+            std::vector<int> node_displs(leader_comm.size());
+            std::exclusive_scan(node_sizes.begin(), node_sizes.end(), node_displs.begin(), 0);
+            int const err = MPI_Allgatherv(
+                MPI_IN_PLACE,
+                0,
+                MPI_DATATYPE_NULL,
+                result.all().data(),
+                node_sizes.data(),
+                node_displs.data(),
+                mpi_datatype<value_type>(),
+                leader_comm.mpi_communicator()
+            );
+            self.mpi_error_hook(err, "MPI_Allgatherv");
+        } else {
+            std::vector<value_type> node_data;
+            node_data.reserve(node_size);
+            for (size_t rank: node_ranks) {
+                auto const begin = result.all().data() + displs[rank];
+                node_data.insert(node_data.end(), begin, begin + counts[rank]);
+            }
+            auto const gathered       = leader_comm.allgatherv(kamping::send_buf(node_data));
+            auto const all_node_ranks = leader_comm.allgatherv(kamping::send_buf(node_ranks));
+            size_t     offset         = 0;
+            for (size_t rank: all_node_ranks) {
+                std::copy_n(gathered.data() + offset, counts[rank], result.all().data() + displs[rank]);
+                offset += counts[rank];
+            }
+        }
+    }
+    result.sync();
+    return result;
+}
+
+} // namespace kamping::plugin
@@ -0,0 +1,219 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief An engine driving the progress of nonblocking operations, either cooperatively or in a background thread.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/environment.hpp"
+#include "kamping/error_handling.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/request_pool.hpp"
+#include "kamping/thread_levels.hpp"
+
+namespace kamping {
+
+/// @brief Drives the progress of registered nonblocking operations.
+///
+/// Many MPI implementations only progress nonblocking operations (e.g., the rounds of an \c MPI_Iallreduce) while the
+/// application calls into MPI, so computation between starting and completing an operation does not overlap with
+/// communication. The progress engine periodically polls the registered operations, either when \ref progress() is
+/// called (e.g., from a compute loop) or in a background thread started by \ref start().
+///
+/// The operations are polled using \c MPI_Request_get_status, which does not free completed requests. A completed
+/// operation is dropped from the engine, but it still has to be completed by the user (e.g., using \c wait()), which
+/// then returns immediately. While the background thread is running, a registered operation must not be waited on,
+/// tested or modified (e.g., by adding requests to a registered pool) before it is removed using \ref remove().
+///
+/// Example:
+/// @code
+/// ProgressEngine engine;
+/// auto result = comm.iallreduce(send_buf(data), op(ops::plus<>{}));
+/// engine.add(result);
+/// for (auto& chunk: chunks) {
+///     compute(chunk);
+///     engine.progress();
+/// }
+/// engine.remove(result);
+/// auto sum = result.wait();
+/// @endcode
+class ProgressEngine {
+public:
+    /// @brief Creates an engine without registered operations.
+    ProgressEngine() = default;
+
+    ProgressEngine(ProgressEngine const&)            = delete; ///< Copy constructor is deleted.
+    ProgressEngine& operator=(ProgressEngine const&) = delete; ///< Copy assignment is deleted.
+
+    /// @brief Stops the background thread (if running) and ignores errors raised in it.
+    ~ProgressEngine() {
+        stop_thread();
+    }
+
+    /// @brief Registers a nonblocking operation, i.e., an object providing \c get_request_ptr() such as a \ref
+    /// NonBlockingResult owning its request. It is dropped as soon as its request is complete.
+    /// @param result The operation, which has to outlive its registration.
+    template <typename NonBlockingResultType>
+    void add(NonBlockingResultType& result) {
+        MPI_Request* request = result.get_request_ptr();
+        add_poller(&result, [request]() {
+            return poll(request, 1);
+        });
+    }
+
+    /// @brief Registers all requests of \p pool, which stays registered until it is removed.
+    /// @param pool The request pool, which has to outlive its registration.
+    template <template <typename...> typename DefaultContainerType>
+    void add(RequestPool<DefaultContainerType>& pool) {
+        add_poller(&pool, [&pool]() {
+            poll(pool.request_ptr(), pool.num_requests());
+            return false;
+        });
+    }
+
+    /// @brief Removes a registered operation or request pool. Does nothing if it is not (or no longer) registered.
+    template <typename T>
+    void remove(T const& object) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pollers.erase(
+            std::remove_if(
+                _pollers.begin(),
+                _pollers.end(),
+                [&](Poller const& poller) { return poller.object == static_cast<void const*>(&object); }
+            ),
+            _pollers.end()
+        );
+    }
+
+    /// @brief Returns the number of registered operations and request pools.
+    size_t num_registered() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _pollers.size();
+    }
+
+    /// @brief Polls all registered operations once and drops the completed ones.
+    /// @return The number of operations and request pools which are still registered.
+    size_t progress() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pollers.erase(
+            std::remove_if(_pollers.begin(), _pollers.end(), [](Poller const& poller) { return poller.poll(); }),
+            _pollers.end()
+        );
+        return _pollers.size();
+    }
+
+    /// @brief Starts a background thread calling \ref progress() every \p interval. MPI has to be initialized with
+    /// \ref ThreadLevel::multiple.
+    /// @param interval The time between two calls to \ref progress().
+    void start(std::chrono::microseconds interval = std::chrono::microseconds(100)) {
+        THROWING_KAMPING_ASSERT(!running(), "The progress thread is already running.");
+        THROWING_KAMPING_ASSERT(
+            mpi_env.thread_level() == ThreadLevel::multiple,
+            "A progress thread requires MPI to be initialized with MPI_THREAD_MULTIPLE."
+        );
+        _stop_requested = false;
+        _error          = nullptr;
+        _thread         = std::thread([this, interval]() {
+            try {
+                std::unique_lock<std::mutex> lock(_stop_mutex);
+                while (!_stop_requested) {
+                    lock.unlock();
+                    progress();
+                    lock.lock();
+                    _stop_condition.wait_for(lock, interval, [this]() { return _stop_requested; });
+                }
+            } catch (...) {
+                _error = std::current_exception();
+            }
+        });
+    }
+
+    /// @brief Stops the background thread started by \ref start() and rethrows the first exception raised in it.
+    void stop() {
+        stop_thread();
+        if (_error) {
+            std::rethrow_exception(std::exchange(_error, nullptr));
+        }
+    }
+
+    /// @brief Returns whether the background thread is running.
+    bool running() const {
+        return _thread.joinable();
+    }
+
+private:
+    /// @brief A registered operation or request pool.
+    struct Poller {
+        void const*           object; ///< The registered object, which identifies it for \ref remove().
+        std::function<bool()> poll;   ///< Polls the requests and returns whether the object has to be dropped.
+    };
+
+    /// @brief Polls the \p count requests starting at \p requests without freeing them.
+    /// @return Whether all requests are complete.
+    static bool poll(MPI_Request* requests, size_t count) {
+        bool all_complete = true;
+        for (size_t i = 0; i < count; ++i) {
+            if (requests[i] == MPI_REQUEST_NULL) {
+                continue;
+            }
+            int                  complete = false;
+            [[maybe_unused]] int err      = MPI_Request_get_status(requests[i], &complete, MPI_STATUS_IGNORE);
+            THROW_IF_MPI_ERROR(err, MPI_Request_get_status);
+            all_complete = all_complete && complete;
+        }
+        return all_complete;
+    }
+
+    /// @brief Registers \p object, which is polled using \p poll.
+    void add_poller(void const* object, std::function<bool()> poll) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pollers.push_back(Poller{object, std::move(poll)});
+    }
+
+    /// @brief Stops and joins the background thread if it is running.
+    void stop_thread() {
+        if (!running()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_stop_mutex);
+            _stop_requested = true;
+        }
+        _stop_condition.notify_one();
+        _thread.join();
+    }
+
+    mutable std::mutex      _mutex;                  ///< Protects the registered operations.
+    std::vector<Poller>     _pollers;                ///< The registered operations.
+    std::thread             _thread;                 ///< The background thread.
+    std::mutex              _stop_mutex;             ///< Protects the stop flag.
+    std::condition_variable _stop_condition;         ///< Signals a stop request to the background thread.
+    bool                    _stop_requested = false; ///< Whether the background thread has to stop.
+    std::exception_ptr      _error;                  ///< The first exception raised in the background thread.
+};
+
+} // namespace kamping
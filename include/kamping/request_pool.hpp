@@ -13,7 +13,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include <mpi.h>
@@ -36,11 +40,31 @@ struct PoolAnyResult {
     StatusType status; ///< The status of the complete operation.
 };
 
+/// @brief Result returned by \ref RequestPool.wait_some()
+/// @tparam IndicesType Type of the container storing the indices.
+/// @tparam StatusesType Type of the container storing the statuses.
+template <typename IndicesType, typename StatusesType>
+struct PoolSomeResult {
+    IndicesType  indices;  ///< The indices of the completed operations.
+    StatusesType statuses; ///< The statuses of the completed operations, in the same order as \ref indices.
+};
+
 /// @brief A pool for storing multiple \ref Request s and checking them for completion.
 ///
 /// Requests are internally stored in a vector. The vector is resized as needed.
 /// New requests can be obtained by calling \ref get_request.
 ///
+/// Once an operation of the pool (e.g., \ref wait_any or \ref test_some) has observed the completion of a request, its
+/// slot is released and handed out again by the next call to \ref get_request, so that a long-running message loop
+/// does not grow the pool beyond the maximum number of simultaneously outstanding requests. Consequently, an index
+/// returned by a completion operation refers to the completed request only until the next call to \ref get_request.
+/// As growing the pool may invalidate previously handed out \ref PooledRequest s, all requests obtained from the pool
+/// have to be started before calling \ref get_request again.
+///
+/// A callback can be attached to a request, which is invoked by the operation of the pool observing its completion.
+/// Callbacks are invoked after the pool has released the slots of all completed requests, so they may start new
+/// requests in the pool (e.g., to post the next receive).
+///
 /// @tparam DefaultContainerType The default container type to use for containers created inside pool operations.
 /// Defaults to std::vector.
 template <template <typename...> typename DefaultContainerType = std::vector>
@@ -66,20 +90,46 @@ public:
         return _requests.size();
     }
 
-    /// @brief Returns the number of requests currently stored in the pool.
+    /// @brief Returns the number of requests currently stored in the pool, including released slots.
     size_t num_requests() const {
         return _requests.size();
     }
 
+    /// @brief Returns the number of requests which have been handed out and whose completion has not yet been
+    /// observed by an operation of the pool.
+    size_t num_pending_requests() const {
+        return _requests.size() - _free_slots.size();
+    }
+
     /// @brief Returns a pointer to the underlying MPI_Request array.
     MPI_Request* request_ptr() {
         return _requests.data();
     }
 
-    /// @brief Adds a new request to the pool and returns a \ref PooledRequest encapsulating it.
+    /// @brief Adds a new request to the pool and returns a \ref PooledRequest encapsulating it. Reuses a released
+    /// slot if there is one.
     inline PooledRequest<index_type> get_request() {
-        MPI_Request& req = _requests.emplace_back(MPI_REQUEST_NULL);
-        return PooledRequest<index_type>{_requests.size() - 1, req};
+        return get_request(nullptr);
+    }
+
+    /// @brief Adds a new request to the pool and returns a \ref PooledRequest encapsulating it. Reuses a released
+    /// slot if there is one.
+    /// @param on_complete Callback which is invoked when an operation of the pool observes the completion of the
+    /// request.
+    inline PooledRequest<index_type> get_request(std::function<void()> on_complete) {
+        index_type index;
+        if (_free_slots.empty()) {
+            index = _requests.size();
+            _requests.push_back(MPI_REQUEST_NULL);
+            _callbacks.emplace_back();
+            _is_free.push_back(false);
+        } else {
+            index = _free_slots.back();
+            _free_slots.pop_back();
+            _is_free[index] = false;
+        }
+        _callbacks[index] = std::move(on_complete);
+        return PooledRequest<index_type>{index, _requests[index]};
     }
 
     /// @brief Waits for all requests in the pool to complete by calling \c MPI_Waitall.
@@ -110,6 +160,7 @@ public:
         }
         [[maybe_unused]] int err = MPI_Waitall(asserting_cast<int>(num_requests()), request_ptr(), statuses_ptr);
         THROW_IF_MPI_ERROR(err, MPI_Waitall);
+        release_all();
         if constexpr (internal::is_extractable<decltype(statuses)>) {
             return statuses.extract();
         }
@@ -150,6 +201,9 @@ public:
         [[maybe_unused]] int err =
             MPI_Testall(asserting_cast<int>(num_requests()), request_ptr(), &succeeded, statuses_ptr);
         THROW_IF_MPI_ERROR(err, MPI_Testall);
+        if (succeeded) {
+            release_all();
+        }
         if constexpr (internal::is_extractable<decltype(statuses)>) {
             if (succeeded) {
                 return std::optional{statuses.extract()};
@@ -183,6 +237,9 @@ public:
             internal::status_param_to_native_ptr(status)
         );
         THROW_IF_MPI_ERROR(err, MPI_Waitany);
+        if (index != MPI_UNDEFINED) {
+            release(static_cast<index_type>(index));
+        }
         if constexpr (internal::is_extractable<decltype(status)>) {
             using status_type = decltype(status.extract());
             if (index == MPI_UNDEFINED) {
@@ -223,6 +280,9 @@ public:
             internal::status_param_to_native_ptr(status)
         );
         THROW_IF_MPI_ERROR(err, MPI_Testany);
+        if (flag && index != MPI_UNDEFINED) {
+            release(static_cast<index_type>(index));
+        }
         if constexpr (internal::is_extractable<decltype(status)>) {
             using status_type = decltype(status.extract());
             using return_type = PoolAnyResult<index_type, status_type>;
@@ -248,7 +308,147 @@ public:
         }
     }
 
+    /// @brief Waits for at least one request in the pool to complete by calling \c MPI_Waitsome.
+    /// @param statuses_param A \c statuses parameter object to which the status information about the completed
+    /// operations is written. Defaults to \c kamping::statuses(ignore<>).
+    /// @return By default, returns a container holding the indices of the completed operations, which is empty if no
+    /// request in the pool is active. If \p statuses is an owning out parameter, also returns the statuses alongside
+    /// the indices by returning a \ref PoolSomeResult.
+    /// @note As MPI requires a status for every request in the pool, the statuses buffer is resized to hold
+    /// `num_requests()` statuses before the call and afterwards to the number of completed operations according to its
+    /// \c resize_policy.
+    /// @see PoolSomeResult
+    template <typename StatusesParamObjectType = decltype(kamping::statuses(ignore<>))>
+    auto wait_some(StatusesParamObjectType statuses_param = kamping::statuses(ignore<>)) {
+        return some_impl<true>(std::move(statuses_param));
+    }
+
+    /// @brief Tests for completed requests in the pool by calling \c MPI_Testsome.
+    /// @param statuses_param A \c statuses parameter object to which the status information about the completed
+    /// operations is written. Defaults to \c kamping::statuses(ignore<>).
+    /// @return The indices of the completed operations, which is empty if no request has completed (or no request is
+    /// active). The return type follows the same rules as for \ref wait_some.
+    /// @see wait_some
+    template <typename StatusesParamObjectType = decltype(kamping::statuses(ignore<>))>
+    auto test_some(StatusesParamObjectType statuses_param = kamping::statuses(ignore<>)) {
+        return some_impl<false>(std::move(statuses_param));
+    }
+
 private:
-    std::vector<MPI_Request> _requests;
+    /// @brief Implementation of \ref wait_some (if \p blocking is \c true) and \ref test_some.
+    template <bool blocking, typename StatusesParamObjectType>
+    auto some_impl(StatusesParamObjectType statuses_param) {
+        static_assert(
+            StatusesParamObjectType::parameter_type == internal::ParameterType::statuses,
+            "Only statuses parameters are allowed."
+        );
+        auto        statuses = statuses_param.template construct_buffer_or_rebind<DefaultContainerType>();
+        MPI_Status* statuses_ptr;
+        if constexpr (decltype(statuses)::buffer_type == internal::BufferType::ignore) {
+            statuses_ptr = MPI_STATUSES_IGNORE;
+        } else {
+            auto compute_requested_size = [&] {
+                return num_requests();
+            };
+            statuses.resize_if_requested(compute_requested_size);
+            KAMPING_ASSERT(
+                statuses.size() >= compute_requested_size(),
+                "statuses buffer is not large enough to hold all status information.",
+                assert::light
+            );
+            statuses_ptr = statuses.data();
+        }
+        _completed_indices.resize(num_requests());
+        int outcount;
+        if constexpr (blocking) {
+            [[maybe_unused]] int err = MPI_Waitsome(
+                asserting_cast<int>(num_requests()),
+                request_ptr(),
+                &outcount,
+                _completed_indices.data(),
+                statuses_ptr
+            );
+            THROW_IF_MPI_ERROR(err, MPI_Waitsome);
+        } else {
+            [[maybe_unused]] int err = MPI_Testsome(
+                asserting_cast<int>(num_requests()),
+                request_ptr(),
+                &outcount,
+                _completed_indices.data(),
+                statuses_ptr
+            );
+            THROW_IF_MPI_ERROR(err, MPI_Testsome);
+        }
+        size_t const num_completed = outcount == MPI_UNDEFINED ? 0 : asserting_cast<size_t>(outcount);
+        DefaultContainerType<index_type> indices(num_completed);
+        std::transform(
+            _completed_indices.begin(),
+            _completed_indices.begin() + asserting_cast<std::ptrdiff_t>(num_completed),
+            indices.begin(),
+            [](int index) { return static_cast<index_type>(index); }
+        );
+        release(indices);
+        if constexpr (internal::is_extractable<decltype(statuses)>) {
+            statuses.resize_if_requested([&] { return num_completed; });
+            using statuses_type = decltype(statuses.extract());
+            return PoolSomeResult<DefaultContainerType<index_type>, statuses_type>{
+                std::move(indices),
+                statuses.extract()};
+        } else {
+            if constexpr (decltype(statuses)::buffer_type != internal::BufferType::ignore) {
+                statuses.resize_if_requested([&] { return num_completed; });
+            }
+            return indices;
+        }
+    }
+
+    /// @brief Releases the slot at \p index and invokes its callback.
+    void release(index_type index) {
+        std::function<void()> callback = release_slot(index);
+        if (callback) {
+            callback();
+        }
+    }
+
+    /// @brief Releases the slots at \p indices and afterwards invokes their callbacks.
+    template <typename Indices>
+    void release(Indices const& indices) {
+        std::vector<std::function<void()>> callbacks;
+        for (auto index: indices) {
+            if (auto callback = release_slot(index)) {
+                callbacks.push_back(std::move(callback));
+            }
+        }
+        for (auto& callback: callbacks) {
+            callback();
+        }
+    }
+
+    /// @brief Releases all slots which are currently handed out and afterwards invokes their callbacks.
+    void release_all() {
+        std::vector<index_type> indices;
+        for (index_type index = index_begin(); index < index_end(); ++index) {
+            if (!_is_free[index]) {
+                indices.push_back(index);
+            }
+        }
+        release(indices);
+    }
+
+    /// @brief Marks the slot at \p index as free (if it was not already) and returns its callback.
+    std::function<void()> release_slot(index_type index) {
+        if (_is_free[index]) {
+            return nullptr;
+        }
+        _is_free[index] = true;
+        _free_slots.push_back(index);
+        return std::exchange(_callbacks[index], nullptr);
+    }
+
+    std::vector<MPI_Request>           _requests;          ///< The requests of the pool.
+    std::vector<std::function<void()>> _callbacks;         ///< The completion callback of each slot.
+    std::vector<bool>                  _is_free;           ///< Whether a slot has been released.
+    std::vector<index_type>            _free_slots;        ///< The released slots which can be handed out again.
+    std::vector<int>                   _completed_indices; ///< Buffer for the indices returned by \c MPI_Testsome.
 };
 } // namespace kamping
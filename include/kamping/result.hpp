@@ -26,6 +26,7 @@
 #include "kamping/named_parameter_selection.hpp"
 #include "kamping/named_parameter_types.hpp"
 #include "kamping/named_parameters_detail/status_parameters.hpp"
+#include "kamping/utils/ragged_view.hpp"
 #include "named_parameter_selection.hpp"
 
 namespace kamping {
@@ -740,6 +741,84 @@ public:
         return internal::select_parameter_type_in_tuple<internal::ParameterType::send_recv_type>(_data).extract();
     }
 
+    /// @brief Returns a \ref RaggedView over the \c recv_buffer, which provides access to the elements received from
+    /// each rank as a \ref Span sharing the result's underlying storage.
+    ///
+    /// This function is only available if the \c recv_buffer, \c recv_counts and \c recv_displs are part of the result
+    /// object (i.e. \c recv_counts_out() and \c recv_displs_out() have been passed to the wrapped call). The view is
+    /// invalidated if any of these buffers is extracted from or destroyed with this result object.
+    /// @tparam T Template parameter helper only needed to remove this function if the corresponding data is not part of
+    /// the result object.
+    /// @return A \ref RaggedView with one block per rank.
+    template <
+        typename T = std::tuple<Args...>,
+        std::enable_if_t<
+            internal::has_parameter_type_in_tuple<internal::ParameterType::recv_buf, T>()
+                && internal::has_parameter_type_in_tuple<internal::ParameterType::recv_counts, T>()
+                && internal::has_parameter_type_in_tuple<internal::ParameterType::recv_displs, T>(),
+            bool> = true>
+    auto recv_buf_per_source() {
+        return make_ragged_view(get_recv_buf(), get_recv_counts(), get_recv_displs());
+    }
+
+    /// @brief Returns a \ref RaggedView over the \c recv_buffer, which provides access to the elements received from
+    /// each rank as a \ref Span sharing the result's underlying storage.
+    ///
+    /// This function is only available if the \c recv_buffer, \c recv_counts and \c recv_displs are part of the result
+    /// object (i.e. \c recv_counts_out() and \c recv_displs_out() have been passed to the wrapped call). The view is
+    /// invalidated if any of these buffers is extracted from or destroyed with this result object.
+    /// @tparam T Template parameter helper only needed to remove this function if the corresponding data is not part of
+    /// the result object.
+    /// @return A \ref RaggedView with one block per rank.
+    template <
+        typename T = std::tuple<Args...>,
+        std::enable_if_t<
+            internal::has_parameter_type_in_tuple<internal::ParameterType::recv_buf, T>()
+                && internal::has_parameter_type_in_tuple<internal::ParameterType::recv_counts, T>()
+                && internal::has_parameter_type_in_tuple<internal::ParameterType::recv_displs, T>(),
+            bool> = true>
+    auto recv_buf_per_source() const {
+        return make_ragged_view(get_recv_buf(), get_recv_counts(), get_recv_displs());
+    }
+
+    /// @brief Returns the elements received from rank \p source as a \ref Span sharing the result's underlying storage.
+    ///
+    /// This function is only available if the \c recv_buffer, \c recv_counts and \c recv_displs are part of the result
+    /// object. See \ref recv_buf_per_source().
+    /// @tparam T Template parameter helper only needed to remove this function if the corresponding data is not part of
+    /// the result object.
+    /// @param source The rank whose block is requested.
+    /// @return A \ref Span over the elements received from \p source.
+    template <
+        typename T = std::tuple<Args...>,
+        std::enable_if_t<
+            internal::has_parameter_type_in_tuple<internal::ParameterType::recv_buf, T>()
+                && internal::has_parameter_type_in_tuple<internal::ParameterType::recv_counts, T>()
+                && internal::has_parameter_type_in_tuple<internal::ParameterType::recv_displs, T>(),
+            bool> = true>
+    auto per_source(size_t source) {
+        return recv_buf_per_source()[source];
+    }
+
+    /// @brief Returns the elements received from rank \p source as a \ref Span sharing the result's underlying storage.
+    ///
+    /// This function is only available if the \c recv_buffer, \c recv_counts and \c recv_displs are part of the result
+    /// object. See \ref recv_buf_per_source().
+    /// @tparam T Template parameter helper only needed to remove this function if the corresponding data is not part of
+    /// the result object.
+    /// @param source The rank whose block is requested.
+    /// @return A \ref Span over the elements received from \p source.
+    template <
+        typename T = std::tuple<Args...>,
+        std::enable_if_t<
+            internal::has_parameter_type_in_tuple<internal::ParameterType::recv_buf, T>()
+                && internal::has_parameter_type_in_tuple<internal::ParameterType::recv_counts, T>()
+                && internal::has_parameter_type_in_tuple<internal::ParameterType::recv_displs, T>(),
+            bool> = true>
+    auto per_source(size_t source) const {
+        return recv_buf_per_source()[source];
+    }
+
     /// @brief Gets the \c parameter with given parameter type from the MPIResult object.
     ///
     /// This function is only available if the corresponding data is part of the result object.
@@ -892,7 +971,12 @@ using parameter_types_to_ignore_for_result_object = type_list<
     ParameterTypeEntry<ParameterType::send_tag>,
     ParameterTypeEntry<ParameterType::recv_tag>,
     ParameterTypeEntry<ParameterType::send_mode>,
-    ParameterTypeEntry<ParameterType::values_on_rank_0>>;
+    ParameterTypeEntry<ParameterType::values_on_rank_0>,
+    ParameterTypeEntry<ParameterType::algorithm>,
+    ParameterTypeEntry<ParameterType::target>,
+    ParameterTypeEntry<ParameterType::target_disp>,
+    ParameterTypeEntry<ParameterType::compare_value>,
+    ParameterTypeEntry<ParameterType::file_offset>>;
 
 ///@brief Predicate to check whether a buffer provided to \ref make_mpi_result() shall be discard or returned in the
 /// result object.
@@ -15,20 +15,105 @@
 
 #pragma once
 
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <streambuf>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #ifdef KAMPING_ENABLE_SERIALIZATION
     #include "cereal/archives/binary.hpp"
 #endif
+#include "kamping/checking_casts.hpp"
 #include "kamping/data_buffer.hpp"
+#include "kamping/packing.hpp"
+#include "kamping/utils/ragged_view.hpp"
 
 namespace kamping {
 namespace internal {
-#ifdef KAMPING_ENABLE_SERIALIZATION
+
+/// @brief Output stream buffer which appends all written characters directly to a contiguous character container.
+///
+/// This allows (cereal) archives to serialize directly into the buffer used for communication instead of going through
+/// a \c std::stringstream, which would require an additional copy of the serialized data.
+///
+/// @tparam Container Type of the character container to write into. Must provide \c push_back() and \c append().
+template <typename Container>
+class ContainerOutputStreamBuffer : public std::basic_streambuf<char> {
+public:
+    /// @brief Constructs a stream buffer appending to \p container.
+    explicit ContainerOutputStreamBuffer(Container& container) : _container(container) {}
+
+protected:
+    /// @brief Appends \p count characters starting at \p chars to the container.
+    std::streamsize xsputn(char const* chars, std::streamsize count) override {
+        _container.append(chars, static_cast<size_t>(count));
+        return count;
+    }
+
+    /// @brief Appends a single character to the container.
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            _container.push_back(traits_type::to_char_type(ch));
+        }
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    Container& _container; ///< The container written into.
+};
+
+/// @brief Input stream buffer reading directly from a contiguous range of characters without copying it.
+class SpanInputStreamBuffer : public std::basic_streambuf<char> {
+public:
+    /// @brief Constructs a stream buffer reading the \p size characters starting at \p data.
+    SpanInputStreamBuffer(char const* data, size_t size) {
+        // std::basic_streambuf requires non-const pointers for the get area, but never writes through them.
+        char* begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+};
+
+/// @brief Output stream buffer which discards all written characters and only counts them. Used to determine the size
+/// of a serialized object before allocating the buffer for it.
+class CountingStreamBuffer : public std::basic_streambuf<char> {
+public:
+    /// @brief Returns the number of characters written so far.
+    size_t count() const {
+        return _count;
+    }
+
+protected:
+    /// @brief Counts \p count characters.
+    std::streamsize xsputn(char const*, std::streamsize count) override {
+        _count += static_cast<size_t>(count);
+        return count;
+    }
+
+    /// @brief Counts a single character.
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            ++_count;
+        }
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    size_t _count = 0; ///< Number of characters written so far.
+};
+
+/// @brief Tag type for \ref kamping::reserve_serialized_size.
+struct reserve_serialized_size_tag {};
 
 /// @brief Buffer holding serialized data.
 ///
-/// This uses [`cereal`](https://uscilab.github.io/cereal/) to serialize and deserialize objects.
+/// This uses [`cereal`](https://uscilab.github.io/cereal/) to serialize and deserialize objects. If \ref
+/// PackingOutputArchive or \ref PackingInputArchive is used, objects are packed using KaMPIng's native packing format
+/// directly into (or unpacked directly from) the buffer without going through a stream.
 ///
 /// @tparam OutArchive Type of the archive to use for serialization.
 /// @tparam InArchive Type of the archive to use for deserialization.
@@ -39,6 +124,12 @@ class SerializationBuffer {
 private:
     std::basic_string<char, std::char_traits<char>, Allocator> _data; ///< Buffer holding the serialized data.
     DataBufferType _object; ///< Object to de/serialize encapsulated in a \ref GenericDataBuffer.
+    bool _reserve_serialized_size = false; ///< Whether to determine the exact serialized size before serializing.
+
+    static constexpr bool packs_directly =
+        std::is_same_v<OutArchive, PackingOutputArchive>; ///< Whether the native packing format is used.
+    static constexpr bool unpacks_directly =
+        std::is_same_v<InArchive, PackingInputArchive>; ///< Whether the native packing format is used.
 
 public:
     using data_type =
@@ -48,14 +139,90 @@ public:
     /// serialize/deserialize into.
     SerializationBuffer(DataBufferType&& object) : _data(), _object(std::move(object)) {}
 
-    /// @brief Serialize the object into the character buffer stored internally.
+    /// @brief Enables a size-estimation pass before serialization. The object is first serialized into a stream which
+    /// only counts the written bytes, then the exact amount of memory is reserved and the object is serialized again.
+    /// This trades a second serialization pass for avoiding the reallocations (and their temporary memory overhead)
+    /// while the buffer grows, which pays off for large objects.
+    void reserve_serialized_size() {
+        _reserve_serialized_size = true;
+    }
+
+    /// @brief Serialize the object directly into the character buffer stored internally.
     void serialize() {
-        std::basic_stringstream<char, std::char_traits<char>, Allocator> buffer;
-        {
-            OutArchive archive(buffer);
-            archive(_object.underlying());
+        if constexpr (packs_directly) {
+            // The packed size is cheap to compute, hence the buffer is always allocated exactly once.
+            _data.resize(packed_size(_object.underlying()));
+            pack(_object.underlying(), _data.data());
+        } else {
+            _data.clear();
+            if (_reserve_serialized_size) {
+                CountingStreamBuffer counter;
+                {
+                    std::ostream stream(&counter);
+                    OutArchive   archive(stream);
+                    archive(_object.underlying());
+                }
+                _data.reserve(counter.count());
+            }
+            ContainerOutputStreamBuffer<decltype(_data)> stream_buffer(_data);
+            std::ostream                                 stream(&stream_buffer);
+            {
+                OutArchive archive(stream);
+                archive(_object.underlying());
+            }
+        }
+    }
+
+    /// @brief Serializes each element of the encapsulated range on its own directly into the character buffer stored
+    /// internally, such that the serialized elements are stored back to back. Afterwards, `counts[i]` contains the
+    /// number of bytes occupied by the `i`-th element. Each element is written by a separate archive, which allows
+    /// deserializing the elements independently of each other.
+    ///
+    /// This is used by vectorized collectives such as \c alltoallv, where the `i`-th element is sent to rank `i`.
+    /// @param counts Container which is resized to the number of elements and receives the number of bytes of each
+    /// serialized element.
+    template <typename Counts>
+    void serialize_each(Counts& counts) {
+        using count_type    = typename Counts::value_type;
+        auto const& objects = _object.underlying();
+        counts.resize(std::size(objects));
+        if constexpr (packs_directly) {
+            // one pass to compute the sizes, then all elements are packed into a buffer allocated exactly once
+            size_t total_size = 0;
+            size_t i          = 0;
+            for (auto const& object: objects) {
+                size_t const object_size = packed_size(object);
+                counts[i++]              = asserting_cast<count_type>(object_size);
+                total_size += object_size;
+            }
+            _data.resize(total_size);
+            char* out = _data.data();
+            for (auto const& object: objects) {
+                out = pack(object, out);
+            }
+        } else {
+            _data.clear();
+            if (_reserve_serialized_size) {
+                CountingStreamBuffer counter;
+                std::ostream         stream(&counter);
+                for (auto const& object: objects) {
+                    OutArchive archive(stream);
+                    archive(object);
+                }
+                _data.reserve(counter.count());
+            }
+            ContainerOutputStreamBuffer<decltype(_data)> stream_buffer(_data);
+            std::ostream                                 stream(&stream_buffer);
+            size_t                                       i = 0;
+            for (auto const& object: objects) {
+                size_t const begin = _data.size();
+                {
+                    OutArchive archive(stream);
+                    archive(object);
+                }
+                counts[i++] = asserting_cast<count_type>(_data.size() - begin);
+            }
         }
-        _data = buffer.str();
     }
 
     /// @brief Extract the \ref GenericDataBuffer containing the encapsulated object.
@@ -65,14 +232,31 @@ public:
 
     /// @brief Deserialize from the character buffer stored internally into the encapsulated object.
     void deserialize() {
-        std::istringstream buffer(std::string(_data.begin(), _data.end()));
-        {
-            InArchive archive(buffer);
-            archive(_object.underlying());
+        deserialize_from(_data.data(), _data.size());
+    }
+
+    /// @brief Deserialize from \p size characters starting at \p data into the encapsulated object. This allows
+    /// deserializing data received into an external buffer without copying it into this buffer first.
+    void deserialize_from(char const* data, size_t size) {
+        if constexpr (unpacks_directly) {
+            unpack(data, size, _object.underlying());
+        } else {
+            SpanInputStreamBuffer stream_buffer(data, size);
+            std::istream          stream(&stream_buffer);
+            {
+                InArchive archive(stream);
+                archive(_object.underlying());
+            }
         }
     }
 
-    using value_type = char; ///< Type of the elements in the buffer.
+    using value_type       = char;       ///< Type of the elements in the buffer.
+    using out_archive_type = OutArchive; ///< Type of the archive used for serialization.
+    using in_archive_type  = InArchive;  ///< Type of the archive used for deserialization.
+    using allocator_type   = Allocator;  ///< Type of the allocator used for the serialized data.
+    /// @brief Type of the encapsulated object.
+    using object_type =
+        std::remove_const_t<std::remove_reference_t<decltype(std::declval<DataBufferType&>().underlying())>>;
 
     /// @brief Access the underlying buffer.
     char* data() noexcept {
@@ -95,7 +279,6 @@ public:
         return _data.size();
     }
 };
-#endif
 
 /// @brief Tag type to identify serialization support.
 struct serialization_support_tag {};
@@ -103,11 +286,9 @@ struct serialization_support_tag {};
 /// @brief Type trait to check if a type is a serialization buffer.
 template <typename>
 constexpr bool is_serialization_buffer_v_impl = false;
-#ifdef KAMPING_ENABLE_SERIALIZATION
 /// @brief Type trait to check if a type is a serialization buffer.
 template <typename... Args>
 constexpr bool is_serialization_buffer_v_impl<SerializationBuffer<Args...>> = true;
-#endif
 
 /// @brief Type trait to check if a type is a serialization buffer.
 template <typename T>
@@ -127,8 +308,123 @@ auto deserialization_repack(BufferType buffer) {
         return buffer;
     }
 }
+/// @brief Creates a serialization buffer for an object which is only serialized and sent.
+/// @tparam OutArchive Type of the archive to use for serialization.
+/// @tparam InArchive Type of the archive to use for deserialization on the receiving side (may be \c void).
+/// @tparam Allocator Type of the allocator to use for the buffer holding the serialized data.
+template <typename OutArchive, typename InArchive, typename Allocator, typename T>
+auto make_send_serialization_buffer(T const& data) {
+    GenericDataBuffer<
+        T,
+        ParameterType,
+        ParameterType::send_buf,
+        BufferModifiability::constant,
+        BufferOwnership::referencing,
+        BufferType::in_buffer>
+        buffer(data);
+    return SerializationBuffer<OutArchive, InArchive, Allocator, decltype(buffer)>{std::move(buffer)};
+}
+
+/// @brief Creates a serialization buffer for an object which is serialized and deserialized (see \ref
+/// kamping::as_serialized(T&&)).
+/// @tparam OutArchive Type of the archive to use for serialization.
+/// @tparam InArchive Type of the archive to use for deserialization.
+/// @tparam Allocator Type of the allocator to use for the buffer holding the serialized data.
+template <typename OutArchive, typename InArchive, typename Allocator, typename T>
+auto make_send_recv_serialization_buffer(T&& data) {
+    if constexpr (std::is_rvalue_reference_v<T&&>) {
+        GenericDataBuffer<
+            std::remove_reference_t<T>,
+            ParameterType,
+            ParameterType::send_recv_buf,
+            BufferModifiability::modifiable,
+            BufferOwnership::owning,
+            BufferType::in_out_buffer>
+            buffer(data);
+        return SerializationBuffer<OutArchive, InArchive, Allocator, decltype(buffer)>{std::move(buffer)};
+    } else {
+        GenericDataBuffer<
+            std::remove_reference_t<T>,
+            ParameterType,
+            ParameterType::send_recv_buf,
+            BufferModifiability::modifiable,
+            BufferOwnership::referencing,
+            BufferType::in_out_buffer>
+            buffer(data);
+        return SerializationBuffer<OutArchive, InArchive, Allocator, decltype(buffer)>{std::move(buffer)};
+    }
+}
+
+/// @brief Creates a serialization buffer for an object the received data is deserialized into (see \ref
+/// kamping::as_deserializable(T&&)).
+/// @tparam InArchive Type of the archive to use for deserialization.
+/// @tparam Allocator Type of the allocator to use for the buffer holding the serialized data.
+template <typename InArchive, typename Allocator, typename T>
+auto make_recv_serialization_buffer(T&& object) {
+    if constexpr (std::is_rvalue_reference_v<T&&>) {
+        GenericDataBuffer<
+            std::remove_reference_t<T>,
+            ParameterType,
+            ParameterType::recv_buf,
+            BufferModifiability::modifiable,
+            BufferOwnership::owning,
+            BufferType::out_buffer>
+            buffer(std::move(object));
+        return SerializationBuffer<void, InArchive, Allocator, decltype(buffer)>(std::move(buffer));
+    } else {
+        GenericDataBuffer<
+            std::remove_reference_t<T>,
+            ParameterType,
+            ParameterType::recv_buf,
+            BufferModifiability::modifiable,
+            BufferOwnership::referencing,
+            BufferType::out_buffer>
+            buffer(object);
+        return SerializationBuffer<void, InArchive, Allocator, decltype(buffer)>(std::move(buffer));
+    }
+}
+
+/// @brief The archive used to deserialize data which has been serialized by a serialization buffer with input archive
+/// \p InArchive. If no input archive has been specified (\c void), cereal's binary archive is used.
+template <typename InArchive>
+struct in_archive_or_default {
+    using type = InArchive; ///< The archive to use.
+};
+
+#ifdef KAMPING_ENABLE_SERIALIZATION
+/// @brief The archive used to deserialize data if no input archive has been specified.
+template <>
+struct in_archive_or_default<void> {
+    using type = cereal::BinaryInputArchive; ///< The archive to use.
+};
+#endif
+
+/// @brief The archive used to deserialize data which has been serialized by a serialization buffer with input archive
+/// \p InArchive. See \ref in_archive_or_default.
+template <typename InArchive>
+using in_archive_or_default_t = typename in_archive_or_default<InArchive>::type;
 } // namespace internal
+/// @brief Tag which can be passed as second argument to \ref as_serialized() to determine the exact size of the
+/// serialized data in a separate pass before serializing, such that the buffer holding the serialized data is allocated
+/// only once.
+inline constexpr internal::reserve_serialized_size_tag reserve_serialized_size{};
+
 #ifdef KAMPING_ENABLE_SERIALIZATION
+/// @brief Computes the number of bytes \p data occupies when serialized with \p Archive, without allocating memory for
+/// the serialized data.
+/// @tparam Archive Type of the archive to use for serialization. Default is `cereal::BinaryOutputArchive`.
+/// @tparam T Type of the object to serialize.
+template <typename Archive = cereal::BinaryOutputArchive, typename T>
+size_t serialized_size(T const& data) {
+    internal::CountingStreamBuffer counter;
+    {
+        std::ostream stream(&counter);
+        Archive      archive(stream);
+        archive(data);
+    }
+    return counter.count();
+}
+
 /// @brief Serializes an object using [`cereal`](https://uscilab.github.io/cereal/).
 /// @tparam Archive Type of the archive to use for serialization (see
 /// https://uscilab.github.io/cereal/serialization_archives.html). Default is `cereal::BinaryOutputArchive`.
@@ -137,16 +433,7 @@ auto deserialization_repack(BufferType buffer) {
 /// @tparam T Type of the object to serialize.
 template <typename Archive = cereal::BinaryOutputArchive, typename Allocator = std::allocator<char>, typename T>
 auto as_serialized(T const& data) {
-    internal::GenericDataBuffer<
-        T,
-        internal::ParameterType,
-        internal::ParameterType::send_buf,
-        internal::BufferModifiability::constant,
-        internal::BufferOwnership::referencing,
-        internal::BufferType::in_buffer>
-        buffer(data);
-
-    return internal::SerializationBuffer<Archive, void, Allocator, decltype(buffer)>{std::move(buffer)};
+    return internal::make_send_serialization_buffer<Archive, void, Allocator>(data);
 }
 
 /// @brief Serializes and deserializes an object using [`cereal`](https://uscilab.github.io/cereal/).
@@ -165,27 +452,41 @@ template <
     typename Allocator  = std::allocator<char>,
     typename T>
 auto as_serialized(T&& data) {
-    if constexpr (std::is_rvalue_reference_v<T&&>) {
-        internal::GenericDataBuffer<
-            std::remove_reference_t<T>,
-            internal::ParameterType,
-            internal::ParameterType::send_recv_buf,
-            internal::BufferModifiability::modifiable,
-            internal::BufferOwnership::owning,
-            internal::BufferType::in_out_buffer>
-            buffer(data);
-        return internal::SerializationBuffer<OutArchive, InArchive, Allocator, decltype(buffer)>{std::move(buffer)};
-    } else {
-        internal::GenericDataBuffer<
-            std::remove_reference_t<T>,
-            internal::ParameterType,
-            internal::ParameterType::send_recv_buf,
-            internal::BufferModifiability::modifiable,
-            internal::BufferOwnership::referencing,
-            internal::BufferType::in_out_buffer>
-            buffer(data);
-        return internal::SerializationBuffer<OutArchive, InArchive, Allocator, decltype(buffer)>{std::move(buffer)};
-    }
+    return internal::make_send_recv_serialization_buffer<OutArchive, InArchive, Allocator>(std::forward<T>(data));
+}
+
+/// @brief Serializes an object using [`cereal`](https://uscilab.github.io/cereal/). Before serializing, the exact size
+/// of the serialized data is determined in a separate pass (see \ref serialized_size()), such that the buffer holding
+/// the serialized data is allocated exactly once.
+/// @tparam Archive Type of the archive to use for serialization. Default is `cereal::BinaryOutputArchive`.
+/// @tparam Allocator Type of the allocator to use for the buffer holding the serialized data. Default is
+/// `std::allocator<char>`.
+/// @tparam T Type of the object to serialize.
+template <typename Archive = cereal::BinaryOutputArchive, typename Allocator = std::allocator<char>, typename T>
+auto as_serialized(T const& data, internal::reserve_serialized_size_tag) {
+    auto buffer = as_serialized<Archive, Allocator>(data);
+    buffer.reserve_serialized_size();
+    return buffer;
+}
+
+/// @brief Serializes and deserializes an object using [`cereal`](https://uscilab.github.io/cereal/). Before
+/// serializing, the exact size of the serialized data is determined in a separate pass (see \ref serialized_size()),
+/// such that the buffer holding the serialized data is allocated exactly once. See \ref as_serialized(T&&) for the
+/// semantics of passing rvalues and lvalues.
+/// @tparam OutArchive Type of the archive to use for serialization. Default is `cereal::BinaryOutputArchive`.
+/// @tparam InArchive Type of the archive to use for deserialization. Default is `cereal::BinaryInputArchive`.
+/// @tparam Allocator Type of the allocator to use for the buffer holding the serialized data. Default is
+/// `std::allocator<char>`.
+/// @tparam T Type of the object to serialize.
+template <
+    typename OutArchive = cereal::BinaryOutputArchive,
+    typename InArchive  = cereal::BinaryInputArchive,
+    typename Allocator  = std::allocator<char>,
+    typename T>
+auto as_serialized(T&& data, internal::reserve_serialized_size_tag) {
+    auto buffer = as_serialized<OutArchive, InArchive, Allocator>(std::forward<T>(data));
+    buffer.reserve_serialized_size();
+    return buffer;
 }
 
 /// @brief Deserializes the received data using [`cereal`](https://uscilab.github.io/cereal/) and returns it in the
@@ -197,15 +498,7 @@ auto as_serialized(T&& data) {
 /// `std::allocator<char>`.
 template <typename T, typename Archive = cereal::BinaryInputArchive, typename Allocator = std::allocator<char>>
 auto as_deserializable() {
-    internal::GenericDataBuffer<
-        T,
-        internal::ParameterType,
-        internal::ParameterType::recv_buf,
-        internal::BufferModifiability::modifiable,
-        internal::BufferOwnership::owning,
-        internal::BufferType::out_buffer>
-        buffer{T{}};
-    return internal::SerializationBuffer<void, Archive, Allocator, decltype(buffer)>{std::move(buffer)};
+    return internal::make_recv_serialization_buffer<Archive, Allocator>(T{});
 }
 
 /// @brief Deserializes the received data using [`cereal`](https://uscilab.github.io/cereal/) into the input object.
@@ -218,28 +511,154 @@ auto as_deserializable() {
 /// @tparam T Type to deserialize into.
 template <typename Archive = cereal::BinaryInputArchive, typename Allocator = std::allocator<char>, typename T>
 auto as_deserializable(T&& object) {
-    if constexpr (std::is_rvalue_reference_v<T&&>) {
-        internal::GenericDataBuffer<
-            std::remove_reference_t<T>,
-            internal::ParameterType,
-            internal::ParameterType::recv_buf,
-            internal::BufferModifiability::modifiable,
-            internal::BufferOwnership::owning,
-            internal::BufferType::out_buffer>
-            buffer(std::move(object));
-        return internal::SerializationBuffer<void, Archive, Allocator, decltype(buffer)>(std::move(buffer));
-    } else {
-        internal::GenericDataBuffer<
-            std::remove_reference_t<T>,
-            internal::ParameterType,
-            internal::ParameterType::recv_buf,
-            internal::BufferModifiability::modifiable,
-            internal::BufferOwnership::referencing,
-            internal::BufferType::out_buffer>
-            buffer(object);
-        return internal::SerializationBuffer<void, Archive, Allocator, decltype(buffer)>(std::move(buffer));
-    }
+    return internal::make_recv_serialization_buffer<Archive, Allocator>(std::forward<T>(object));
 }
 #endif
 
+/// @brief Packs an object using KaMPIng's native packing format (see \ref packing.hpp). This is a fast alternative to
+/// \ref as_serialized() for (nested) containers of trivially copyable types, e.g., `std::vector<std::vector<int>>`,
+/// `std::vector<std::string>` or `std::pair<std::vector<T>, std::vector<U>>`: the packed size is computed in a single
+/// pass, the buffer is allocated once and each contiguous block is copied with a single \c std::memcpy. Does not
+/// require cereal.
+///
+/// On the receiving side, the data has to be unpacked using \ref as_unpackable().
+/// @tparam Allocator Type of the allocator to use for the buffer holding the packed data. Default is
+/// `std::allocator<char>`.
+/// @tparam T Type of the object to pack.
+template <typename Allocator = std::allocator<char>, typename T>
+auto as_packed(T const& data) {
+    return internal::make_send_serialization_buffer<PackingOutputArchive, PackingInputArchive, Allocator>(data);
+}
+
+/// @brief Packs and unpacks an object using KaMPIng's native packing format. If the input object is an rvalue
+/// reference, the unpacked object is returned by the surrounding communication call. If the input object is an lvalue
+/// reference, the input object is modified in place. See \ref as_packed(T const&).
+/// @tparam Allocator Type of the allocator to use for the buffer holding the packed data. Default is
+/// `std::allocator<char>`.
+/// @tparam T Type of the object to pack.
+template <typename Allocator = std::allocator<char>, typename T>
+auto as_packed(T&& data) {
+    return internal::make_send_recv_serialization_buffer<PackingOutputArchive, PackingInputArchive, Allocator>(
+        std::forward<T>(data)
+    );
+}
+
+/// @brief Unpacks the received data, which has been packed using \ref as_packed(), into a new object of type \p T,
+/// which is returned in the result of the surrounding communication call.
+/// @tparam T Type to unpack into.
+/// @tparam Allocator Type of the allocator to use for the buffer holding the packed data. Default is
+/// `std::allocator<char>`.
+template <typename T, typename Allocator = std::allocator<char>>
+auto as_unpackable() {
+    return internal::make_recv_serialization_buffer<PackingInputArchive, Allocator>(T{});
+}
+
+/// @brief Unpacks the received data, which has been packed using \ref as_packed(), into the input object. If the
+/// input object is an rvalue reference, the result is returned by the surrounding communication call. If the input
+/// object is an lvalue reference, the input object is modified in place.
+/// @tparam Allocator Type of the allocator to use for the buffer holding the packed data. Default is
+/// `std::allocator<char>`.
+/// @tparam T Type to unpack into.
+template <typename Allocator = std::allocator<char>, typename T>
+auto as_unpackable(T&& object) {
+    return internal::make_recv_serialization_buffer<PackingInputArchive, Allocator>(std::forward<T>(object));
+}
+
+/// @brief Result of a vectorized collective (\c alltoallv, \c gatherv, \c allgatherv) operating on serialized data.
+///
+/// Holds the serialized objects received from all ranks in a single contiguous buffer together with the number of
+/// bytes received from each rank and their offsets. Objects are only deserialized on request, i.e., the cost for
+/// deserialization is only paid for the sources which are actually accessed.
+///
+/// Example:
+/// ```cpp
+/// std::vector<std::string> messages(comm.size()); // messages[i] is sent to rank i
+/// auto received = comm.alltoallv(send_buf(as_serialized(messages)));
+/// for (size_t source = 0; source < received.size(); ++source) {
+///     std::string message = received.deserialize(source);
+/// }
+/// ```
+///
+/// @tparam T Type of the object received from each rank.
+/// @tparam InArchive Type of the archive to use for deserialization.
+/// @tparam Allocator Type of the allocator used for the buffer holding the serialized data.
+template <typename T, typename InArchive, typename Allocator = std::allocator<char>>
+class DeserializableBlocks {
+public:
+    using value_type     = T;         ///< Type of the object received from each rank.
+    using allocator_type = Allocator; ///< Type of the allocator used for the buffer holding the serialized data.
+
+    /// @brief Constructs an object without any received data, as returned on non-root ranks by \c gatherv.
+    DeserializableBlocks() = default;
+
+    /// @brief Constructs the object from the serialized data received from all ranks.
+    /// @param data The serialized objects of all ranks.
+    /// @param counts The number of bytes received from each rank.
+    /// @param displs The offset of the serialized object of each rank in \p data.
+    DeserializableBlocks(std::vector<char, Allocator> data, std::vector<int> counts, std::vector<int> displs)
+        : _data(std::move(data)),
+          _counts(std::move(counts)),
+          _displs(std::move(displs)) {}
+
+    /// @brief Returns the number of received objects, i.e., the number of ranks data has been received from.
+    size_t size() const {
+        return _counts.size();
+    }
+
+    /// @brief Returns \c true if no objects have been received.
+    [[nodiscard]] bool empty() const {
+        return _counts.empty();
+    }
+
+    /// @brief Deserializes and returns the object received from rank \p source.
+    T deserialize(size_t source) const {
+        T object{};
+        deserialize(source, object);
+        return object;
+    }
+
+    /// @brief Deserializes the object received from rank \p source into \p object.
+    void deserialize(size_t source, T& object) const {
+        auto const block = serialized()[source];
+        if constexpr (std::is_same_v<InArchive, PackingInputArchive>) {
+            unpack(block.data(), block.size(), object);
+        } else {
+            internal::SpanInputStreamBuffer stream_buffer(block.data(), block.size());
+            std::istream                    stream(&stream_buffer);
+            InArchive                       archive(stream);
+            archive(object);
+        }
+    }
+
+    /// @brief Deserializes the objects received from all ranks.
+    /// @return A \c std::vector containing the object received from rank \c i at position \c i.
+    std::vector<T> deserialize_all() const {
+        std::vector<T> objects(size());
+        for (size_t source = 0; source < size(); ++source) {
+            deserialize(source, objects[source]);
+        }
+        return objects;
+    }
+
+    /// @brief Returns a view on the serialized (not yet deserialized) data received from each rank.
+    RaggedView<char const> serialized() const {
+        return RaggedView<char const>(_data, _counts, _displs);
+    }
+
+    /// @brief Returns the number of bytes received from each rank.
+    std::vector<int> const& counts() const {
+        return _counts;
+    }
+
+    /// @brief Returns the offset of the data received from each rank in the buffer holding the serialized data.
+    std::vector<int> const& displs() const {
+        return _displs;
+    }
+
+private:
+    std::vector<char, Allocator> _data;   ///< Serialized objects of all ranks.
+    std::vector<int>             _counts; ///< Number of bytes received from each rank.
+    std::vector<int>             _displs; ///< Offset of the object received from each rank.
+};
+
 } // namespace kamping
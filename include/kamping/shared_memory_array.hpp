@@ -0,0 +1,171 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief An array in shared memory which can be accessed directly by all ranks on the same node.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/collectives/allreduce.hpp"
+#include "kamping/collectives/barrier.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/error_handling.hpp"
+#include "kamping/span.hpp"
+
+namespace kamping {
+
+/// @brief An array in shared memory, allocated using \c MPI_Win_allocate_shared, which is split into one segment per
+/// rank of a node-local communicator. All ranks of the node can directly read and write all segments.
+///
+/// Writes to the array only become visible to other ranks after all of them called \ref sync(). The segments are
+/// stored contiguously in the order of the ranks, such that \ref all() spans all segments.
+///
+/// @tparam T The type of the elements. Has to be trivially copyable, as the elements are neither constructed nor
+/// destroyed.
+template <typename T>
+class SharedMemoryArray {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be stored in shared memory.");
+
+public:
+    /// @brief Allocates an array in which this rank owns a segment of \p local_size elements. This is a collective
+    /// operation on \p comm, which is split into the ranks sharing memory with this rank.
+    /// @param comm The communicator.
+    /// @param local_size The number of elements in the segment of this rank.
+    template <typename Comm>
+    SharedMemoryArray(Comm const& comm, size_t local_size)
+        : SharedMemoryArray(
+              NodeLocal{},
+              Communicator<>(comm.split_to_shared_memory().disown_mpi_communicator(), true),
+              local_size
+          ) {}
+
+    /// @brief Allocates an array in which this rank owns a segment of \p local_size elements on a communicator which
+    /// has already been split into the ranks sharing memory. This is a collective operation on \p node_comm.
+    /// @param node_comm The node-local communicator, e.g., obtained using Communicator::split_to_shared_memory(). The
+    /// array takes ownership of it.
+    /// @param local_size The number of elements in the segment of this rank.
+    static SharedMemoryArray from_node_communicator(Communicator<> node_comm, size_t local_size) {
+        return SharedMemoryArray(NodeLocal{}, std::move(node_comm), local_size);
+    }
+
+    /// @brief Copying is not allowed.
+    SharedMemoryArray(SharedMemoryArray const&) = delete;
+    /// @brief Copying is not allowed.
+    SharedMemoryArray& operator=(SharedMemoryArray const&) = delete;
+
+    /// @brief Move constructor.
+    SharedMemoryArray(SharedMemoryArray&& other) noexcept
+        : _node_comm(std::move(other._node_comm)),
+          _win(std::exchange(other._win, MPI_WIN_NULL)),
+          _local(other._local),
+          _all(other._all) {}
+
+    /// @brief Move assignment.
+    SharedMemoryArray& operator=(SharedMemoryArray&& other) noexcept {
+        _node_comm.swap(other._node_comm);
+        std::swap(_win, other._win);
+        std::swap(_local, other._local);
+        std::swap(_all, other._all);
+        return *this;
+    }
+
+    /// @brief Frees the shared memory. This is a collective operation on the node-local communicator.
+    ~SharedMemoryArray() {
+        if (_win != MPI_WIN_NULL) {
+            MPI_Win_unlock_all(_win);
+            MPI_Win_free(&_win);
+        }
+    }
+
+    /// @brief Returns the segment owned by this rank.
+    Span<T> local() const {
+        return _local;
+    }
+
+    /// @brief Returns the segment owned by rank \p node_rank of the node-local communicator.
+    Span<T> segment(size_t node_rank) const {
+        return query_segment(asserting_cast<int>(node_rank));
+    }
+
+    /// @brief Returns all segments, ordered by the ranks of the node-local communicator.
+    Span<T> all() const {
+        return _all;
+    }
+
+    /// @brief Makes all previous writes to the array visible to all ranks of the node and vice versa. This is a
+    /// collective operation on the node-local communicator.
+    void sync() const {
+        MPI_Win_sync(_win);
+        _node_comm.barrier();
+        MPI_Win_sync(_win);
+    }
+
+    /// @brief Returns the node-local communicator.
+    Communicator<> const& node_communicator() const {
+        return _node_comm;
+    }
+
+    /// @brief Returns the underlying MPI window.
+    MPI_Win mpi_window() const {
+        return _win;
+    }
+
+private:
+    /// @brief Tag selecting the constructor which does not split the communicator.
+    struct NodeLocal {};
+
+    /// @brief Allocates an array in which this rank owns a segment of \p local_size elements on the node-local
+    /// communicator \p node_comm.
+    SharedMemoryArray(NodeLocal, Communicator<> node_comm, size_t local_size) : _node_comm(std::move(node_comm)) {
+        void*     base;
+        int const err = MPI_Win_allocate_shared(
+            asserting_cast<MPI_Aint>(local_size * sizeof(T)),
+            asserting_cast<int>(sizeof(T)),
+            MPI_INFO_NULL,
+            _node_comm.mpi_communicator(),
+            &base,
+            &_win
+        );
+        THROW_IF_MPI_ERROR(err, MPI_Win_allocate_shared);
+        _local = Span<T>(static_cast<T*>(base), local_size);
+        // A single passive target epoch for the lifetime of the array allows synchronizing using MPI_Win_sync.
+        MPI_Win_lock_all(MPI_MODE_NOCHECK, _win);
+        size_t const total_size = _node_comm.allreduce_single(send_buf(local_size), op(ops::plus<>{}));
+        // MPI_PROC_NULL queries the first non-empty segment
+        _all = Span<T>(total_size == 0 ? nullptr : query_segment(MPI_PROC_NULL).data(), total_size);
+    }
+
+    /// @brief Returns the segment of \p node_rank using \c MPI_Win_shared_query.
+    Span<T> query_segment(int node_rank) const {
+        MPI_Aint  size;
+        int       disp_unit;
+        void*     base;
+        int const err = MPI_Win_shared_query(_win, node_rank, &size, &disp_unit, &base);
+        THROW_IF_MPI_ERROR(err, MPI_Win_shared_query);
+        return Span<T>(static_cast<T*>(base), static_cast<size_t>(size) / sizeof(T));
+    }
+
+    Communicator<> _node_comm;          ///< The node-local communicator.
+    MPI_Win        _win = MPI_WIN_NULL; ///< The shared memory window.
+    Span<T>        _local;              ///< The segment of this rank.
+    Span<T>        _all;                ///< All segments.
+};
+
+} // namespace kamping
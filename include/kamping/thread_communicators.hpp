@@ -0,0 +1,169 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Communicators and request pools for each thread of a multi-threaded application, such that threads can
+/// communicate concurrently without locking and without interfering with each other.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/communicator.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/request_pool.hpp"
+
+namespace kamping {
+
+namespace internal {
+/// @brief The assumed size of a cache line in bytes, used to avoid false sharing between per-thread objects.
+constexpr size_t cache_line_size = 64;
+} // namespace internal
+
+/// @brief A set of request pools, one for each thread.
+///
+/// Each thread only uses its own pool, so no synchronization is necessary when obtaining requests. The pools are
+/// stored on different cache lines to avoid false sharing.
+///
+/// @tparam DefaultContainerType The default container type of the pools.
+template <template <typename...> typename DefaultContainerType = std::vector>
+class ThreadLocalRequestPool {
+public:
+    /// @brief Creates \p num_threads empty request pools.
+    explicit ThreadLocalRequestPool(size_t num_threads) : _pools(num_threads) {}
+
+    /// @brief Returns the number of threads.
+    size_t num_threads() const {
+        return _pools.size();
+    }
+
+    /// @brief Returns the request pool of thread \p thread_id, which may only be used by this thread.
+    RequestPool<DefaultContainerType>& local(size_t thread_id) {
+        KAMPING_ASSERT(thread_id < num_threads(), "Invalid thread id " << thread_id << ".", assert::light);
+        return _pools[thread_id].pool;
+    }
+
+    /// @brief Returns the number of requests stored in the pools of all threads.
+    size_t num_requests() const {
+        size_t num_requests = 0;
+        for (auto const& pool: _pools) {
+            num_requests += pool.pool.num_requests();
+        }
+        return num_requests;
+    }
+
+    /// @brief Waits for all requests in the pools of all threads to complete. This must not be called concurrently
+    /// with the usage of the pools by their threads.
+    void wait_all() {
+        for (auto& pool: _pools) {
+            pool.pool.wait_all();
+        }
+    }
+
+private:
+    /// @brief A request pool occupying whole cache lines.
+    struct alignas(internal::cache_line_size) AlignedPool {
+        RequestPool<DefaultContainerType> pool; ///< The request pool.
+    };
+
+    std::vector<AlignedPool> _pools; ///< The pool of each thread.
+};
+
+/// @brief A duplicate of a communicator for each thread of a multi-threaded application.
+///
+/// Threads sharing a single communicator share its state (e.g., the default tag) and messages sent by different
+/// threads with the same tag may be received by the wrong thread. Instead, each thread uses its own communicator,
+/// which is a duplicate of the original one, so messages of different threads never match each other, and each
+/// thread can send and receive concurrently without locking (if MPI is initialized with \ref ThreadLevel::multiple).
+/// The communicator of thread \c i on one rank only communicates with the communicators of thread \c i on the other
+/// ranks. Additionally, each thread has its own \ref RequestPool.
+///
+/// Example using OpenMP:
+/// @code
+/// ThreadCommunicators thread_comms(comm, omp_get_max_threads());
+/// #pragma omp parallel
+/// {
+///     auto& thread_comm = thread_comms.communicator(omp_get_thread_num());
+///     auto& requests    = thread_comms.request_pool(omp_get_thread_num());
+///     thread_comm.isend(send_buf(data), destination(0), request(requests.get_request()));
+///     requests.wait_all();
+/// }
+/// @endcode
+///
+/// @tparam DefaultContainerType The default container type of the communicators.
+/// @tparam Plugins The plugins of the communicators.
+template <
+    template <typename...> typename DefaultContainerType = std::vector,
+    template <typename, template <typename...> typename>
+    typename... Plugins>
+class ThreadCommunicators {
+public:
+    /// @brief The type of the communicators.
+    using communicator_type = Communicator<DefaultContainerType, Plugins...>;
+
+    /// @brief Duplicates \p comm \p num_threads times. This is a collective operation on \p comm, and \p num_threads
+    /// has to be the same on all ranks.
+    /// @param comm The communicator to duplicate. The duplicates use the same root.
+    /// @param num_threads The number of threads.
+    template <typename Comm>
+    ThreadCommunicators(Comm const& comm, size_t num_threads) : _request_pools(num_threads) {
+        _communicators.reserve(num_threads);
+        for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+            MPI_Comm   duplicate;
+            auto const ret = MPI_Comm_dup(comm.mpi_communicator(), &duplicate);
+            comm.mpi_error_hook(ret, "MPI_Comm_dup");
+            _communicators.push_back(AlignedCommunicator{communicator_type(duplicate, comm.root_signed(), true)});
+        }
+    }
+
+    /// @brief Returns the number of threads.
+    size_t num_threads() const {
+        return _communicators.size();
+    }
+
+    /// @brief Returns the communicator of thread \p thread_id, which may only be used by this thread.
+    communicator_type& communicator(size_t thread_id) {
+        KAMPING_ASSERT(thread_id < num_threads(), "Invalid thread id " << thread_id << ".", assert::light);
+        return _communicators[thread_id].comm;
+    }
+
+    /// @brief Returns the communicator of thread \p thread_id, which may only be used by this thread.
+    communicator_type const& communicator(size_t thread_id) const {
+        KAMPING_ASSERT(thread_id < num_threads(), "Invalid thread id " << thread_id << ".", assert::light);
+        return _communicators[thread_id].comm;
+    }
+
+    /// @brief Returns the request pool of thread \p thread_id, which may only be used by this thread.
+    RequestPool<DefaultContainerType>& request_pool(size_t thread_id) {
+        return _request_pools.local(thread_id);
+    }
+
+    /// @brief Returns the request pools of all threads.
+    ThreadLocalRequestPool<DefaultContainerType>& request_pools() {
+        return _request_pools;
+    }
+
+private:
+    /// @brief A communicator occupying whole cache lines.
+    struct alignas(internal::cache_line_size) AlignedCommunicator {
+        communicator_type comm; ///< The communicator.
+    };
+
+    std::vector<AlignedCommunicator>             _communicators; ///< The communicator of each thread.
+    ThreadLocalRequestPool<DefaultContainerType> _request_pools; ///< The request pool of each thread.
+};
+
+} // namespace kamping
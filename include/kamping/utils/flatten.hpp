@@ -12,6 +12,7 @@
 // <https://www.gnu.org/licenses/>.
 
 #pragma once
+#include <iterator>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -19,6 +20,7 @@
 #include <kamping/utils/traits.hpp>
 
 #include "kamping/named_parameters.hpp"
+#include "kamping/result.hpp"
 
 namespace kamping {
 namespace internal {
@@ -206,4 +208,72 @@ template <
 auto with_flattened(Container const& nested_send_buf) {
     return with_flattened<CountContainer>(nested_send_buf, nested_send_buf.size());
 }
+
+/// @brief Splits a flat buffer into a container of containers, i.e. it inverts \ref flatten(). The `counts[i]` elements
+/// starting at `flat_buf[displs[i]]` form the \c i-th nested container.
+///
+/// If \p flat_buf is passed as an rvalue, its elements are moved into the nested containers instead of being copied.
+/// If you only want to access the blocks without materializing separate containers, use a \ref RaggedView instead.
+///
+/// Example:
+/// ```cpp
+/// Communicator comm;
+/// auto [recv_buf, recv_counts, recv_displs] =
+///     comm.alltoallv(send_buf(data), send_counts(counts), recv_counts_out(), recv_displs_out());
+/// std::vector<std::vector<T>> per_rank = unflatten(std::move(recv_buf), recv_counts, recv_displs);
+/// ```
+///
+/// @param flat_buf The flat buffer.
+/// @param counts The number of elements in each nested container.
+/// @param displs The offset of each nested container in \p flat_buf.
+/// @tparam NestedContainer The type of the nested containers, defaults to \c std::vector.
+/// @tparam FlatBuffer The type of the flat buffer.
+/// @tparam Counts The type of the count container.
+/// @tparam Displs The type of the displacement container.
+/// @return A \c std::vector of nested containers with one entry per element of \p counts.
+template <
+    template <typename...> typename NestedContainer = std::vector,
+    typename FlatBuffer,
+    typename Counts,
+    typename Displs>
+auto unflatten(FlatBuffer&& flat_buf, Counts const& counts, Displs const& displs) {
+    using value_type = std::remove_const_t<typename std::remove_reference_t<FlatBuffer>::value_type>;
+    constexpr bool move_elements =
+        !std::is_lvalue_reference_v<FlatBuffer> && !std::is_const_v<std::remove_reference_t<FlatBuffer>>;
+    size_t const                             num_blocks = std::size(counts);
+    std::vector<NestedContainer<value_type>> nested;
+    nested.reserve(num_blocks);
+    auto const* count_ptr = std::data(counts);
+    auto const* displ_ptr = std::data(displs);
+    for (size_t i = 0; i < num_blocks; ++i) {
+        auto first = std::data(flat_buf) + asserting_cast<size_t>(displ_ptr[i]);
+        auto last  = first + asserting_cast<size_t>(count_ptr[i]);
+        if constexpr (move_elements) {
+            nested.emplace_back(std::make_move_iterator(first), std::make_move_iterator(last));
+        } else {
+            nested.emplace_back(first, last);
+        }
+    }
+    return nested;
+}
+
+/// @brief Splits the \c recv_buffer of a result object into a container of containers using the result's \c
+/// recv_counts and \c recv_displs. The received elements are moved out of the result object.
+///
+/// Example:
+/// ```cpp
+/// Communicator comm;
+/// auto per_rank =
+///     unflatten(comm.alltoallv(send_buf(data), send_counts(counts), recv_counts_out(), recv_displs_out()));
+/// ```
+///
+/// @param result The result of a vectorized collective containing \c recv_buf, \c recv_counts and \c recv_displs.
+/// @tparam NestedContainer The type of the nested containers, defaults to \c std::vector.
+/// @tparam Args Automatically deduced template parameters of the result object.
+/// @return A \c std::vector of nested containers with one entry per rank.
+template <template <typename...> typename NestedContainer = std::vector, typename... Args>
+auto unflatten(MPIResult<Args...>&& result) {
+    auto flat_buf = result.extract_recv_buf();
+    return unflatten<NestedContainer>(std::move(flat_buf), result.get_recv_counts(), result.get_recv_displs());
+}
 } // namespace kamping
@@ -0,0 +1,260 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// @brief A non-owning view which interprets a flat buffer together with counts and displacements as a ragged
+/// (CSR-like) array of blocks, one per rank.
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "kamping/span.hpp"
+
+namespace kamping {
+
+/// @brief Non-owning view over a flat buffer partitioned into blocks by a count and a displacement array, as returned
+/// by vectorized collectives such as \c alltoallv, \c allgatherv or \c gatherv.
+///
+/// Block \c i consists of the `counts[i]` elements starting at `data[displs[i]]`. The view does not copy any of the
+/// underlying buffers, therefore it is only valid as long as the viewed buffers are alive and not resized.
+///
+/// Example:
+/// ```cpp
+/// auto result = comm.alltoallv(send_buf(data), send_counts(counts), recv_counts_out(), recv_displs_out());
+/// for (auto block: result.recv_buf_per_source()) {
+///     // block is a Span over the elements received from one rank
+/// }
+/// ```
+///
+/// @tparam T Type of the elements in the viewed buffer (may be const qualified).
+/// @tparam CountType Type of the elements in the count and displacement arrays.
+template <typename T, typename CountType = int>
+class RaggedView {
+public:
+    using value_type = Span<T>; ///< Type of a single block.
+    using size_type  = size_t;  ///< Type used for the number of blocks.
+
+    /// @brief Random access iterator over the blocks of a \ref RaggedView. Dereferencing yields a \ref Span by value.
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag; ///< Iterator category.
+        using value_type        = Span<T>;                         ///< Type of a single block.
+        using difference_type   = std::ptrdiff_t;                  ///< Difference type.
+        using pointer           = void;                            ///< Blocks are created on the fly.
+        using reference         = Span<T>;                         ///< Blocks are returned by value.
+
+        /// @brief Constructs an iterator pointing to block \p index of \p view.
+        constexpr iterator(RaggedView const* view, size_t index) noexcept : _view(view), _index(index) {}
+
+        /// @brief Returns the block the iterator points to.
+        constexpr reference operator*() const {
+            return (*_view)[_index];
+        }
+
+        /// @brief Returns the block \p n positions after the current one.
+        constexpr reference operator[](difference_type n) const {
+            return (*_view)[static_cast<size_t>(static_cast<difference_type>(_index) + n)];
+        }
+
+        /// @brief Pre-increment.
+        constexpr iterator& operator++() noexcept {
+            ++_index;
+            return *this;
+        }
+
+        /// @brief Post-increment.
+        constexpr iterator operator++(int) noexcept {
+            iterator tmp = *this;
+            ++_index;
+            return tmp;
+        }
+
+        /// @brief Pre-decrement.
+        constexpr iterator& operator--() noexcept {
+            --_index;
+            return *this;
+        }
+
+        /// @brief Post-decrement.
+        constexpr iterator operator--(int) noexcept {
+            iterator tmp = *this;
+            --_index;
+            return tmp;
+        }
+
+        /// @brief Advances the iterator by \p n blocks.
+        constexpr iterator& operator+=(difference_type n) noexcept {
+            _index = static_cast<size_t>(static_cast<difference_type>(_index) + n);
+            return *this;
+        }
+
+        /// @brief Moves the iterator back by \p n blocks.
+        constexpr iterator& operator-=(difference_type n) noexcept {
+            return *this += -n;
+        }
+
+        /// @brief Returns an iterator advanced by \p n blocks.
+        friend constexpr iterator operator+(iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        /// @brief Returns an iterator advanced by \p n blocks.
+        friend constexpr iterator operator+(difference_type n, iterator it) noexcept {
+            return it += n;
+        }
+
+        /// @brief Returns an iterator moved back by \p n blocks.
+        friend constexpr iterator operator-(iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        /// @brief Returns the number of blocks between two iterators.
+        friend constexpr difference_type operator-(iterator const& lhs, iterator const& rhs) noexcept {
+            return static_cast<difference_type>(lhs._index) - static_cast<difference_type>(rhs._index);
+        }
+
+        /// @brief Equality comparison.
+        friend constexpr bool operator==(iterator const& lhs, iterator const& rhs) noexcept {
+            return lhs._index == rhs._index;
+        }
+
+        /// @brief Inequality comparison.
+        friend constexpr bool operator!=(iterator const& lhs, iterator const& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+        /// @brief Less-than comparison.
+        friend constexpr bool operator<(iterator const& lhs, iterator const& rhs) noexcept {
+            return lhs._index < rhs._index;
+        }
+
+        /// @brief Greater-than comparison.
+        friend constexpr bool operator>(iterator const& lhs, iterator const& rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        /// @brief Less-or-equal comparison.
+        friend constexpr bool operator<=(iterator const& lhs, iterator const& rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        /// @brief Greater-or-equal comparison.
+        friend constexpr bool operator>=(iterator const& lhs, iterator const& rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        RaggedView const* _view;  ///< The view iterated over.
+        size_t            _index; ///< Index of the current block.
+    };
+
+    /// @brief Constructs a view with no blocks.
+    constexpr RaggedView() noexcept = default;
+
+    /// @brief Constructs a view over the flat buffer \p data partitioned by \p counts and \p displs.
+    ///
+    /// @param data The flat buffer containing the elements of all blocks.
+    /// @param counts The number of elements in each block.
+    /// @param displs The offset of each block in \p data. Must have (at least) as many elements as \p counts.
+    constexpr RaggedView(Span<T> data, Span<CountType const> counts, Span<CountType const> displs) noexcept
+        : _data(data),
+          _counts(counts),
+          _displs(displs) {}
+
+    /// @brief Constructs a view from containers (anything with \c data() and \c size()).
+    template <typename DataRange, typename CountRange, typename DisplRange>
+    constexpr RaggedView(DataRange&& data, CountRange const& counts, DisplRange const& displs)
+        : RaggedView(
+              Span<T>(std::data(data), std::size(data)),
+              Span<CountType const>(std::data(counts), std::size(counts)),
+              Span<CountType const>(std::data(displs), std::size(displs))
+          ) {}
+
+    /// @brief Returns the number of blocks, i.e., the number of ranks data has been received from.
+    constexpr size_type size() const noexcept {
+        return _counts.size();
+    }
+
+    /// @brief Returns \c true if the view contains no blocks.
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return _counts.empty();
+    }
+
+    /// @brief Returns the block belonging to rank \p i as a \ref Span sharing the underlying storage.
+    constexpr Span<T> operator[](size_t i) const {
+        return Span<T>(_data.data() + static_cast<size_t>(_displs[i]), static_cast<size_t>(_counts[i]));
+    }
+
+    /// @brief Returns the block belonging to rank \p i as a \ref Span sharing the underlying storage. Alias for \ref
+    /// operator[]().
+    constexpr Span<T> per_source(size_t i) const {
+        return (*this)[i];
+    }
+
+    /// @brief Returns the number of elements in block \p i.
+    constexpr size_t block_size(size_t i) const {
+        return static_cast<size_t>(_counts[i]);
+    }
+
+    /// @brief Returns the underlying flat buffer.
+    constexpr Span<T> flat() const noexcept {
+        return _data;
+    }
+
+    /// @brief Returns the counts this view has been constructed with.
+    constexpr Span<CountType const> counts() const noexcept {
+        return _counts;
+    }
+
+    /// @brief Returns the displacements this view has been constructed with.
+    constexpr Span<CountType const> displs() const noexcept {
+        return _displs;
+    }
+
+    /// @brief Returns an iterator to the first block.
+    constexpr iterator begin() const noexcept {
+        return iterator(this, 0);
+    }
+
+    /// @brief Returns an iterator past the last block.
+    constexpr iterator end() const noexcept {
+        return iterator(this, size());
+    }
+
+private:
+    Span<T>               _data;   ///< The flat buffer.
+    Span<CountType const> _counts; ///< Number of elements in each block.
+    Span<CountType const> _displs; ///< Offset of each block in the flat buffer.
+};
+
+/// @brief Constructs a \ref RaggedView over the flat buffer \p data partitioned by \p counts and \p displs. The element
+/// and count types are deduced from the passed containers.
+///
+/// @param data The flat buffer (anything with \c data() and \c size()).
+/// @param counts The number of elements in each block.
+/// @param displs The offset of each block in \p data.
+template <typename DataRange, typename CountRange, typename DisplRange>
+auto make_ragged_view(DataRange&& data, CountRange const& counts, DisplRange const& displs) {
+    using value_type = std::remove_pointer_t<decltype(std::data(data))>;
+    using count_type = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(counts))>>;
+    static_assert(
+        std::is_same_v<count_type, std::remove_cv_t<std::remove_pointer_t<decltype(std::data(displs))>>>,
+        "Counts and displacements must have the same value type."
+    );
+    return RaggedView<value_type, count_type>(std::forward<DataRange>(data), counts, displs);
+}
+
+} // namespace kamping
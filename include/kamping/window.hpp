@@ -0,0 +1,732 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief An abstraction around `MPI_Win` for one-sided communication.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kamping/checking_casts.hpp"
+#include "kamping/data_buffer.hpp"
+#include "kamping/error_handling.hpp"
+#include "kamping/group.hpp"
+#include "kamping/mpi_datatype.hpp"
+#include "kamping/named_parameter_check.hpp"
+#include "kamping/named_parameter_selection.hpp"
+#include "kamping/named_parameters.hpp"
+#include "kamping/request.hpp"
+#include "kamping/result.hpp"
+#include "kamping/span.hpp"
+
+namespace kamping {
+
+/// @brief An access and/or exposure epoch on a \ref Window, which is closed when this object is destroyed.
+///
+/// Epochs are opened by \ref Window::fence_epoch(), \ref Window::access_epoch(), \ref Window::exposure_epoch(), \ref
+/// Window::lock_epoch() and \ref Window::lock_all_epoch(). Errors when closing the epoch in the destructor are ignored;
+/// call \ref close() to close the epoch explicitly and check for errors.
+class WindowEpoch {
+public:
+    /// @brief The kind of an epoch, which determines how it is closed.
+    enum class Kind {
+        fence,    ///< Closed by \c MPI_Win_fence.
+        access,   ///< Closed by \c MPI_Win_complete.
+        exposure, ///< Closed by \c MPI_Win_wait.
+        lock,     ///< Closed by \c MPI_Win_unlock.
+        lock_all  ///< Closed by \c MPI_Win_unlock_all.
+    };
+
+    /// @brief Takes over the already opened epoch of kind \p kind on \p win.
+    /// @param win The window.
+    /// @param kind The kind of the epoch.
+    /// @param rank The locked rank (only used for Kind::lock).
+    WindowEpoch(MPI_Win win, Kind kind, int rank = MPI_PROC_NULL) : _win(win), _kind(kind), _rank(rank) {}
+
+    /// @brief Copying is not allowed.
+    WindowEpoch(WindowEpoch const&) = delete;
+    /// @brief Copying is not allowed.
+    WindowEpoch& operator=(WindowEpoch const&) = delete;
+
+    /// @brief Move constructor.
+    WindowEpoch(WindowEpoch&& other) noexcept
+        : _win(std::exchange(other._win, MPI_WIN_NULL)),
+          _kind(other._kind),
+          _rank(other._rank) {}
+
+    /// @brief Move assignment. Closes the epoch held by this object.
+    WindowEpoch& operator=(WindowEpoch&& other) noexcept {
+        end();
+        _win  = std::exchange(other._win, MPI_WIN_NULL);
+        _kind = other._kind;
+        _rank = other._rank;
+        return *this;
+    }
+
+    /// @brief Closes the epoch.
+    ~WindowEpoch() {
+        end();
+    }
+
+    /// @brief Closes the epoch. Afterwards, this object does not refer to an epoch anymore.
+    void close() {
+        switch (std::exchange(_kind, Kind::fence)) {
+            case Kind::fence: {
+                int err = _win == MPI_WIN_NULL ? MPI_SUCCESS : MPI_Win_fence(0, _win);
+                THROW_IF_MPI_ERROR(err, MPI_Win_fence);
+                break;
+            }
+            case Kind::access: {
+                int err = MPI_Win_complete(_win);
+                THROW_IF_MPI_ERROR(err, MPI_Win_complete);
+                break;
+            }
+            case Kind::exposure: {
+                int err = MPI_Win_wait(_win);
+                THROW_IF_MPI_ERROR(err, MPI_Win_wait);
+                break;
+            }
+            case Kind::lock: {
+                int err = MPI_Win_unlock(_rank, _win);
+                THROW_IF_MPI_ERROR(err, MPI_Win_unlock);
+                break;
+            }
+            case Kind::lock_all: {
+                int err = MPI_Win_unlock_all(_win);
+                THROW_IF_MPI_ERROR(err, MPI_Win_unlock_all);
+                break;
+            }
+        }
+        _win = MPI_WIN_NULL;
+    }
+
+private:
+    /// @brief Closes the epoch ignoring errors.
+    void end() noexcept {
+        if (_win == MPI_WIN_NULL) {
+            return;
+        }
+        switch (_kind) {
+            case Kind::fence:
+                MPI_Win_fence(0, _win);
+                break;
+            case Kind::access:
+                MPI_Win_complete(_win);
+                break;
+            case Kind::exposure:
+                MPI_Win_wait(_win);
+                break;
+            case Kind::lock:
+                MPI_Win_unlock(_rank, _win);
+                break;
+            case Kind::lock_all:
+                MPI_Win_unlock_all(_win);
+                break;
+        }
+        _win = MPI_WIN_NULL;
+    }
+
+    MPI_Win _win;  ///< The window, or \c MPI_WIN_NULL if the epoch has been closed.
+    Kind    _kind; ///< The kind of the epoch.
+    int     _rank; ///< The locked rank (only used for Kind::lock).
+};
+
+/// @brief A window of elements of type \p T which can be accessed by other ranks using one-sided communication.
+///
+/// Windows are created collectively using \ref allocate() (memory allocated by MPI), \ref create() (memory provided
+/// by the user) or \ref create_dynamic() (memory attached later using \ref attach()). For allocated and created
+/// windows, target displacements are given in elements. For dynamic windows, target displacements are byte addresses
+/// as returned by \ref attach() on the target rank.
+///
+/// All communication operations have to be issued in an epoch (see \ref WindowEpoch) and are only guaranteed to be
+/// completed when the epoch is closed (or by \ref flush() for passive target epochs).
+///
+/// @tparam T The type of the elements in the window.
+/// @tparam DefaultContainerType The container type used for buffers allocated by \ref get().
+template <typename T, template <typename...> typename DefaultContainerType = std::vector>
+class Window {
+public:
+    /// @brief The type of the elements in the window.
+    using value_type = T;
+
+    /// @brief Allocates a window in which this rank exposes \p local_size elements, using \c MPI_Win_allocate. This is
+    /// a collective operation on \p comm.
+    /// @param comm The communicator.
+    /// @param local_size The number of elements exposed by this rank.
+    /// @param info Info object passed to \c MPI_Win_allocate.
+    template <typename Comm>
+    static Window allocate(Comm const& comm, size_t local_size, MPI_Info info = MPI_INFO_NULL) {
+        void*     base;
+        MPI_Win   win;
+        int const err = MPI_Win_allocate(
+            asserting_cast<MPI_Aint>(local_size * sizeof(T)),
+            asserting_cast<int>(sizeof(T)),
+            info,
+            comm.mpi_communicator(),
+            &base,
+            &win
+        );
+        THROW_IF_MPI_ERROR(err, MPI_Win_allocate);
+        return Window(win, Span<T>(static_cast<T*>(base), local_size));
+    }
+
+    /// @brief Creates a window in which this rank exposes \p memory, using \c MPI_Win_create. This is a collective
+    /// operation on \p comm.
+    /// @param comm The communicator.
+    /// @param memory The memory exposed by this rank, which has to outlive the window.
+    /// @param info Info object passed to \c MPI_Win_create.
+    template <typename Comm>
+    static Window create(Comm const& comm, Span<T> memory, MPI_Info info = MPI_INFO_NULL) {
+        MPI_Win   win;
+        int const err = MPI_Win_create(
+            memory.data(),
+            asserting_cast<MPI_Aint>(memory.size() * sizeof(T)),
+            asserting_cast<int>(sizeof(T)),
+            info,
+            comm.mpi_communicator(),
+            &win
+        );
+        THROW_IF_MPI_ERROR(err, MPI_Win_create);
+        return Window(win, memory);
+    }
+
+    /// @brief Creates a window without memory, using \c MPI_Win_create_dynamic. Memory can be exposed later using
+    /// \ref attach(). This is a collective operation on \p comm.
+    /// @param comm The communicator.
+    /// @param info Info object passed to \c MPI_Win_create_dynamic.
+    template <typename Comm>
+    static Window create_dynamic(Comm const& comm, MPI_Info info = MPI_INFO_NULL) {
+        MPI_Win   win;
+        int const err = MPI_Win_create_dynamic(info, comm.mpi_communicator(), &win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_create_dynamic);
+        return Window(win, Span<T>());
+    }
+
+    /// @brief Copying is not allowed.
+    Window(Window const&) = delete;
+    /// @brief Copying is not allowed.
+    Window& operator=(Window const&) = delete;
+
+    /// @brief Move constructor.
+    Window(Window&& other) noexcept : _win(std::exchange(other._win, MPI_WIN_NULL)), _local(other._local) {}
+
+    /// @brief Move assignment.
+    Window& operator=(Window&& other) noexcept {
+        std::swap(_win, other._win);
+        std::swap(_local, other._local);
+        return *this;
+    }
+
+    /// @brief Frees the window. This is a collective operation.
+    ~Window() {
+        if (_win != MPI_WIN_NULL) {
+            MPI_Win_free(&_win);
+        }
+    }
+
+    /// @brief Returns the memory exposed by this rank (empty for dynamic windows).
+    Span<T> local() const {
+        return _local;
+    }
+
+    /// @brief Returns the underlying MPI window.
+    MPI_Win mpi_window() const {
+        return _win;
+    }
+
+    /// @brief Exposes \p memory in a dynamic window.
+    /// @return The address of \p memory, which other ranks have to use as target displacement.
+    MPI_Aint attach(Span<T> memory) const {
+        int err = MPI_Win_attach(_win, memory.data(), asserting_cast<MPI_Aint>(memory.size() * sizeof(T)));
+        THROW_IF_MPI_ERROR(err, MPI_Win_attach);
+        MPI_Aint address;
+        err = MPI_Get_address(memory.data(), &address);
+        THROW_IF_MPI_ERROR(err, MPI_Get_address);
+        return address;
+    }
+
+    /// @brief Stops exposing \p memory, which has previously been attached using \ref attach().
+    void detach(Span<T> memory) const {
+        int const err = MPI_Win_detach(_win, memory.data());
+        THROW_IF_MPI_ERROR(err, MPI_Win_detach);
+    }
+
+    template <typename... Args>
+    void put(Args... args) const;
+
+    template <typename... Args>
+    Request rput(Args... args) const;
+
+    template <typename... Args>
+    auto get(Args... args) const;
+
+    template <typename... Args>
+    Request rget(Args... args) const;
+
+    template <typename... Args>
+    void accumulate(Args... args) const;
+
+    template <typename... Args>
+    T fetch_and_op(Args... args) const;
+
+    template <typename... Args>
+    T compare_and_swap(Args... args) const;
+
+    /// @brief Calls \c MPI_Win_fence, which closes the current fence epoch and opens the next one.
+    /// @param assert Assertions about the epochs, e.g., \c MPI_MODE_NOPRECEDE.
+    void fence(int assert = 0) const {
+        int const err = MPI_Win_fence(assert, _win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_fence);
+    }
+
+    /// @brief Opens a fence epoch, which is closed by another \c MPI_Win_fence when the returned object is destroyed.
+    /// This is a collective operation.
+    /// @param assert Assertions about the epoch, e.g., \c MPI_MODE_NOPRECEDE.
+    [[nodiscard]] WindowEpoch fence_epoch(int assert = 0) const {
+        fence(assert);
+        return WindowEpoch(_win, WindowEpoch::Kind::fence);
+    }
+
+    /// @brief Opens an access epoch to the ranks in \p group using \c MPI_Win_start, which is closed by \c
+    /// MPI_Win_complete.
+    /// @param group The ranks to access.
+    /// @param assert Assertions about the epoch, e.g., \c MPI_MODE_NOCHECK.
+    [[nodiscard]] WindowEpoch access_epoch(Group const& group, int assert = 0) const {
+        int const err = MPI_Win_start(group.mpi_group(), assert, _win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_start);
+        return WindowEpoch(_win, WindowEpoch::Kind::access);
+    }
+
+    /// @brief Opens an exposure epoch for the ranks in \p group using \c MPI_Win_post, which is closed by \c
+    /// MPI_Win_wait.
+    /// @param group The ranks which access this rank's memory.
+    /// @param assert Assertions about the epoch, e.g., \c MPI_MODE_NOCHECK.
+    [[nodiscard]] WindowEpoch exposure_epoch(Group const& group, int assert = 0) const {
+        int const err = MPI_Win_post(group.mpi_group(), assert, _win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_post);
+        return WindowEpoch(_win, WindowEpoch::Kind::exposure);
+    }
+
+    /// @brief Opens a passive target epoch on \p rank using \c MPI_Win_lock, which is closed by \c MPI_Win_unlock.
+    /// @param rank The rank to lock.
+    /// @param lock_type \c MPI_LOCK_SHARED or \c MPI_LOCK_EXCLUSIVE.
+    /// @param assert Assertions about the epoch, e.g., \c MPI_MODE_NOCHECK.
+    [[nodiscard]] WindowEpoch lock_epoch(int rank, int lock_type = MPI_LOCK_SHARED, int assert = 0) const {
+        int const err = MPI_Win_lock(lock_type, rank, assert, _win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_lock);
+        return WindowEpoch(_win, WindowEpoch::Kind::lock, rank);
+    }
+
+    /// @brief Opens a passive target epoch on all ranks using \c MPI_Win_lock_all, which is closed by \c
+    /// MPI_Win_unlock_all.
+    /// @param assert Assertions about the epoch, e.g., \c MPI_MODE_NOCHECK.
+    [[nodiscard]] WindowEpoch lock_all_epoch(int assert = 0) const {
+        int const err = MPI_Win_lock_all(assert, _win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_lock_all);
+        return WindowEpoch(_win, WindowEpoch::Kind::lock_all);
+    }
+
+    /// @brief Completes all operations issued by this rank to \p rank in the current passive target epoch.
+    void flush(int rank) const {
+        int const err = MPI_Win_flush(rank, _win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_flush);
+    }
+
+    /// @brief Completes all operations issued by this rank in the current passive target epoch.
+    void flush_all() const {
+        int const err = MPI_Win_flush_all(_win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_flush_all);
+    }
+
+    /// @brief Locally completes all operations issued by this rank to \p rank in the current passive target epoch,
+    /// i.e., the origin buffers may be reused.
+    void flush_local(int rank) const {
+        int const err = MPI_Win_flush_local(rank, _win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_flush_local);
+    }
+
+    /// @brief Locally completes all operations issued by this rank in the current passive target epoch.
+    void flush_local_all() const {
+        int const err = MPI_Win_flush_local_all(_win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_flush_local_all);
+    }
+
+    /// @brief Synchronizes the public and private copy of this rank's window memory using \c MPI_Win_sync.
+    void sync() const {
+        int const err = MPI_Win_sync(_win);
+        THROW_IF_MPI_ERROR(err, MPI_Win_sync);
+    }
+
+private:
+    /// @brief Wraps the window \p win exposing \p local.
+    Window(MPI_Win win, Span<T> local) : _win(win), _local(local) {}
+
+    /// @brief Returns the target rank passed via \ref kamping::target().
+    template <typename... Args>
+    static int target_rank(Args const&... args) {
+        return internal::select_parameter_type<internal::ParameterType::target>(args...).rank_signed();
+    }
+
+    /// @brief Returns the target displacement passed via \ref kamping::target_disp(), or 0 if it is omitted.
+    template <typename... Args>
+    static MPI_Aint target_displacement(Args&... args) {
+        if constexpr (internal::has_parameter_type<internal::ParameterType::target_disp, Args...>()) {
+            return internal::select_parameter_type<internal::ParameterType::target_disp>(args...)
+                .construct_buffer_or_rebind()
+                .get_single_element();
+        } else {
+            return 0;
+        }
+    }
+
+    /// @brief Returns the send buffer passed via \ref kamping::send_buf() and checks its value type.
+    template <typename... Args>
+    static auto origin_send_buf(Args&... args) {
+        auto send_buf = internal::select_parameter_type<internal::ParameterType::send_buf>(args...)
+                            .construct_buffer_or_rebind();
+        using send_value_type = std::remove_const_t<typename std::remove_reference_t<decltype(send_buf)>::value_type>;
+        static_assert(std::is_same_v<send_value_type, T>, "The send buffer has to contain elements of type T.");
+        return send_buf;
+    }
+
+    /// @brief Returns the send buffer of an operation which may still read it after returning, i.e., until the epoch
+    /// is closed or flushed. Such a buffer has to be provided by reference.
+    template <typename... Args>
+    static auto pending_origin_send_buf(Args&... args) {
+        auto send_buf = origin_send_buf(args...);
+        static_assert(
+            !std::remove_reference_t<decltype(send_buf)>::is_owning,
+            "The send buffer is read until the operation completes, so it has to be passed by reference."
+        );
+        return send_buf;
+    }
+
+    MPI_Win _win;   ///< The window.
+    Span<T> _local; ///< The memory exposed by this rank.
+};
+
+/// @brief Writes elements to the window of the target rank using \c MPI_Put.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the elements to write. As MPI may read them until the epoch is closed or
+/// flushed, the buffer has to be passed by reference (not as an owning rvalue).
+/// - \ref kamping::target() the rank whose window is written to.
+///
+/// The following parameter is optional:
+/// - \ref kamping::target_disp() the position in the target window at which the elements are written. Defaults to 0.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+template <typename T, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+void Window<T, DefaultContainerType>::put(Args... args) const {
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(send_buf, target),
+        KAMPING_OPTIONAL_PARAMETERS(target_disp)
+    );
+    auto const send_buf = pending_origin_send_buf(args...);
+    int const  err      = MPI_Put(
+        send_buf.data(),                      // origin_addr
+        asserting_cast<int>(send_buf.size()), // origin_count
+        mpi_datatype<T>(),                    // origin_datatype
+        target_rank(args...),                 // target_rank
+        target_displacement(args...),         // target_disp
+        asserting_cast<int>(send_buf.size()), // target_count
+        mpi_datatype<T>(),                    // target_datatype
+        _win                                  // win
+    );
+    THROW_IF_MPI_ERROR(err, MPI_Put);
+}
+
+/// @brief Writes elements to the window of the target rank using \c MPI_Rput. Takes the same parameters as \ref
+/// put(). The returned request is completed once the send buffer may be reused. This may only be called in a passive
+/// target epoch.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described for \ref put().
+/// @return The request for the operation.
+template <typename T, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+Request Window<T, DefaultContainerType>::rput(Args... args) const {
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(send_buf, target),
+        KAMPING_OPTIONAL_PARAMETERS(target_disp)
+    );
+    auto const send_buf = pending_origin_send_buf(args...);
+    Request    request;
+    int const  err = MPI_Rput(
+        send_buf.data(),                      // origin_addr
+        asserting_cast<int>(send_buf.size()), // origin_count
+        mpi_datatype<T>(),                    // origin_datatype
+        target_rank(args...),                 // target_rank
+        target_displacement(args...),         // target_disp
+        asserting_cast<int>(send_buf.size()), // target_count
+        mpi_datatype<T>(),                    // target_datatype
+        _win,                                 // win
+        &request.mpi_request()                // request
+    );
+    THROW_IF_MPI_ERROR(err, MPI_Rput);
+    return request;
+}
+
+/// @brief Reads elements from the window of the target rank using \c MPI_Get.
+///
+/// The following parameters are required:
+/// - \ref kamping::target() the rank whose window is read.
+///
+/// The following parameters are optional, but at least one of them has to be given:
+/// - \ref kamping::recv_buf() the buffer to read into. If omitted, a new buffer is allocated.
+/// - \ref kamping::recv_count() the number of elements to read. If omitted, the size of the receive buffer is used.
+///
+/// The following parameter is optional:
+/// - \ref kamping::target_disp() the position in the target window from which the elements are read. Defaults to 0.
+///
+/// Note that the buffer may only be accessed after the epoch has been closed (or the target has been flushed).
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return The receive buffer if it has been allocated by KaMPIng (see \ref docs/parameter_handling.md).
+template <typename T, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+auto Window<T, DefaultContainerType>::get(Args... args) const {
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(target),
+        KAMPING_OPTIONAL_PARAMETERS(recv_buf, recv_count, target_disp)
+    );
+    using default_recv_buf_type = decltype(kamping::recv_buf(alloc_new<DefaultContainerType<T>>));
+    auto recv_buf =
+        internal::select_parameter_type_or_default<internal::ParameterType::recv_buf, default_recv_buf_type>(
+            std::tuple<>(),
+            args...
+        )
+            .template construct_buffer_or_rebind<DefaultContainerType>();
+    using recv_value_type = typename std::remove_reference_t<decltype(recv_buf)>::value_type;
+    static_assert(std::is_same_v<recv_value_type, T>, "The receive buffer has to contain elements of type T.");
+
+    size_t count;
+    if constexpr (internal::has_parameter_type<internal::ParameterType::recv_count, Args...>()) {
+        count = asserting_cast<size_t>(
+            internal::select_parameter_type<internal::ParameterType::recv_count>(args...)
+                .construct_buffer_or_rebind()
+                .get_single_element()
+        );
+    } else {
+        static_assert(
+            !std::remove_reference_t<decltype(recv_buf)>::is_lib_allocated,
+            "Either a receive buffer or a receive count has to be given."
+        );
+        count = recv_buf.size();
+    }
+    recv_buf.resize_if_requested([&]() { return count; });
+    KAMPING_ASSERT(recv_buf.size() >= count, "Recv buffer is not large enough.", assert::light);
+
+    int const err = MPI_Get(
+        recv_buf.data(),              // origin_addr
+        asserting_cast<int>(count),   // origin_count
+        mpi_datatype<T>(),            // origin_datatype
+        target_rank(args...),         // target_rank
+        target_displacement(args...), // target_disp
+        asserting_cast<int>(count),   // target_count
+        mpi_datatype<T>(),            // target_datatype
+        _win                          // win
+    );
+    THROW_IF_MPI_ERROR(err, MPI_Get);
+    return internal::make_mpi_result<std::tuple<Args...>>(std::move(recv_buf));
+}
+
+/// @brief Reads elements from the window of the target rank using \c MPI_Rget. The returned request is completed
+/// once the elements have been read into the receive buffer. This may only be called in a passive target epoch.
+///
+/// The following parameters are required:
+/// - \ref kamping::recv_buf() the buffer to read into, which is not resized. As the buffer has to outlive the
+/// request, it cannot be allocated by KaMPIng.
+/// - \ref kamping::target() the rank whose window is read.
+///
+/// The following parameter is optional:
+/// - \ref kamping::target_disp() the position in the target window from which the elements are read. Defaults to 0.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return The request for the operation.
+template <typename T, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+Request Window<T, DefaultContainerType>::rget(Args... args) const {
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(recv_buf, target),
+        KAMPING_OPTIONAL_PARAMETERS(target_disp)
+    );
+    auto recv_buf = internal::select_parameter_type<internal::ParameterType::recv_buf>(args...)
+                        .template construct_buffer_or_rebind<DefaultContainerType>();
+    static_assert(
+        !std::remove_reference_t<decltype(recv_buf)>::is_lib_allocated,
+        "The receive buffer of rget has to be provided by the caller."
+    );
+    using recv_value_type = typename std::remove_reference_t<decltype(recv_buf)>::value_type;
+    static_assert(std::is_same_v<recv_value_type, T>, "The receive buffer has to contain elements of type T.");
+    Request   request;
+    int const err = MPI_Rget(
+        recv_buf.data(),                      // origin_addr
+        asserting_cast<int>(recv_buf.size()), // origin_count
+        mpi_datatype<T>(),                    // origin_datatype
+        target_rank(args...),                 // target_rank
+        target_displacement(args...),         // target_disp
+        asserting_cast<int>(recv_buf.size()), // target_count
+        mpi_datatype<T>(),                    // target_datatype
+        _win,                                 // win
+        &request.mpi_request()                // request
+    );
+    THROW_IF_MPI_ERROR(err, MPI_Rget);
+    return request;
+}
+
+/// @brief Combines elements with the elements in the window of the target rank using \c MPI_Accumulate. Concurrent
+/// accumulate operations on the same elements are atomic per element.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the elements to combine with the target elements. As MPI may read them until
+/// the epoch is closed or flushed, the buffer has to be passed by reference (not as an owning rvalue).
+/// - \ref kamping::op() the operation. It has to be a builtin operation (e.g., \c kamping::ops::plus) or a predefined
+/// \c MPI_Op such as \c MPI_REPLACE.
+/// - \ref kamping::target() the rank whose window is updated.
+///
+/// The following parameter is optional:
+/// - \ref kamping::target_disp() the position in the target window of the first element to update. Defaults to 0.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+template <typename T, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+void Window<T, DefaultContainerType>::accumulate(Args... args) const {
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(send_buf, op, target),
+        KAMPING_OPTIONAL_PARAMETERS(target_disp)
+    );
+    auto const send_buf  = pending_origin_send_buf(args...);
+    auto&      op_param  = internal::select_parameter_type<internal::ParameterType::op>(args...);
+    auto       operation = op_param.template build_operation<T>();
+    int const  err       = MPI_Accumulate(
+        send_buf.data(),                      // origin_addr
+        asserting_cast<int>(send_buf.size()), // origin_count
+        mpi_datatype<T>(),                    // origin_datatype
+        target_rank(args...),                 // target_rank
+        target_displacement(args...),         // target_disp
+        asserting_cast<int>(send_buf.size()), // target_count
+        mpi_datatype<T>(),                    // target_datatype
+        operation.op(),                       // op
+        _win                                  // win
+    );
+    THROW_IF_MPI_ERROR(err, MPI_Accumulate);
+}
+
+/// @brief Atomically combines a single element in the window of the target rank with a value using \c
+/// MPI_Fetch_and_op and returns the previous value of the target element.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the single value to combine with the target element.
+/// - \ref kamping::op() the operation. It has to be a builtin operation (e.g., \c kamping::ops::plus) or a predefined
+/// \c MPI_Op such as \c MPI_REPLACE or \c MPI_NO_OP.
+/// - \ref kamping::target() the rank whose window is updated.
+///
+/// The following parameter is optional:
+/// - \ref kamping::target_disp() the position of the element in the target window. Defaults to 0.
+///
+/// As the previous value is returned, this completes the operation using \c MPI_Win_flush_local, so this may only be
+/// called in a passive target epoch.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return The previous value of the target element.
+template <typename T, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+T Window<T, DefaultContainerType>::fetch_and_op(Args... args) const {
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(send_buf, op, target),
+        KAMPING_OPTIONAL_PARAMETERS(target_disp)
+    );
+    auto const send_buf  = origin_send_buf(args...);
+    auto&      op_param  = internal::select_parameter_type<internal::ParameterType::op>(args...);
+    auto       operation = op_param.template build_operation<T>();
+    int const  rank      = target_rank(args...);
+    T          result;
+    int        err = MPI_Fetch_and_op(
+        send_buf.data(),              // origin_addr
+        &result,                      // result_addr
+        mpi_datatype<T>(),            // datatype
+        rank,                         // target_rank
+        target_displacement(args...), // target_disp
+        operation.op(),               // op
+        _win                          // win
+    );
+    THROW_IF_MPI_ERROR(err, MPI_Fetch_and_op);
+    flush_local(rank);
+    return result;
+}
+
+/// @brief Atomically replaces a single element in the window of the target rank if it is equal to a given value,
+/// using \c MPI_Compare_and_swap, and returns the previous value of the target element.
+///
+/// The following parameters are required:
+/// - \ref kamping::send_buf() containing the single value to write if the comparison succeeds.
+/// - \ref kamping::compare_value() the value to compare the target element with.
+/// - \ref kamping::target() the rank whose window is updated.
+///
+/// The following parameter is optional:
+/// - \ref kamping::target_disp() the position of the element in the target window. Defaults to 0.
+///
+/// As the previous value is returned, this completes the operation using \c MPI_Win_flush_local, so this may only be
+/// called in a passive target epoch.
+///
+/// @tparam Args Automatically deduced template parameters.
+/// @param args All required and any number of the optional parameters described above.
+/// @return The previous value of the target element. The swap succeeded iff it is equal to the compare value.
+template <typename T, template <typename...> typename DefaultContainerType>
+template <typename... Args>
+T Window<T, DefaultContainerType>::compare_and_swap(Args... args) const {
+    KAMPING_CHECK_PARAMETERS(
+        Args,
+        KAMPING_REQUIRED_PARAMETERS(send_buf, compare_value, target),
+        KAMPING_OPTIONAL_PARAMETERS(target_disp)
+    );
+    auto const send_buf = origin_send_buf(args...);
+    auto const compare  = internal::select_parameter_type<internal::ParameterType::compare_value>(args...)
+                             .construct_buffer_or_rebind();
+    int const rank = target_rank(args...);
+    T         result;
+    int       err = MPI_Compare_and_swap(
+        send_buf.data(),              // origin_addr
+        compare.data(),               // compare_addr
+        &result,                      // result_addr
+        mpi_datatype<T>(),            // datatype
+        rank,                         // target_rank
+        target_displacement(args...), // target_disp
+        _win                          // win
+    );
+    THROW_IF_MPI_ERROR(err, MPI_Compare_and_swap);
+    flush_local(rank);
+    return result;
+}
+
+} // namespace kamping
@@ -0,0 +1,164 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief A global atomic counter and a work queue for dynamic load balancing based on one-sided communication.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include <mpi.h>
+
+#include "kamping/collectives/barrier.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/kassert/kassert.hpp"
+#include "kamping/mpi_ops.hpp"
+#include "kamping/named_parameters.hpp"
+#include "kamping/window.hpp"
+
+namespace kamping {
+
+/// @brief A counter shared by all ranks of a communicator, from which each rank can atomically fetch the next value.
+/// Each value is returned to exactly one rank.
+///
+/// The counter is stored on rank 0 and incremented using \c MPI_Fetch_and_op in a passive target epoch, so fetching
+/// a value does not require any participation of rank 0.
+///
+/// If a batch size greater than one is given, the ranks of each node fetch batches of values from the global counter,
+/// which are handed out one by one from a node-local counter. This reduces the number of (remote) atomic operations on
+/// rank 0 by the batch size, but values are no longer handed out in increasing order across nodes.
+class GlobalCounter {
+public:
+    /// @brief Creates a counter starting at \p initial_value. This is a collective operation on \p comm.
+    /// @param comm The communicator.
+    /// @param initial_value The first value returned by the counter.
+    /// @param batch_size The number of values fetched from the global counter at once by each node.
+    template <typename Comm>
+    GlobalCounter(Comm const& comm, size_t initial_value = 0, size_t batch_size = 1)
+        : _batch_size(batch_size),
+          _global_window(Window<size_t>::allocate(comm, comm.rank() == 0 ? 1 : 0)),
+          _global_epoch(_global_window.lock_all_epoch()) {
+        KAMPING_ASSERT(batch_size > 0, "The batch size has to be positive.", assert::light);
+        if (comm.rank() == 0) {
+            _global_window.local()[0] = initial_value;
+        }
+        if (batch_size > 1) {
+            auto node_comm = comm.split_to_shared_memory();
+            // the current batch of the node as [next, end), stored on the node-local rank 0
+            _node_window.emplace(Window<size_t>::allocate(node_comm, node_comm.rank() == 0 ? 2 : 0));
+            std::fill(_node_window->local().begin(), _node_window->local().end(), size_t{0});
+            _node_window->fence(MPI_MODE_NOSUCCEED);
+        }
+        _global_window.sync();
+        comm.barrier();
+    }
+
+    /// @brief Fetches the next value of the counter.
+    size_t next() {
+        if (!_node_window) {
+            return fetch_global(1);
+        }
+        auto                  node_epoch = _node_window->lock_epoch(0, MPI_LOCK_EXCLUSIVE);
+        std::array<size_t, 2> batch;
+        _node_window->get(recv_buf(batch), target(0));
+        _node_window->flush(0);
+        if (batch[0] == batch[1]) {
+            batch[0] = fetch_global(_batch_size);
+            batch[1] = batch[0] + _batch_size;
+        }
+        size_t const value = batch[0]++;
+        _node_window->put(send_buf(batch), target(0));
+        node_epoch.close();
+        return value;
+    }
+
+    /// @brief Returns the batch size.
+    size_t batch_size() const {
+        return _batch_size;
+    }
+
+private:
+    /// @brief Atomically adds \p increment to the global counter and returns its previous value.
+    size_t fetch_global(size_t increment) const {
+        return _global_window.fetch_and_op(send_buf(increment), op(ops::plus<>{}), target(0));
+    }
+
+    size_t         _batch_size;    ///< The number of values fetched from the global counter at once.
+    Window<size_t> _global_window; ///< The window containing the global counter on rank 0.
+    WindowEpoch    _global_epoch;  ///< The passive target epoch on the global window for the lifetime of the counter.
+    std::optional<Window<size_t>> _node_window; ///< The window containing the batch of the node (if batching).
+};
+
+/// @brief A contiguous range of items [begin, end) handed out by a \ref WorkQueue.
+struct WorkChunk {
+    size_t begin; ///< The first item of the chunk.
+    size_t end;   ///< One past the last item of the chunk.
+};
+
+/// @brief Distributes the items [0, num_items) in chunks to the ranks of a communicator on demand, which is useful
+/// for dynamic load balancing when the cost of processing an item is unknown in advance.
+///
+/// In contrast to a master-worker scheme, no rank has to answer requests, as chunks are claimed using a \ref
+/// GlobalCounter. Each item is handed out to exactly one rank.
+class WorkQueue {
+public:
+    /// @brief Creates a queue of \p num_items items. This is a collective operation on \p comm.
+    /// @param comm The communicator.
+    /// @param num_items The number of items.
+    /// @param chunk_size The number of items handed out at once.
+    /// @param batch_size The number of chunks fetched at once by each node (see \ref GlobalCounter).
+    template <typename Comm>
+    WorkQueue(Comm const& comm, size_t num_items, size_t chunk_size = 1, size_t batch_size = 1)
+        : _num_items(num_items),
+          _chunk_size(chunk_size),
+          _counter(comm, 0, batch_size) {
+        KAMPING_ASSERT(chunk_size > 0, "The chunk size has to be positive.", assert::light);
+    }
+
+    /// @brief Claims the next chunk of items.
+    /// @return The chunk, or \c std::nullopt if all items have been handed out.
+    std::optional<WorkChunk> next_chunk() {
+        if (_exhausted) {
+            return std::nullopt;
+        }
+        size_t const chunk = _counter.next();
+        if (chunk >= (_num_items + _chunk_size - 1) / _chunk_size) {
+            _exhausted = true;
+            return std::nullopt;
+        }
+        size_t const begin = chunk * _chunk_size;
+        return WorkChunk{begin, std::min(begin + _chunk_size, _num_items)};
+    }
+
+    /// @brief Returns the number of items.
+    size_t num_items() const {
+        return _num_items;
+    }
+
+    /// @brief Returns the number of items per chunk.
+    size_t chunk_size() const {
+        return _chunk_size;
+    }
+
+private:
+    size_t        _num_items;         ///< The number of items.
+    size_t        _chunk_size;        ///< The number of items per chunk.
+    GlobalCounter _counter;           ///< The counter of the claimed chunks.
+    bool          _exhausted = false; ///< Whether this rank has already seen that all items have been handed out.
+};
+
+} // namespace kamping
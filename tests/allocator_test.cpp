@@ -1,4 +1,6 @@
 #include <limits>
+#include <numeric>
+#include <type_traits>
 // somehow in combination with GLIBCXX_DEBUG, this does not compile if the
 // include order is the over way around
 // clang-format off
@@ -6,10 +8,13 @@
 #include <unordered_map>
 // clang-format on
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <mpi.h>
 
 #include "kamping/allocator.hpp"
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/communicator.hpp"
 
 class AllocatorTest : public ::testing::Test {
 public:
@@ -113,3 +118,115 @@ TEST_F(AllocatorTest, size_out_of_bound) {
     EXPECT_THROW(alloc.allocate(static_cast<size_t>(std::numeric_limits<MPI_Aint>::max()) + 1), std::runtime_error);
     EXPECT_EQ(AllocatorTest::allocated_memory, 0);
 }
+
+namespace {
+/// @brief Allocator counting the number of objects it constructs.
+template <typename T>
+struct ConstructionCountingAllocator : public std::allocator<T> {
+    template <typename U>
+    struct rebind {
+        using other = ConstructionCountingAllocator<U>;
+    };
+    ConstructionCountingAllocator() = default;
+    template <typename U>
+    ConstructionCountingAllocator(ConstructionCountingAllocator<U> const&) noexcept {}
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) noexcept(std::is_nothrow_constructible_v<U, Args...>) {
+        ++num_constructed;
+        ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+    static inline size_t num_constructed = 0;
+};
+} // namespace
+
+TEST_F(AllocatorTest, default_init_allocator_only_forwards_construction_with_arguments) {
+    using Allocator = kamping::DefaultInitAllocator<int, ConstructionCountingAllocator<int>>;
+    ConstructionCountingAllocator<int>::num_constructed = 0;
+    std::vector<int, Allocator> v;
+    // avoid reallocations, which move-construct the existing elements
+    v.reserve(1000);
+    v.resize(100);
+    EXPECT_EQ(ConstructionCountingAllocator<int>::num_constructed, 0);
+    v.push_back(42);
+    EXPECT_EQ(ConstructionCountingAllocator<int>::num_constructed, 1);
+    EXPECT_EQ(v.back(), 42);
+    v.resize(200);
+    EXPECT_EQ(ConstructionCountingAllocator<int>::num_constructed, 1);
+}
+
+TEST_F(AllocatorTest, default_init_allocator_with_mpi_allocator) {
+    {
+        std::vector<double, kamping::DefaultInitAllocator<double, kamping::MPIAllocator<double>>> v;
+        v.resize(42);
+        EXPECT_EQ(v.capacity() * sizeof(double), AllocatorTest::allocated_memory);
+    }
+    EXPECT_EQ(AllocatorTest::allocated_memory, 0);
+    EXPECT_TRUE(AllocatorTest::chunks.empty());
+}
+
+TEST_F(AllocatorTest, default_init_vector_as_recv_buf) {
+    kamping::Communicator comm;
+    std::vector<int>      expected(comm.size());
+    std::iota(expected.begin(), expected.end(), 0);
+
+    auto recv_buf = comm.allgather(
+        kamping::send_buf(comm.rank_signed()),
+        kamping::recv_buf(kamping::alloc_new<kamping::default_init_vector<int>>)
+    );
+    static_assert(std::is_same_v<decltype(recv_buf), kamping::default_init_vector<int>>);
+    EXPECT_THAT(recv_buf, ::testing::ElementsAreArray(expected));
+}
+
+TEST_F(AllocatorTest, default_init_vector_as_default_container_type) {
+    kamping::Communicator<kamping::default_init_vector> comm;
+    std::vector<int>                                    expected(comm.size());
+    std::iota(expected.begin(), expected.end(), 0);
+
+    auto [recv_buf, recv_counts] = comm.allgatherv(kamping::send_buf(comm.rank_signed()), kamping::recv_counts_out());
+    static_assert(std::is_same_v<decltype(recv_buf), kamping::default_init_vector<int>>);
+    static_assert(std::is_same_v<decltype(recv_counts), kamping::default_init_vector<int>>);
+    EXPECT_THAT(recv_buf, ::testing::ElementsAreArray(expected));
+    EXPECT_THAT(recv_counts, ::testing::Each(1));
+}
+
+TEST_F(AllocatorTest, pooled_mpi_allocator) {
+    kamping::BufferPool pool(kamping::mpi_alloc_mem_upstream(1024));
+    {
+        std::vector<double, kamping::PooledMPIAllocator<double>> small(kamping::PooledMPIAllocator<double>{pool});
+        std::vector<double, kamping::PooledMPIAllocator<double>> large(kamping::PooledMPIAllocator<double>{pool});
+        small.resize(4);
+        large.resize(1000);
+        // one slab and one separate block
+        EXPECT_EQ(AllocatorTest::chunks.size(), 2);
+        EXPECT_EQ(AllocatorTest::allocated_memory, 1024 + 8192);
+    }
+    // the memory is cached and reused
+    {
+        std::vector<double, kamping::PooledMPIAllocator<double>> v(kamping::PooledMPIAllocator<double>{pool});
+        v.resize(1000);
+        EXPECT_EQ(AllocatorTest::chunks.size(), 2);
+        EXPECT_EQ(pool.statistics().num_reused, 1);
+    }
+    pool.release();
+    EXPECT_EQ(AllocatorTest::allocated_memory, 0);
+    EXPECT_TRUE(AllocatorTest::chunks.empty());
+}
+
+TEST_F(AllocatorTest, mpi_pooled_vector_as_default_container_type) {
+    kamping::Communicator<kamping::mpi_pooled_vector> comm;
+    auto exchange = [&]() {
+        auto recv_buf = comm.allgather(kamping::send_buf(comm.rank_signed()));
+        static_assert(std::is_same_v<decltype(recv_buf), kamping::mpi_pooled_vector<int>>);
+        EXPECT_EQ(recv_buf.size(), comm.size());
+    };
+    // warm-up
+    exchange();
+    size_t const num_chunks = AllocatorTest::chunks.size();
+    EXPECT_GT(num_chunks, 0);
+    for (size_t i = 0; i < 10; ++i) {
+        exchange();
+    }
+    EXPECT_EQ(AllocatorTest::chunks.size(), num_chunks);
+    kamping::mpi_buffer_pool().release();
+    EXPECT_TRUE(AllocatorTest::chunks.empty());
+}
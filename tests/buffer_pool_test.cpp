@@ -0,0 +1,230 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/buffer_pool.hpp"
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/communicator.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+TEST(BufferPoolTest, reuses_blocks_of_same_size_class) {
+    BufferPool pool;
+    void*      first = pool.allocate(100);
+    pool.deallocate(first, 100);
+    EXPECT_EQ(pool.statistics().cached_bytes, 128);
+
+    // 120 bytes are in the same size class as 100 bytes
+    void* second = pool.allocate(120);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(pool.statistics().cached_bytes, 0);
+
+    // 200 bytes are not
+    void* third = pool.allocate(200);
+    EXPECT_NE(third, first);
+
+    pool.deallocate(second, 120);
+    pool.deallocate(third, 200);
+    EXPECT_EQ(pool.statistics().num_allocations, 3);
+    EXPECT_EQ(pool.statistics().num_reused, 1);
+    EXPECT_EQ(pool.statistics().num_upstream_allocations, 2);
+    EXPECT_EQ(pool.statistics().cached_bytes, 128 + 256);
+
+    pool.release();
+    EXPECT_EQ(pool.statistics().cached_bytes, 0);
+}
+
+TEST(BufferPoolTest, too_large_allocation_throws) {
+    BufferPool pool;
+    // there is no power of two representable as size_t which could hold this many bytes
+    EXPECT_THROW(pool.allocate(std::numeric_limits<size_t>::max()), std::bad_alloc);
+    EXPECT_THROW(pool.allocate((std::numeric_limits<size_t>::max() >> 1) + 2), std::bad_alloc);
+    EXPECT_EQ(pool.statistics().num_upstream_allocations, 0);
+}
+
+TEST(BufferPoolTest, max_cached_bytes) {
+    BufferPool pool(64);
+    void*      small = pool.allocate(64);
+    void*      large = pool.allocate(65);
+    pool.deallocate(large, 65);
+    pool.deallocate(small, 64);
+    EXPECT_EQ(pool.statistics().cached_bytes, 64);
+}
+
+namespace {
+/// @brief Upstream allocator counting the number of currently allocated blocks.
+struct CountingUpstream {
+    static inline size_t num_blocks = 0;
+
+    static BufferPool::Upstream get(size_t slab_size) {
+        return BufferPool::Upstream{
+            [](size_t num_bytes) {
+                ++num_blocks;
+                return ::operator new(num_bytes);
+            },
+            [](void* ptr) noexcept {
+                --num_blocks;
+                ::operator delete(ptr);
+            },
+            slab_size
+        };
+    }
+};
+} // namespace
+
+TEST(BufferPoolTest, carves_small_blocks_from_slabs) {
+    CountingUpstream::num_blocks = 0;
+    {
+        BufferPool         pool(CountingUpstream::get(1024));
+        std::vector<void*> blocks;
+        // 16 blocks of 64 bytes fit into a single slab
+        for (size_t i = 0; i < 16; ++i) {
+            blocks.push_back(pool.allocate(64));
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(blocks.back()) % alignof(std::max_align_t), 0);
+        }
+        EXPECT_EQ(CountingUpstream::num_blocks, 1);
+        // tiny blocks are still aligned
+        blocks.push_back(pool.allocate(1));
+        blocks.push_back(pool.allocate(1));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(blocks.back()) % alignof(std::max_align_t), 0);
+        EXPECT_EQ(CountingUpstream::num_blocks, 2);
+        // large blocks are allocated separately
+        void* large = pool.allocate(512);
+        EXPECT_EQ(CountingUpstream::num_blocks, 3);
+        EXPECT_EQ(pool.statistics().upstream_bytes, 2 * 1024 + 512);
+
+        pool.deallocate(large, 512);
+        pool.deallocate(blocks.back(), 1);
+        blocks.pop_back();
+        // the slabs are still in use
+        pool.release();
+        EXPECT_EQ(CountingUpstream::num_blocks, 2);
+        EXPECT_EQ(pool.statistics().upstream_bytes, 2 * 1024);
+
+        // freed carved blocks are reused
+        void* reused = pool.allocate(1);
+        EXPECT_EQ(pool.statistics().num_reused, 1);
+        pool.deallocate(reused, 1);
+
+        pool.deallocate(blocks.back(), 1);
+        blocks.pop_back();
+        for (void* block: blocks) {
+            pool.deallocate(block, 64);
+        }
+        EXPECT_EQ(pool.statistics().cached_bytes, 16 * 64 + 2);
+        pool.release();
+        EXPECT_EQ(CountingUpstream::num_blocks, 0);
+        EXPECT_EQ(pool.statistics().cached_bytes, 0);
+        EXPECT_EQ(pool.statistics().upstream_bytes, 0);
+
+        // slabs held by a pool are returned when it is destroyed
+        pool.allocate(64);
+        EXPECT_EQ(CountingUpstream::num_blocks, 1);
+    }
+    EXPECT_EQ(CountingUpstream::num_blocks, 0);
+}
+
+TEST(BufferPoolTest, allocator_with_vector) {
+    BufferPool pool;
+    {
+        std::vector<int, BufferPoolAllocator<int>> v(BufferPoolAllocator<int>{pool});
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0), 999 * 1000 / 2);
+    }
+    size_t const num_upstream_allocations = pool.statistics().num_upstream_allocations;
+    {
+        std::vector<int, BufferPoolAllocator<int>> v(BufferPoolAllocator<int>{pool});
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+    }
+    // the second vector grows in the same steps and therefore reuses all blocks
+    EXPECT_EQ(pool.statistics().num_upstream_allocations, num_upstream_allocations);
+}
+
+TEST(BufferPoolTest, concurrent_allocations_from_multiple_threads) {
+    constexpr size_t num_threads    = 4;
+    constexpr size_t num_iterations = 10000;
+    // each thread frees the vectors allocated by the next one
+    std::vector<std::vector<pooled_vector<int>>> allocated(num_threads);
+    auto                                          allocate = [&](size_t thread) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            pooled_vector<int> temporary(i % 100 + 1);
+            allocated[thread].emplace_back(i % 100 + 1, static_cast<int>(thread));
+        }
+    };
+    auto free_next = [&](size_t thread) {
+        auto& vectors = allocated[(thread + 1) % num_threads];
+        for (auto const& v: vectors) {
+            EXPECT_EQ(v.front(), static_cast<int>((thread + 1) % num_threads));
+        }
+        vectors.clear();
+        vectors.shrink_to_fit();
+    };
+    size_t const cached_bytes = BufferPool::default_pool().statistics().cached_bytes;
+    for (auto const& work: {std::function<void(size_t)>(allocate), std::function<void(size_t)>(free_next)}) {
+        std::vector<std::thread> threads;
+        for (size_t thread = 0; thread < num_threads; ++thread) {
+            threads.emplace_back(work, thread);
+        }
+        for (auto& thread: threads) {
+            thread.join();
+        }
+    }
+    // all blocks have been returned to the pool
+    EXPECT_GE(BufferPool::default_pool().statistics().cached_bytes, cached_bytes);
+    EXPECT_EQ(
+        BufferPool::default_pool().statistics().cached_bytes,
+        BufferPool::default_pool().statistics().upstream_bytes
+    );
+}
+
+TEST(BufferPoolTest, pooled_vector_as_default_container_type) {
+    Communicator<pooled_vector> comm;
+    std::vector<int>            input(comm.size());
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<int> const counts(comm.size(), 1);
+
+    auto exchange = [&]() {
+        auto [recv_buf, recv_counts, recv_displs] =
+            comm.alltoallv(send_buf(input), send_counts(counts), recv_counts_out(), recv_displs_out());
+        static_assert(std::is_same_v<decltype(recv_buf), pooled_vector<int>>);
+        static_assert(std::is_same_v<decltype(recv_counts), pooled_vector<int>>);
+        EXPECT_THAT(recv_buf, Each(comm.rank_signed()));
+        auto gathered = comm.allgatherv(send_buf(recv_buf));
+        EXPECT_EQ(gathered.size(), comm.size() * comm.size());
+    };
+
+    // warm-up
+    exchange();
+    size_t const num_upstream_allocations = BufferPool::default_pool().statistics().num_upstream_allocations;
+    for (size_t i = 0; i < 10; ++i) {
+        exchange();
+    }
+    EXPECT_EQ(BufferPool::default_pool().statistics().num_upstream_allocations, num_upstream_allocations);
+}
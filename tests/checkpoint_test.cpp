@@ -0,0 +1,132 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "test_assertions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "helpers_for_testing.hpp"
+#include "kamping/checkpoint.hpp"
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/communicator.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+namespace {
+struct Particle {
+    double   position[3];
+    uint32_t id;
+};
+} // namespace
+
+TEST(CheckpointTest, write_and_restore) {
+    Communicator  comm;
+    TemporaryPath path("checkpoint_test_write_and_restore");
+
+    std::vector<int>      values(comm.rank() + 1, comm.rank_signed());
+    std::vector<Particle> particles(3);
+    for (size_t i = 0; i < particles.size(); ++i) {
+        particles[i] = Particle{{1.0 * static_cast<double>(i), 2.0, 3.0}, static_cast<uint32_t>(comm.rank() * 3 + i)};
+    }
+    Checkpoint checkpoint;
+    checkpoint.add("values", values);
+    checkpoint.add("particles", particles);
+    EXPECT_EQ(checkpoint.num_containers(), 2);
+    checkpoint.write(comm, path.path(), 42);
+    EXPECT_TRUE(std::filesystem::exists(path.path()));
+    EXPECT_FALSE(std::filesystem::exists(path.path() + ".tmp"));
+
+    auto const expected_values    = values;
+    auto const expected_particles = particles;
+    values.clear();
+    particles.assign(7, Particle{});
+    EXPECT_EQ(checkpoint.restore(comm, path.path()), 42);
+    EXPECT_EQ(values, expected_values);
+    ASSERT_EQ(particles.size(), expected_particles.size());
+    for (size_t i = 0; i < particles.size(); ++i) {
+        EXPECT_EQ(particles[i].id, expected_particles[i].id);
+        EXPECT_EQ(particles[i].position[0], expected_particles[i].position[0]);
+    }
+}
+
+TEST(CheckpointTest, overwrite_checkpoint) {
+    Communicator  comm;
+    TemporaryPath path("checkpoint_test_overwrite_checkpoint");
+
+    std::vector<int> values(100, 1);
+    Checkpoint       checkpoint;
+    checkpoint.add("values", values);
+    checkpoint.write(comm, path.path(), 1);
+    values.assign(2, 2);
+    checkpoint.write(comm, path.path(), 2);
+
+    values.clear();
+    EXPECT_EQ(checkpoint.restore(comm, path.path()), 2);
+    EXPECT_THAT(values, ElementsAre(2, 2));
+}
+
+TEST(CheckpointTest, restore_on_fewer_ranks) {
+    Communicator  comm;
+    TemporaryPath path("checkpoint_test_restore_on_fewer_ranks");
+
+    // rank i writes the values [i * (i + 1) / 2, (i + 1) * (i + 2) / 2)
+    std::vector<uint64_t> values(comm.rank() + 1);
+    std::iota(values.begin(), values.end(), comm.rank() * (comm.rank() + 1) / 2);
+    Checkpoint checkpoint;
+    checkpoint.add("values", values);
+    checkpoint.write(comm, path.path(), 7);
+
+    // restore on the first half of the ranks, which obtain balanced parts of all values
+    size_t const num_values = comm.size() * (comm.size() + 1) / 2;
+    auto const   half       = comm.split(comm.rank() < (comm.size() + 1) / 2 ? 0 : 1);
+    if (comm.rank() < (comm.size() + 1) / 2) {
+        values.clear();
+        EXPECT_EQ(checkpoint.restore(half, path.path()), 7);
+        ElementRange const    range = balanced_partition(num_values, half.rank(), half.size());
+        std::vector<uint64_t> expected(range.size());
+        std::iota(expected.begin(), expected.end(), range.begin);
+        EXPECT_EQ(values, expected);
+
+        std::vector<uint64_t> const all_values = half.allgatherv(send_buf(values));
+        EXPECT_EQ(all_values.size(), num_values);
+    }
+}
+
+TEST(CheckpointTest, mismatching_containers_throw) {
+    Communicator  comm;
+    TemporaryPath path("checkpoint_test_mismatching_containers_throw");
+
+    std::vector<int> values(3, 0);
+    Checkpoint       checkpoint;
+    checkpoint.add("values", values);
+    checkpoint.write(comm, path.path());
+
+    std::vector<double> other;
+    Checkpoint          wrong_type;
+    wrong_type.add("values", other);
+    EXPECT_THROW(wrong_type.restore(comm, path.path()), kassert::KassertException);
+
+    Checkpoint wrong_number;
+    wrong_number.add("values", values);
+    wrong_number.add("more_values", values);
+    EXPECT_THROW(wrong_number.restore(comm, path.path()), kassert::KassertException);
+}
@@ -24,6 +24,9 @@
 #include "kamping/communicator.hpp"
 #include "kamping/data_buffer.hpp"
 #include "kamping/named_parameters.hpp"
+#include "kamping/p2p/irecv.hpp"
+#include "kamping/p2p/isend.hpp"
+#include "kamping/p2p/recv.hpp"
 #include "kamping/span.hpp"
 
 using namespace ::kamping;
@@ -1164,3 +1167,125 @@ TEST(AlltoallTest, structured_bindings_explicit_owning_recv_buffer) {
     EXPECT_EQ(recv_counts, std::vector<int>(comm.size(), 1));
     EXPECT_EQ(recv_displs, iota_container_n(comm.size(), 0));
 }
+
+namespace {
+/// @brief Rank `i` sends `(i + j) % 3 + j % 2` elements to rank `j`, i.e., some blocks are empty, and the receive
+/// blocks are placed in reverse rank order.
+template <typename Algorithm>
+void test_alltoallv_algorithm(Algorithm algorithm) {
+    Communicator comm;
+
+    std::vector<int> send_counts(comm.size());
+    std::vector<int> input;
+    for (size_t dest = 0; dest < comm.size(); ++dest) {
+        send_counts[dest] = static_cast<int>((comm.rank() + dest) % 3 + dest % 2);
+        for (int i = 0; i < send_counts[dest]; ++i) {
+            input.push_back(comm.rank_signed() * 1000 + static_cast<int>(dest) * 10 + i);
+        }
+    }
+    auto const expected = comm.alltoallv(send_buf(input), kamping::send_counts(send_counts));
+    auto const result   = comm.alltoallv(
+        send_buf(input),
+        kamping::send_counts(send_counts),
+        alltoallv_algorithm(algorithm)
+    );
+    EXPECT_EQ(result, expected);
+
+    std::vector<int> recv_counts(comm.size());
+    for (size_t source = 0; source < comm.size(); ++source) {
+        recv_counts[source] = static_cast<int>((source + comm.rank()) % 3 + comm.rank() % 2);
+    }
+    std::vector<int> recv_displs(comm.size());
+    int              offset = 0;
+    for (size_t source = comm.size(); source > 0; --source) {
+        recv_displs[source - 1] = offset;
+        offset += recv_counts[source - 1] + 1;
+    }
+    std::vector<int> recv_buffer(static_cast<size_t>(offset), -1);
+    comm.alltoallv(
+        send_buf(input),
+        kamping::send_counts(send_counts),
+        kamping::recv_counts(recv_counts),
+        kamping::recv_displs(recv_displs),
+        recv_buf(recv_buffer),
+        alltoallv_algorithm(algorithm)
+    );
+    for (size_t source = 0; source < comm.size(); ++source) {
+        for (int i = 0; i < recv_counts[source]; ++i) {
+            EXPECT_EQ(
+                recv_buffer[static_cast<size_t>(recv_displs[source] + i)],
+                static_cast<int>(source) * 1000 + comm.rank_signed() * 10 + i
+            );
+        }
+        // the gaps between the blocks are not overwritten
+        EXPECT_EQ(recv_buffer[static_cast<size_t>(recv_displs[source] + recv_counts[source])], -1);
+    }
+}
+} // namespace
+
+TEST(AlltoallvTest, algorithm_builtin) {
+    test_alltoallv_algorithm(alltoallv_algorithms::builtin);
+}
+
+TEST(AlltoallvTest, algorithm_pairwise) {
+    test_alltoallv_algorithm(alltoallv_algorithms::pairwise);
+}
+
+TEST(AlltoallvTest, algorithm_throttled_linear) {
+    test_alltoallv_algorithm(alltoallv_algorithms::throttled_linear);
+    test_alltoallv_algorithm(alltoallv_algorithms::throttled_linear(1));
+    test_alltoallv_algorithm(alltoallv_algorithms::throttled_linear(3));
+}
+
+TEST(AlltoallvTest, algorithm_bruck) {
+    test_alltoallv_algorithm(alltoallv_algorithms::bruck);
+}
+
+TEST(AlltoallvTest, algorithm_bruck_with_custom_type) {
+    Communicator comm;
+    // each rank sends its rank twice to every rank, using a type consisting of two ints
+    std::vector<int> input(2 * comm.size(), comm.rank_signed());
+    std::vector<int> counts(comm.size(), 1);
+    MPI_Datatype     int_pair;
+    MPI_Type_contiguous(2, MPI_INT, &int_pair);
+    MPI_Type_commit(&int_pair);
+
+    std::vector<int> result(2 * comm.size());
+    comm.alltoallv(
+        send_buf(input),
+        send_counts(counts),
+        send_type(int_pair),
+        recv_buf(result),
+        recv_counts(counts),
+        recv_type(int_pair),
+        alltoallv_algorithm(alltoallv_algorithms::bruck)
+    );
+    MPI_Type_free(&int_pair);
+
+    std::vector<int> expected;
+    for (int source = 0; source < comm.size_signed(); ++source) {
+        expected.push_back(source);
+        expected.push_back(source);
+    }
+    EXPECT_EQ(result, expected);
+}
+
+TEST(AlltoallvTest, algorithms_do_not_match_pending_point_to_point_messages) {
+    Communicator     comm;
+    std::vector<int> input(comm.size(), comm.rank_signed());
+    std::vector<int> counts(comm.size(), 1);
+    auto const       check = [&](auto algorithm) {
+        // a larger message of the application is in flight while the algorithm is running
+        std::vector<int> message(10, comm.rank_signed());
+        auto             pending_send = comm.isend(send_buf(message), destination(comm.rank_shifted_cyclic(1)));
+        auto const       result =
+            comm.alltoallv(send_buf(input), kamping::send_counts(counts), alltoallv_algorithm(algorithm));
+        EXPECT_EQ(result, iota_container_n(comm.size(), 0));
+        auto const received = comm.recv<int>(source(comm.rank_shifted_cyclic(-1)), recv_count(10));
+        EXPECT_THAT(received, Each(static_cast<int>(comm.rank_shifted_cyclic(-1))));
+        pending_send.wait();
+    };
+    check(alltoallv_algorithms::pairwise);
+    check(alltoallv_algorithms::throttled_linear);
+    check(alltoallv_algorithms::bruck);
+}
@@ -0,0 +1,135 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/compression.hpp"
+
+using namespace kamping;
+
+namespace {
+template <typename T>
+std::vector<T> roundtrip(std::vector<T> const& data) {
+    std::vector<char> encoded;
+    internal::encode_delta_varint(data.data(), data.size(), encoded);
+    EXPECT_EQ(internal::decoded_size(encoded.data()), data.size());
+    std::vector<T> decoded(data.size());
+    char const*    end = internal::decode_delta_varint(encoded.data(), decoded.data());
+    EXPECT_EQ(end, encoded.data() + encoded.size());
+    return decoded;
+}
+} // namespace
+
+TEST(CompressionTest, zigzag) {
+    EXPECT_EQ(internal::zigzag_encode(std::uint32_t{0}), 0u);
+    EXPECT_EQ(internal::zigzag_encode(static_cast<std::uint32_t>(-1)), 1u);
+    EXPECT_EQ(internal::zigzag_encode(std::uint32_t{1}), 2u);
+    EXPECT_EQ(internal::zigzag_encode(static_cast<std::uint32_t>(-2)), 3u);
+    for (std::uint64_t value: std::vector<std::uint64_t>{0, 1, 42, std::uint64_t{1} << 63, ~std::uint64_t{0}}) {
+        EXPECT_EQ(internal::zigzag_decode(internal::zigzag_encode(value)), value);
+    }
+}
+
+TEST(CompressionTest, roundtrip) {
+    std::vector<std::uint64_t> sorted(1000);
+    std::iota(sorted.begin(), sorted.end(), std::uint64_t{1} << 40);
+    EXPECT_EQ(roundtrip(sorted), sorted);
+
+    std::vector<int> unsorted = {5, -3, 17, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 0, -1};
+    EXPECT_EQ(roundtrip(unsorted), unsorted);
+
+    std::vector<std::uint8_t> bytes = {0, 255, 128, 127, 1};
+    EXPECT_EQ(roundtrip(bytes), bytes);
+
+    std::vector<std::int16_t> empty;
+    EXPECT_EQ(roundtrip(empty), empty);
+}
+
+TEST(CompressionTest, sorted_sequence_is_smaller_than_uncompressed) {
+    std::vector<std::uint64_t> sorted(1000);
+    std::iota(sorted.begin(), sorted.end(), std::uint64_t{1} << 40);
+    std::vector<char> encoded;
+    internal::encode_delta_varint(sorted.data(), sorted.size(), encoded);
+    // 2 bytes for the size, 6 bytes for the first element and 1 byte for each difference
+    EXPECT_EQ(encoded.size(), 2 + 6 + 999);
+}
+
+TEST(CompressionTest, alltoallv) {
+    Communicator comm;
+    // send rank + 1 sorted IDs to each rank
+    std::vector<std::uint64_t> input;
+    std::vector<int>           counts(comm.size());
+    for (size_t dest = 0; dest < comm.size(); ++dest) {
+        counts[dest] = static_cast<int>(dest + 1);
+        for (size_t i = 0; i <= dest; ++i) {
+            input.push_back(1'000'000 * comm.rank() + 1000 * dest + 3 * i);
+        }
+    }
+
+    auto expected = comm.alltoallv(send_buf(input), send_counts(counts));
+    auto recv_buf = comm.alltoallv(send_buf(compressed(input)), send_counts(counts));
+    EXPECT_EQ(recv_buf, expected);
+}
+
+TEST(CompressionTest, alltoallv_with_counts_and_displs_out) {
+    Communicator comm;
+    // send a block of 2 * rank signed integers to each rank, skipping the first element of the buffer
+    std::vector<long> input(1);
+    std::vector<int>  counts(comm.size(), 2 * comm.rank_signed());
+    for (size_t dest = 0; dest < comm.size(); ++dest) {
+        for (int i = 0; i < counts[dest]; ++i) {
+            input.push_back(static_cast<long>(dest) - i);
+        }
+    }
+    std::vector<int> displs(comm.size());
+    std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), 1);
+
+    auto expected = comm.alltoallv(send_buf(input), send_counts(counts), send_displs(displs));
+    auto [recv_buf, recv_counts, recv_displs] = comm.alltoallv(
+        send_buf(compressed(std::move(input))),
+        send_counts(counts),
+        send_displs(displs),
+        recv_counts_out(),
+        recv_displs_out()
+    );
+    EXPECT_EQ(recv_buf, expected);
+    std::vector<int> expected_counts(comm.size());
+    std::vector<int> expected_displs(comm.size());
+    for (size_t source = 0; source < comm.size(); ++source) {
+        expected_counts[source] = 2 * static_cast<int>(source);
+    }
+    std::exclusive_scan(expected_counts.begin(), expected_counts.end(), expected_displs.begin(), 0);
+    EXPECT_EQ(recv_counts, expected_counts);
+    EXPECT_EQ(recv_displs, expected_displs);
+}
+
+TEST(CompressionTest, alltoallv_with_given_recv_buf) {
+    Communicator     comm;
+    std::vector<int> input(comm.size(), comm.rank_signed());
+    std::vector<int> counts(comm.size(), 1);
+
+    std::vector<int> recv_buffer;
+    comm.alltoallv(send_buf(compressed(input)), send_counts(counts), recv_buf<resize_to_fit>(recv_buffer));
+    std::vector<int> expected(comm.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(recv_buffer, expected);
+}
@@ -0,0 +1,157 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <stdexcept>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/collectives/iallreduce.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/coroutine.hpp"
+#include "kamping/named_parameters.hpp"
+#include "kamping/p2p/irecv.hpp"
+#include "kamping/p2p/isend.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+namespace {
+Task<int> exchange_with_neighbors(Communicator<> const& comm) {
+    int  value   = comm.rank_signed();
+    auto receive = comm.irecv<int>(source(comm.rank_shifted_cyclic(-1)), recv_count(1));
+    co_await comm.isend(send_buf(value), destination(comm.rank_shifted_cyclic(1)));
+    std::vector<int> const received = co_await std::move(receive);
+    co_return received.front();
+}
+
+/// @brief Passes a token around the ring of ranks, where each rank increments it.
+Task<> pass_token(Communicator<> const& comm, int token_id, std::vector<int>& result) {
+    int const token_tag = token_id;
+    if (comm.rank() == 0) {
+        co_await comm.isend(send_buf_out(int{token_id}), destination(comm.rank_shifted_cyclic(1)), tag(token_tag));
+        auto const token =
+            co_await comm.irecv<int>(source(comm.rank_shifted_cyclic(-1)), recv_count(1), tag(token_tag));
+        result[static_cast<size_t>(token_id)] = token.front();
+    } else {
+        auto token = co_await comm.irecv<int>(source(comm.rank_shifted_cyclic(-1)), recv_count(1), tag(token_tag));
+        token.front()++;
+        co_await comm.isend(send_buf_out(std::move(token)), destination(comm.rank_shifted_cyclic(1)), tag(token_tag));
+    }
+}
+
+/// @brief Receives a message from the left neighbor and forwards it to the right neighbor using tag 1.
+Task<std::vector<int>> receive_and_forward(Communicator<> const& comm) {
+    auto data = co_await comm.irecv<int>(source(comm.rank_shifted_cyclic(-1)), recv_count(3));
+    data      = co_await comm.isend(send_buf_out(std::move(data)), destination(comm.rank_shifted_cyclic(1)), tag(1));
+    co_return data;
+}
+
+Task<int> twice(int value) {
+    co_return 2 * value;
+}
+
+Task<int> sum_of_twice(int lhs, int rhs) {
+    int const first  = co_await twice(lhs);
+    int const second = co_await twice(rhs);
+    co_return first + second;
+}
+
+Task<std::vector<int>> global_sum(Communicator<> const& comm, std::vector<int> values) {
+    co_return co_await comm.iallreduce(send_buf(values), op(ops::plus<>{}));
+}
+
+Task<> await_request(Communicator<> const& comm, int& received) {
+    Request receive_request;
+    Request send_request;
+    int     value = 42;
+    comm.irecv(recv_buf(received), recv_count(1), source(comm.rank()), request(receive_request));
+    comm.isend(send_buf(value), destination(comm.rank()), request(send_request));
+    co_await send_request;
+    co_await receive_request;
+}
+
+Task<> throw_after_communication(Communicator<> const& comm) {
+    co_await comm.isend(send_buf_out(int{0}), destination(comm.rank()));
+    co_await comm.irecv<int>(source(comm.rank()), recv_count(1));
+    throw std::runtime_error("failure");
+}
+} // namespace
+
+TEST(CoroutineTest, exchange_with_neighbors) {
+    Communicator<>     comm;
+    CoroutineScheduler scheduler;
+    EXPECT_EQ(scheduler.run_until_complete(exchange_with_neighbors(comm)), comm.rank_shifted_cyclic(-1));
+    EXPECT_EQ(scheduler.num_pending_requests(), 0);
+}
+
+TEST(CoroutineTest, awaited_send_returns_send_buffer) {
+    Communicator<>     comm;
+    CoroutineScheduler scheduler;
+    std::vector<int>   data(3, comm.rank_signed());
+    auto               forwarded = comm.irecv<int>(source(comm.rank_shifted_cyclic(-1)), recv_count(3), tag(1));
+    auto               send      = comm.isend(send_buf(data), destination(comm.rank_shifted_cyclic(1)));
+    EXPECT_THAT(
+        scheduler.run_until_complete(receive_and_forward(comm)),
+        Each(static_cast<int>(comm.rank_shifted_cyclic(-1)))
+    );
+    send.wait();
+    EXPECT_THAT(forwarded.wait(), Each(static_cast<int>(comm.rank_shifted_cyclic(-2))));
+}
+
+TEST(CoroutineTest, many_tasks_in_flight) {
+    Communicator<>     comm;
+    CoroutineScheduler scheduler;
+    int const          num_tokens = 16;
+    std::vector<int>   result(num_tokens, -1);
+    // rank 0 spawns the tokens in reverse order, such that the receives of the other ranks are not matched in order
+    for (int token_id = 0; token_id < num_tokens; ++token_id) {
+        scheduler.spawn(pass_token(comm, comm.rank() == 0 ? num_tokens - 1 - token_id : token_id, result));
+    }
+    scheduler.run();
+    if (comm.rank() == 0) {
+        for (int token_id = 0; token_id < num_tokens; ++token_id) {
+            EXPECT_EQ(result[static_cast<size_t>(token_id)], token_id + comm.size_signed() - 1);
+        }
+    }
+}
+
+TEST(CoroutineTest, nested_tasks) {
+    CoroutineScheduler scheduler;
+    EXPECT_EQ(scheduler.run_until_complete(sum_of_twice(3, 4)), 14);
+}
+
+TEST(CoroutineTest, await_collective) {
+    Communicator<>     comm;
+    CoroutineScheduler scheduler;
+    auto const         sum = scheduler.run_until_complete(global_sum(comm, {1, comm.rank_signed()}));
+    EXPECT_THAT(sum, ElementsAre(comm.size_signed(), comm.size_signed() * (comm.size_signed() - 1) / 2));
+}
+
+TEST(CoroutineTest, await_request) {
+    Communicator<>     comm;
+    CoroutineScheduler scheduler;
+    int                received = 0;
+    scheduler.spawn(await_request(comm, received));
+    scheduler.run();
+    EXPECT_EQ(received, 42);
+}
+
+TEST(CoroutineTest, exceptions_are_rethrown) {
+    Communicator<>     comm;
+    CoroutineScheduler scheduler;
+    scheduler.spawn(throw_after_communication(comm));
+    EXPECT_THROW(scheduler.run(), std::runtime_error);
+    EXPECT_THROW(scheduler.run_until_complete(throw_after_communication(comm)), std::runtime_error);
+}
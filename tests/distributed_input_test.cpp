@@ -0,0 +1,108 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "test_assertions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "helpers_for_testing.hpp"
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/distributed_input.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+namespace {
+/// @brief Reads \p content using read_delimited() and checks that each rank obtains complete records, which form
+/// \p content when concatenated.
+void check_read_delimited(std::string const& name, std::string const& content, char delimiter = '\n') {
+    Communicator            comm;
+    TemporaryPath           file("distributed_input_test_" + name, content);
+    std::vector<char> const local = read_delimited(comm, file.path(), delimiter);
+    if (!local.empty()) {
+        bool const ends_file = std::string(local.begin(), local.end()) == content.substr(content.size() - local.size());
+        EXPECT_TRUE(local.back() == delimiter || ends_file);
+    }
+    std::vector<char> const all = comm.allgatherv(send_buf(local));
+    EXPECT_EQ(std::string(all.begin(), all.end()), content);
+
+    // each rank's part starts with a record
+    auto const sizes = comm.allgather(send_buf(local.size()));
+    size_t     begin = std::accumulate(sizes.begin(), sizes.begin() + comm.rank_signed(), size_t{0});
+    if (!local.empty() && begin > 0) {
+        EXPECT_EQ(content[begin - 1], delimiter);
+    }
+}
+} // namespace
+
+TEST(DistributedInputTest, balanced_partition) {
+    EXPECT_EQ(balanced_partition(10, 0, 3).begin, 0);
+    EXPECT_EQ(balanced_partition(10, 0, 3).end, 4);
+    EXPECT_EQ(balanced_partition(10, 1, 3).begin, 4);
+    EXPECT_EQ(balanced_partition(10, 1, 3).end, 7);
+    EXPECT_EQ(balanced_partition(10, 2, 3).begin, 7);
+    EXPECT_EQ(balanced_partition(10, 2, 3).end, 10);
+    EXPECT_EQ(balanced_partition(2, 3, 4).size(), 0);
+}
+
+TEST(DistributedInputTest, read_balanced) {
+    Communicator          comm;
+    std::vector<uint32_t> values(103);
+    std::iota(values.begin(), values.end(), 0u);
+    TemporaryPath file(
+        "distributed_input_test_read_balanced",
+        std::string(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(uint32_t))
+    );
+
+    std::vector<uint32_t> const local = read_balanced<uint32_t>(comm, file.path());
+    ElementRange const          range = balanced_partition(values.size(), comm.rank(), comm.size());
+    std::vector<uint32_t> const expected(
+        values.begin() + static_cast<std::ptrdiff_t>(range.begin),
+        values.begin() + static_cast<std::ptrdiff_t>(range.end)
+    );
+    EXPECT_EQ(local, expected);
+}
+
+TEST(DistributedInputTest, read_delimited_lines) {
+    std::string content;
+    for (size_t i = 0; i < 100; ++i) {
+        content += "line " + std::to_string(i * i) + "\n";
+    }
+    check_read_delimited("lines", content);
+}
+
+TEST(DistributedInputTest, read_delimited_without_trailing_delimiter) {
+    check_read_delimited("without_trailing_delimiter", "a,bb,ccc,dddd,eeeee,ffffff,ggggggg", ',');
+}
+
+TEST(DistributedInputTest, read_delimited_records_longer_than_ranges) {
+    std::string content = std::string(50, 'a') + "\n" + "b\n" + std::string(30, 'c') + "\n";
+    check_read_delimited("records_longer_than_ranges", content);
+}
+
+TEST(DistributedInputTest, read_delimited_single_record) {
+    check_read_delimited("single_record", std::string(17, 'x'));
+}
+
+TEST(DistributedInputTest, read_delimited_tiny_and_empty_files) {
+    check_read_delimited("tiny", "a\nb\n");
+    check_read_delimited("empty", "");
+}
@@ -0,0 +1,140 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "test_assertions.hpp"
+
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "helpers_for_testing.hpp"
+#include "kamping/collectives/barrier.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/file.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+TEST(FileTest, write_at_and_read_at) {
+    Communicator  comm;
+    TemporaryPath path("file_test_write_at_and_read_at");
+    {
+        File                   file(comm, path.path(), MPI_MODE_CREATE | MPI_MODE_WRONLY);
+        std::vector<int> const data(4, comm.rank_signed());
+        file.write_at(send_buf(data), file_offset(asserting_cast<MPI_Offset>(comm.rank() * 4 * sizeof(int))));
+    }
+    File file(comm, path.path(), MPI_MODE_RDONLY);
+    EXPECT_EQ(file.size(), asserting_cast<MPI_Offset>(comm.size() * 4 * sizeof(int)));
+
+    // every rank reads the data of its right neighbor into a newly allocated buffer
+    size_t const           right = (comm.rank() + 1) % comm.size();
+    std::vector<int> const data =
+        file.read_at<int>(recv_count(4), file_offset(asserting_cast<MPI_Offset>(right * 4 * sizeof(int))));
+    EXPECT_THAT(data, Each(Eq(static_cast<int>(right))));
+}
+
+TEST(FileTest, collective_access_with_view) {
+    Communicator  comm;
+    TemporaryPath path("file_test_collective_access_with_view");
+    FileHints     hints;
+    hints.collective_buffering = true;
+    hints.cb_buffer_size       = 1 << 20;
+    File file(comm, path.path(), MPI_MODE_CREATE | MPI_MODE_RDWR, hints);
+    file.set_view<double>(16);
+
+    std::vector<double> data(3);
+    std::iota(data.begin(), data.end(), static_cast<double>(comm.rank() * 3));
+    file.write_at_all(send_buf(data), file_offset(asserting_cast<MPI_Offset>(comm.rank() * 3)));
+    file.sync();
+    comm.barrier();
+    file.sync();
+    EXPECT_EQ(file.size(), asserting_cast<MPI_Offset>(16 + comm.size() * 3 * sizeof(double)));
+
+    // every rank reads the whole file into a given buffer
+    std::vector<double> all_data(comm.size() * 3);
+    file.read_at_all(recv_buf(all_data), file_offset(0));
+    std::vector<double> expected(comm.size() * 3);
+    std::iota(expected.begin(), expected.end(), 0.0);
+    EXPECT_EQ(all_data, expected);
+}
+
+TEST(FileTest, read_at_end_of_file_with_status) {
+    Communicator  comm;
+    TemporaryPath path("file_test_read_at_end_of_file_with_status");
+    File          file(comm, path.path(), MPI_MODE_CREATE | MPI_MODE_RDWR);
+    file.set_view<int>();
+    if (comm.rank() == 0) {
+        file.write_at(send_buf(std::vector<int>{1, 2, 3}), file_offset(0));
+    }
+    file.sync();
+    comm.barrier();
+    file.sync();
+
+    std::vector<int> data;
+    auto             status = file.read_at(recv_buf<resize_to_fit>(data), recv_count(5), file_offset(1), status_out())
+                      .extract_status();
+    EXPECT_EQ(data.size(), 5);
+    EXPECT_EQ(status.count<int>(), 2);
+    EXPECT_EQ(data[0], 2);
+    EXPECT_EQ(data[1], 3);
+}
+
+TEST(FileTest, nonblocking_access) {
+    Communicator  comm;
+    TemporaryPath path("file_test_nonblocking_access");
+    File          file(comm, path.path(), MPI_MODE_CREATE | MPI_MODE_RDWR);
+    file.set_view<int>();
+
+    std::vector<int> data(2, comm.rank_signed());
+    auto             write_request = file.iwrite_at(send_buf(std::move(data)), file_offset(comm.rank_signed() * 2));
+    write_request.wait();
+    auto collective_write_request =
+        file.iwrite_at_all(send_buf(std::vector<int>{-1}), file_offset(comm.size_signed() * 2 + comm.rank_signed()));
+    collective_write_request.wait();
+    file.sync();
+    comm.barrier();
+    file.sync();
+
+    std::vector<int> const own = file.iread_at<int>(recv_count(2), file_offset(comm.rank_signed() * 2)).wait();
+    EXPECT_THAT(own, ElementsAre(comm.rank_signed(), comm.rank_signed()));
+
+    std::vector<int> all(comm.size() * 3);
+    file.iread_at_all(recv_buf(all), file_offset(0)).wait();
+    for (size_t rank = 0; rank < comm.size(); ++rank) {
+        EXPECT_EQ(all[2 * rank], static_cast<int>(rank));
+        EXPECT_EQ(all[2 * rank + 1], static_cast<int>(rank));
+        EXPECT_EQ(all[2 * comm.size() + rank], -1);
+    }
+}
+
+TEST(FileTest, resize_and_move) {
+    Communicator  comm;
+    TemporaryPath path("file_test_resize_and_move");
+    File          file(comm, path.path(), MPI_MODE_CREATE | MPI_MODE_RDWR);
+    file.resize(128);
+    EXPECT_EQ(file.size(), 128);
+
+    MPI_File handle = file.mpi_file();
+    File     moved(std::move(file));
+    EXPECT_EQ(moved.mpi_file(), handle);
+    EXPECT_EQ(file.mpi_file(), MPI_FILE_NULL);
+}
+
+TEST(FileTest, open_missing_file_throws) {
+    Communicator comm;
+    EXPECT_THROW(File(comm, "/nonexistent/kamping_file_test", MPI_MODE_RDONLY), MpiErrorException);
+}
@@ -20,13 +20,18 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <initializer_list>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <vector>
 
 #include <mpi.h>
 
+#include "kamping/collectives/barrier.hpp"
+#include "kamping/communicator.hpp"
 #include "kamping/data_buffer.hpp"
 #include "kamping/distributed_graph_communicator.hpp"
 #include "kamping/named_parameter_check.hpp"
@@ -483,5 +488,62 @@ are_equal(kamping::CommunicationGraphLocalView const& lhs, kamping::Communicatio
            && compare_optional_span(lhs.out_weights(), rhs.out_weights());
 }
 
+/// @brief Input of an alltoallv exchange, in which rank `i` sends `count(i, j)` elements to rank `j`. The elements
+/// encode source, destination and index (see \ref element()).
+struct AlltoallvInput {
+    /// @brief Constructs the input of \p rank in a communicator of size \p size.
+    template <typename CountFunction>
+    AlltoallvInput(size_t rank, size_t size, CountFunction&& count) : send_counts(size) {
+        for (size_t dest = 0; dest < size; ++dest) {
+            send_counts[dest] = static_cast<int>(count(rank, dest));
+            for (size_t i = 0; i < static_cast<size_t>(send_counts[dest]); ++i) {
+                data.push_back(element(rank, dest, i));
+            }
+        }
+    }
+
+    /// @brief Returns the \p index-th element sent from \p source to \p dest.
+    static int element(size_t source, size_t dest, size_t index) {
+        return static_cast<int>(source * 1000000 + dest * 1000 + index);
+    }
+
+    std::vector<int> data;        ///< The elements to send, ordered by destination.
+    std::vector<int> send_counts; ///< The number of elements sent to each rank.
+};
+
+/// @brief A path in the temporary directory which is the same on all ranks. The file at this path is removed when the
+/// object is destroyed. Construction and destruction are collective operations on \c MPI_COMM_WORLD.
+class TemporaryPath {
+public:
+    /// @brief Constructs the path of the file `kamping_<name>`, which is not created.
+    explicit TemporaryPath(std::string const& name)
+        : _path((std::filesystem::temp_directory_path() / ("kamping_" + name)).string()) {}
+
+    /// @brief Constructs the path of the file `kamping_<name>`, and writes \p content to it on rank 0.
+    TemporaryPath(std::string const& name, std::string const& content) : TemporaryPath(name) {
+        if (_comm.rank() == 0) {
+            std::ofstream(_path, std::ios::binary) << content;
+        }
+        _comm.barrier();
+    }
+
+    /// @brief Removes the file after all ranks are done with it.
+    ~TemporaryPath() {
+        _comm.barrier();
+        if (_comm.rank() == 0) {
+            std::filesystem::remove(_path);
+        }
+    }
+
+    /// @brief Returns the path.
+    std::string const& path() const {
+        return _path;
+    }
+
+private:
+    kamping::Communicator<> _comm; ///< The communicator used for synchronization.
+    std::string             _path; ///< The path.
+};
+
 /// @}
 } // namespace testing
@@ -0,0 +1,165 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/large_count.hpp"
+#include "kamping/p2p/recv.hpp"
+#include "kamping/p2p/send.hpp"
+#include "kamping/types/scoped_datatype.hpp"
+
+using namespace kamping;
+
+namespace {
+/// Sends `count` ints starting at `offset` to itself using a large_contiguous_type with the given maximum block length.
+std::vector<int> transfer_to_self(std::vector<int> const& data, MPI_Count count, MPI_Aint offset, int block_length) {
+    types::ScopedDatatype type(
+        internal::large_contiguous_type(count, MPI_INT, offset * static_cast<MPI_Aint>(sizeof(int)), block_length)
+    );
+    std::vector<int> received(data.size(), -1);
+    MPI_Sendrecv(
+        data.data(),
+        1,
+        type.data_type(),
+        0,
+        0,
+        received.data(),
+        1,
+        type.data_type(),
+        0,
+        0,
+        MPI_COMM_SELF,
+        MPI_STATUS_IGNORE
+    );
+    return received;
+}
+} // namespace
+
+TEST(LargeCountTest, fits_in_int) {
+    EXPECT_TRUE(internal::fits_in_int(0));
+    EXPECT_TRUE(internal::fits_in_int(std::int64_t{2147483647}));
+    EXPECT_FALSE(internal::fits_in_int(std::int64_t{2147483648}));
+    EXPECT_FALSE(internal::fits_in_int(std::uint64_t{1} << 40));
+}
+
+TEST(LargeCountTest, large_contiguous_type) {
+    std::vector<int> data(20);
+    std::iota(data.begin(), data.end(), 0);
+
+    // full blocks and a remainder
+    auto received = transfer_to_self(data, 10, 2, 3);
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(received[i], i >= 2 && i < 12 ? data[i] : -1);
+    }
+    // only full blocks
+    received = transfer_to_self(data, 9, 0, 3);
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(received[i], i < 9 ? data[i] : -1);
+    }
+    // only a remainder
+    received = transfer_to_self(data, 2, 5, 3);
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(received[i], i >= 5 && i < 7 ? data[i] : -1);
+    }
+    // no elements at all
+    received = transfer_to_self(data, 0, 0, 3);
+    EXPECT_EQ(received, std::vector<int>(data.size(), -1));
+}
+
+TEST(LargeCountTest, count_and_type) {
+    internal::CountAndType small(size_t{42}, MPI_INT);
+    EXPECT_FALSE(small.uses_large_type());
+    EXPECT_EQ(small.count(), 42);
+    EXPECT_EQ(small.type(), MPI_INT);
+
+    internal::CountAndType large(std::int64_t{1} << 32, MPI_INT);
+    EXPECT_TRUE(large.uses_large_type());
+    EXPECT_EQ(large.count(), 1);
+    MPI_Count type_size;
+    MPI_Type_size_x(large.type(), &type_size);
+    EXPECT_EQ(type_size, (MPI_Count{1} << 32) * static_cast<MPI_Count>(sizeof(int)));
+}
+
+TEST(LargeCountTest, large_count_of_status) {
+    Communicator     comm;
+    std::vector<int> data(5, comm.rank_signed());
+    MPI_Request      request;
+    MPI_Isend(data.data(), 5, MPI_INT, comm.rank_signed(), 0, comm.mpi_communicator(), &request);
+    MPI_Status status;
+    MPI_Probe(comm.rank_signed(), 0, comm.mpi_communicator(), &status);
+    EXPECT_EQ(internal::large_count(status, MPI_INT), 5);
+    EXPECT_EQ(internal::large_count(status, MPI_CHAR), 5 * static_cast<MPI_Count>(sizeof(int)));
+    auto received = comm.recv<int>(source(comm.rank()), tag(0));
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    EXPECT_EQ(received, data);
+}
+
+TEST(LargeCountTest, alltoallv_with_64_bit_counts) {
+    Communicator comm;
+    // send rank + 1 elements to each rank
+    std::vector<int>          input;
+    std::vector<int>          counts(comm.size());
+    std::vector<std::int64_t> large_counts(comm.size());
+    for (size_t dest = 0; dest < comm.size(); ++dest) {
+        counts[dest]       = static_cast<int>(dest + 1);
+        large_counts[dest] = static_cast<std::int64_t>(dest + 1);
+        for (size_t i = 0; i <= dest; ++i) {
+            input.push_back(comm.rank_signed() * 100 + static_cast<int>(dest));
+        }
+    }
+
+    auto expected = comm.alltoallv(send_buf(input), send_counts(counts));
+    auto [recv_buf, recv_counts, recv_displs] = comm.alltoallv(
+        send_buf(input),
+        send_counts(large_counts),
+        recv_counts_out(alloc_new<std::vector<std::int64_t>>),
+        recv_displs_out(alloc_new<std::vector<std::int64_t>>)
+    );
+    EXPECT_EQ(recv_buf, expected);
+    std::vector<std::int64_t> expected_counts(comm.size(), static_cast<std::int64_t>(comm.rank() + 1));
+    std::vector<std::int64_t> expected_displs(comm.size());
+    std::exclusive_scan(expected_counts.begin(), expected_counts.end(), expected_displs.begin(), std::int64_t{0});
+    EXPECT_EQ(recv_counts, expected_counts);
+    EXPECT_EQ(recv_displs, expected_displs);
+}
+
+TEST(LargeCountTest, alltoallv_with_size_t_counts_and_given_displs) {
+    Communicator comm;
+    // send one element to each rank in reverse order and receive them in reverse order
+    std::vector<int>    input(comm.size());
+    std::vector<size_t> counts(comm.size(), 1);
+    std::vector<size_t> displs(comm.size());
+    for (size_t dest = 0; dest < comm.size(); ++dest) {
+        input[dest]  = static_cast<int>(comm.size() - 1 - dest);
+        displs[dest] = comm.size() - 1 - dest;
+    }
+
+    std::vector<int> recv_buffer;
+    comm.alltoallv(
+        send_buf(input),
+        send_counts(counts),
+        send_displs(displs),
+        recv_counts(counts),
+        recv_displs(displs),
+        recv_buf<resize_to_fit>(recv_buffer)
+    );
+    EXPECT_EQ(recv_buffer, std::vector<int>(comm.size(), comm.rank_signed()));
+}
@@ -147,6 +147,22 @@ TEST_F(SendTest, send_vector_with_explicit_send_count) {
     }
 }
 
+TEST_F(SendTest, send_vector_with_send_count_out) {
+    Communicator comm;
+    auto         other_rank = (comm.root() + 1) % comm.size();
+    if (comm.is_root()) {
+        std::vector<int> values{42, 3, 8, 7, 1};
+        int              count = -1;
+        comm.send(send_buf(values), send_count_out(count), destination(other_rank));
+        EXPECT_EQ(count, 5);
+        EXPECT_EQ(send_counter, 1);
+    } else if (comm.rank() == other_rank) {
+        std::vector<int> result(5, -1);
+        MPI_Recv(result.data(), 5, MPI_INT, comm.root_signed(), 0, comm.mpi_communicator(), MPI_STATUS_IGNORE);
+        EXPECT_THAT(result, ElementsAre(42, 3, 8, 7, 1));
+    }
+}
+
 TEST_F(SendTest, send_vector_null) {
     Communicator     comm;
     std::vector<int> values{42, 3, 8, 7};
@@ -0,0 +1,229 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/collectives/bcast.hpp"
+#include "kamping/collectives/scatter.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/p2p/recv.hpp"
+#include "kamping/p2p/send.hpp"
+#include "kamping/packing.hpp"
+#include "kamping/serialization.hpp"
+
+using namespace kamping;
+
+namespace {
+struct Point {
+    double x;
+    double y;
+    bool   operator==(Point const& other) const {
+        return x == other.x && y == other.y;
+    }
+};
+
+template <typename T>
+T pack_and_unpack(T const& value) {
+    std::vector<char> buffer(packed_size(value));
+    char*             end = pack(value, buffer.data());
+    EXPECT_EQ(end, buffer.data() + buffer.size());
+    T           result{};
+    char const* read_end = unpack(buffer.data(), buffer.size(), result);
+    EXPECT_EQ(read_end, buffer.data() + buffer.size());
+    return result;
+}
+} // namespace
+
+TEST(PackingTest, is_packable) {
+    EXPECT_TRUE(is_packable_v<int>);
+    EXPECT_TRUE(is_packable_v<Point>);
+    EXPECT_TRUE((is_packable_v<std::vector<std::vector<int>>>));
+    EXPECT_TRUE((is_packable_v<std::vector<std::string>>));
+    EXPECT_TRUE((is_packable_v<std::pair<std::vector<int>, std::vector<double>>>));
+    EXPECT_TRUE((is_packable_v<std::tuple<int, std::string, std::vector<Point>>>));
+    EXPECT_TRUE((is_packable_v<std::array<std::string, 3>>));
+    EXPECT_FALSE((is_packable_v<std::vector<bool>>));
+    EXPECT_FALSE((is_packable_v<std::vector<std::vector<bool>>>));
+}
+
+TEST(PackingTest, packed_size) {
+    EXPECT_EQ(packed_size(42), sizeof(int));
+    EXPECT_EQ(packed_size(std::vector<int>{1, 2, 3}), sizeof(std::uint64_t) + 3 * sizeof(int));
+    EXPECT_EQ(packed_size(std::string("abc")), sizeof(std::uint64_t) + 3);
+    std::vector<std::vector<int>> nested = {{1}, {}, {2, 3}};
+    EXPECT_EQ(packed_size(nested), 4 * sizeof(std::uint64_t) + 3 * sizeof(int));
+    EXPECT_EQ(packed_size(std::array<int, 4>{}), 4 * sizeof(int));
+}
+
+TEST(PackingTest, roundtrip) {
+    EXPECT_EQ(pack_and_unpack(42), 42);
+    EXPECT_EQ(pack_and_unpack(Point{1.0, 2.0}), (Point{1.0, 2.0}));
+
+    std::vector<std::vector<int>> nested = {{1, 2, 3}, {}, {4}};
+    EXPECT_EQ(pack_and_unpack(nested), nested);
+
+    std::vector<std::string> strings = {"foo", "", std::string(1000, 'x')};
+    EXPECT_EQ(pack_and_unpack(strings), strings);
+
+    std::pair<std::vector<int>, std::vector<Point>> pair = {{1, 2}, {{1.0, 2.0}, {3.0, 4.0}}};
+    EXPECT_EQ(pack_and_unpack(pair), pair);
+
+    std::tuple<int, std::string, std::vector<double>> tuple = {1, "two", {3.0, 4.0}};
+    EXPECT_EQ(pack_and_unpack(tuple), tuple);
+
+    std::array<std::string, 2> array = {"a", "bc"};
+    EXPECT_EQ(pack_and_unpack(array), array);
+}
+
+TEST(PackingTest, unpack_into_non_empty_object) {
+    std::vector<std::string> strings = {"foo", "bar"};
+    std::vector<char>        buffer(packed_size(strings));
+    pack(strings, buffer.data());
+    std::vector<std::string> result = {"a", "b", "c", "d"};
+    unpack(buffer.data(), buffer.size(), result);
+    EXPECT_EQ(result, strings);
+}
+
+TEST(PackingTest, unpack_truncated_data_throws) {
+    std::vector<std::string> strings = {"foo", "bar"};
+    std::vector<char>        buffer(packed_size(strings));
+    pack(strings, buffer.data());
+    std::vector<std::string> result;
+    EXPECT_THROW(unpack(buffer.data(), buffer.size() - 1, result), std::out_of_range);
+    EXPECT_THROW(unpack(buffer.data(), 0, result), std::out_of_range);
+
+    std::stringstream   stream(std::string(buffer.data(), buffer.size() - 1));
+    PackingInputArchive archive(stream);
+    EXPECT_THROW(archive(result), std::out_of_range);
+}
+
+TEST(PackingTest, unpack_corrupted_length_throws_before_allocating) {
+    // a length larger than the remaining data must be rejected instead of resizing the container to it
+    std::vector<char>   buffer(sizeof(std::uint64_t) + sizeof(int));
+    std::uint64_t const length = std::numeric_limits<std::uint64_t>::max() / 2;
+    std::memcpy(buffer.data(), &length, sizeof(length));
+    std::vector<int> ints;
+    EXPECT_THROW(unpack(buffer.data(), buffer.size(), ints), std::out_of_range);
+    EXPECT_TRUE(ints.empty());
+    std::vector<std::string> strings;
+    EXPECT_THROW(unpack(buffer.data(), buffer.size(), strings), std::out_of_range);
+    EXPECT_TRUE(strings.empty());
+}
+
+TEST(PackingTest, archives) {
+    std::vector<std::vector<int>> nested = {{1, 2, 3}, {}, {4}};
+    std::string                   first  = "first";
+    std::stringstream             stream;
+    {
+        PackingOutputArchive archive(stream);
+        archive(nested, first);
+    }
+    EXPECT_EQ(stream.str().size(), packed_size(nested) + packed_size(first));
+    std::vector<std::vector<int>> nested_result;
+    std::string                   first_result;
+    {
+        PackingInputArchive archive(stream);
+        archive(nested_result, first_result);
+    }
+    EXPECT_EQ(nested_result, nested);
+    EXPECT_EQ(first_result, first);
+}
+
+TEST(PackingTest, packing_buffer_packs_into_communication_buffer) {
+    std::vector<std::string> data   = {"a", "bb", "ccc"};
+    auto                     buffer = as_packed(data);
+    buffer.serialize();
+    EXPECT_EQ(buffer.size(), packed_size(data));
+
+    std::vector<int> counts;
+    buffer.serialize_each(counts);
+    EXPECT_THAT(counts, ::testing::ElementsAre(9, 10, 11));
+    EXPECT_EQ(buffer.size(), 30u);
+}
+
+TEST(PackingTest, send_recv) {
+    Communicator                  comm;
+    std::vector<std::vector<int>> data = {{1, 2}, {3}, {}};
+    if (comm.is_root()) {
+        for (size_t dst = 0; dst < comm.size(); ++dst) {
+            if (!comm.is_root(dst)) {
+                comm.send(send_buf(as_packed(data)), destination(dst));
+            }
+        }
+    } else {
+        auto result = comm.recv(recv_buf(as_unpackable<std::vector<std::vector<int>>>()));
+        EXPECT_EQ(result, data);
+    }
+}
+
+TEST(PackingTest, bcast) {
+    Communicator                                     comm;
+    std::pair<std::vector<int>, std::vector<double>> data;
+    if (comm.is_root()) {
+        data = {{1, 2, 3}, {4.0, 5.0}};
+    }
+    comm.bcast(send_recv_buf(as_packed(data)));
+    EXPECT_THAT(data.first, ::testing::ElementsAre(1, 2, 3));
+    EXPECT_THAT(data.second, ::testing::ElementsAre(4.0, 5.0));
+}
+
+TEST(PackingTest, alltoallv) {
+    Communicator                  comm;
+    std::vector<std::vector<int>> data(comm.size());
+    for (size_t dst = 0; dst < comm.size(); ++dst) {
+        data[dst].assign(dst + 1, comm.rank_signed());
+    }
+    auto received = comm.alltoallv(send_buf(as_packed(data)));
+    ASSERT_EQ(received.size(), comm.size());
+    for (size_t source = 0; source < comm.size(); ++source) {
+        EXPECT_EQ(received.deserialize(source), std::vector<int>(comm.rank() + 1, static_cast<int>(source)));
+    }
+}
+
+TEST(PackingTest, allgatherv) {
+    Communicator comm;
+    std::string  data(comm.rank() + 1, 'a');
+    auto         received = comm.allgatherv(send_buf(as_packed(data)));
+    std::vector<std::string> expected;
+    for (size_t source = 0; source < comm.size(); ++source) {
+        expected.emplace_back(source + 1, 'a');
+    }
+    EXPECT_EQ(received.deserialize_all(), expected);
+}
+
+TEST(PackingTest, scatterv) {
+    Communicator                  comm;
+    std::vector<std::vector<int>> data;
+    if (comm.is_root()) {
+        for (size_t dst = 0; dst < comm.size(); ++dst) {
+            data.emplace_back(dst, 42);
+        }
+    }
+    auto received = comm.scatterv(send_buf(as_packed(data)), recv_buf(as_unpackable<std::vector<int>>()));
+    EXPECT_EQ(received, std::vector<int>(comm.rank(), 42));
+}
@@ -0,0 +1,83 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/allocator.hpp"
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/page_allocator.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+TEST(PageAllocatorTest, small_and_large_allocations) {
+    PageAllocator<double> alloc;
+    for (size_t n: std::vector<size_t>{1, 100, numa_local_huge_pages::min_bytes / sizeof(double), size_t{1} << 20}) {
+        double* ptr = alloc.allocate(n);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t), 0);
+        if (n * sizeof(double) >= numa_local_huge_pages::min_bytes) {
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % kamping::internal::page_size(), 0);
+        }
+        std::iota(ptr, ptr + n, 0.0);
+        EXPECT_EQ(ptr[n - 1], static_cast<double>(n - 1));
+        alloc.deallocate(ptr, n);
+    }
+}
+
+TEST(PageAllocatorTest, touch_on_allocation) {
+    using Policy = PagePolicy<false, true, true>;
+    PageAllocator<char, Policy> alloc;
+    size_t const                n   = 4 * Policy::min_bytes;
+    char*                       ptr = alloc.allocate(n);
+    // touched pages are zero-initialized
+    EXPECT_EQ(std::count(ptr, ptr + n, 0), n);
+    alloc.deallocate(ptr, n);
+}
+
+TEST(PageAllocatorTest, rebind_and_equality) {
+    PageAllocator<int>                                             int_alloc;
+    std::allocator_traits<decltype(int_alloc)>::rebind_alloc<char> char_alloc(int_alloc);
+    static_assert(std::is_same_v<decltype(char_alloc), PageAllocator<char>>);
+    EXPECT_TRUE(int_alloc == char_alloc);
+}
+
+TEST(PageAllocatorTest, numa_local_vector_as_default_container_type) {
+    Communicator<numa_local_vector> comm;
+    // large enough to be backed by pages
+    size_t const     block_size = numa_local_huge_pages::min_bytes / sizeof(int);
+    std::vector<int> input(comm.size() * block_size);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<int>(i / block_size);
+    }
+    std::vector<int> const counts(comm.size(), static_cast<int>(block_size));
+
+    auto recv_buf = comm.alltoallv(send_buf(input), send_counts(counts));
+    static_assert(std::is_same_v<decltype(recv_buf), numa_local_vector<int>>);
+    EXPECT_EQ(recv_buf.size(), comm.size() * block_size);
+    EXPECT_THAT(recv_buf, Each(comm.rank_signed()));
+}
+
+TEST(PageAllocatorTest, with_default_init_allocator) {
+    std::vector<int, DefaultInitAllocator<int, PageAllocator<int>>> v;
+    v.resize(1 << 20);
+    v.back() = 42;
+    EXPECT_EQ(v.back(), 42);
+}
@@ -0,0 +1,140 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/communicator.hpp"
+#include "kamping/environment.hpp"
+#include "kamping/partitioned.hpp"
+#include "kamping/span.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+TEST(PartitionedTest, partitions) {
+    Communicator     comm;
+    std::vector<int> data(12);
+    auto             send = PartitionedSend<int>::init(comm, Span<int>(data), 4, destination(comm.rank()));
+    EXPECT_EQ(send.num_partitions(), 4);
+    EXPECT_EQ(send.partition_size(), 3);
+    EXPECT_EQ(send.data().data(), data.data());
+    EXPECT_EQ(send.partition(2).data(), data.data() + 6);
+    EXPECT_EQ(send.partition(2).size(), 3);
+
+    auto recv = PartitionedRecv<int>::init(comm, Span<int>(data), 6, source(comm.rank()));
+    EXPECT_EQ(recv.num_partitions(), 6);
+    EXPECT_EQ(recv.partition_size(), 2);
+    EXPECT_EQ(recv.partition(5).data(), data.data() + 10);
+}
+
+TEST(PartitionedTest, ring_with_partitions_ready_in_reverse_order) {
+    Communicator     comm;
+    size_t const     num_partitions = 4;
+    size_t const     partition_size = 3;
+    std::vector<int> send_data(num_partitions * partition_size);
+    std::vector<int> recv_data(num_partitions * partition_size, -1);
+    auto send = PartitionedSend<int>::init(
+        comm,
+        Span<int>(send_data),
+        num_partitions,
+        destination(comm.rank_shifted_cyclic(1)),
+        tag(3)
+    );
+    auto recv = PartitionedRecv<int>::init(
+        comm,
+        Span<int>(recv_data),
+        num_partitions,
+        source(comm.rank_shifted_cyclic(-1)),
+        tag(3)
+    );
+
+    // the persistent operations can be started multiple times
+    for (int round = 0; round < 3; ++round) {
+        recv.start();
+        send.start();
+        for (size_t partition = num_partitions; partition-- > 0;) {
+            auto elements = send.partition(partition);
+            std::fill(elements.begin(), elements.end(), comm.rank_signed() + round * 100);
+            send.pready(partition);
+        }
+        recv.wait();
+        send.wait();
+        for (size_t partition = 0; partition < num_partitions; ++partition) {
+            EXPECT_TRUE(recv.parrived(partition));
+        }
+        EXPECT_THAT(recv_data, Each(static_cast<int>(comm.rank_shifted_cyclic(-1)) + round * 100));
+    }
+}
+
+TEST(PartitionedTest, partial_arrival) {
+    Communicator     comm;
+    std::vector<int> send_data{1, 2, 3, 4};
+    std::vector<int> recv_data(4, -1);
+    auto             send = PartitionedSend<int>::init(comm, Span<int>(send_data), 2, destination(comm.rank()));
+    auto             recv = PartitionedRecv<int>::init(comm, Span<int>(recv_data), 2, source(comm.rank()));
+    recv.start();
+    send.start();
+    send.pready(0);
+    while (!recv.parrived(0)) {
+    }
+    EXPECT_THAT(recv.partition(0), ElementsAre(1, 2));
+    EXPECT_FALSE(recv.parrived(1));
+    EXPECT_FALSE(recv.test());
+
+    send.pready_range(1, 2);
+    recv.wait();
+    send.wait();
+    EXPECT_TRUE(recv.parrived(1));
+    EXPECT_THAT(recv_data, ElementsAre(1, 2, 3, 4));
+}
+
+TEST(PartitionedTest, threads_mark_their_partitions_ready) {
+    if (mpi_env.thread_level() < ThreadLevel::multiple) {
+        // Concurrent MPI calls are not allowed.
+        return;
+    }
+    Communicator     comm;
+    size_t const     num_threads    = 4;
+    size_t const     partition_size = 100;
+    std::vector<int> send_data(num_threads * partition_size);
+    std::vector<int> recv_data(num_threads * partition_size, -1);
+    auto send =
+        PartitionedSend<int>::init(comm, Span<int>(send_data), num_threads, destination(comm.rank_shifted_cyclic(1)));
+    auto recv =
+        PartitionedRecv<int>::init(comm, Span<int>(recv_data), num_threads, source(comm.rank_shifted_cyclic(-1)));
+    recv.start();
+    send.start();
+
+    std::vector<std::thread> threads;
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+        threads.emplace_back([&, thread_id]() {
+            auto elements = send.partition(thread_id);
+            std::fill(elements.begin(), elements.end(), static_cast<int>(thread_id));
+            send.pready(thread_id);
+            while (!recv.parrived(thread_id)) {
+            }
+            EXPECT_THAT(recv.partition(thread_id), Each(static_cast<int>(thread_id)));
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    send.wait();
+    recv.wait();
+}
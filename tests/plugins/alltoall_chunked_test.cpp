@@ -0,0 +1,118 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "../test_assertions.hpp"
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../helpers_for_testing.hpp"
+#include "kamping/plugin/alltoall_chunked.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+using namespace ::plugin;
+using namespace ::chunked_alltoall;
+
+namespace {
+/// @brief Rank `i` sends `(i + j) % 5 + j` elements to rank `j`.
+size_t chunked_alltoall_count(size_t source, size_t dest) {
+    return (source + dest) % 5 + dest;
+}
+} // namespace
+
+TEST(ChunkedAlltoallTest, distribute_budget) {
+    std::vector<size_t> quota(4);
+    chunked_alltoall::internal::distribute_budget({10, 0, 1, 10}, 7, quota);
+    EXPECT_THAT(quota, ElementsAre(3, 0, 1, 3));
+    chunked_alltoall::internal::distribute_budget({10, 0, 1, 10}, 100, quota);
+    EXPECT_THAT(quota, ElementsAre(10, 0, 1, 10));
+    chunked_alltoall::internal::distribute_budget({10, 0, 1, 10}, 1, quota);
+    EXPECT_THAT(quota, ElementsAre(0, 0, 0, 1));
+    chunked_alltoall::internal::distribute_budget({10, 0, 0, 10}, 1, quota);
+    EXPECT_THAT(quota, ElementsAre(0, 0, 0, 1));
+    chunked_alltoall::internal::distribute_budget({0, 0, 0, 0}, 5, quota);
+    EXPECT_THAT(quota, ElementsAre(0, 0, 0, 0));
+}
+
+TEST(ChunkedAlltoallTest, matches_alltoallv) {
+    Communicator<std::vector, plugin::ChunkedAlltoall> comm;
+    AlltoallvInput const                               input(comm.rank(), comm.size(), chunked_alltoall_count);
+    auto const expected = comm.alltoallv(send_buf(input.data), send_counts(input.send_counts));
+
+    for (size_t budget_elements: std::vector<size_t>{1, 2, 3, 7, 1000}) {
+        std::vector<std::vector<int>> received(comm.size());
+        size_t                        num_rounds = 0;
+        comm.alltoallv_chunked(
+            send_buf(input.data),
+            send_counts(input.send_counts),
+            memory_budget(budget_elements * sizeof(int)),
+            on_chunk([&](Chunk<int> const& chunk) {
+                EXPECT_EQ(chunk.round(), num_rounds);
+                ++num_rounds;
+                size_t total = 0;
+                for (size_t source = 0; source < chunk.received().size(); ++source) {
+                    auto const block = chunk.received()[source];
+                    received[source].insert(received[source].end(), block.begin(), block.end());
+                    total += block.size();
+                }
+                EXPECT_LE(total, budget_elements);
+            })
+        );
+        std::vector<int> result;
+        for (auto const& block: received) {
+            result.insert(result.end(), block.begin(), block.end());
+        }
+        EXPECT_EQ(result, expected);
+        EXPECT_GE(num_rounds, 1);
+    }
+}
+
+TEST(ChunkedAlltoallTest, sent_regions_cover_send_buf) {
+    Communicator<std::vector, plugin::ChunkedAlltoall> comm;
+    AlltoallvInput const                               input(comm.rank(), comm.size(), chunked_alltoall_count);
+    std::vector<int>                                   displs(comm.size());
+    std::exclusive_scan(input.send_counts.begin(), input.send_counts.end(), displs.begin(), 0);
+
+    std::vector<int> released(input.data.size(), 0);
+    comm.alltoallv_chunked(
+        send_buf(input.data),
+        send_counts(input.send_counts),
+        send_displs(displs),
+        memory_budget(2 * sizeof(int)),
+        on_chunk([&](Chunk<int> const& chunk) {
+            for (auto const& block: chunk.sent()) {
+                for (int const& element: block) {
+                    released[static_cast<size_t>(&element - input.data.data())]++;
+                }
+            }
+        })
+    );
+    EXPECT_THAT(released, Each(1));
+}
+
+TEST(ChunkedAlltoallTest, empty_exchange) {
+    Communicator<std::vector, plugin::ChunkedAlltoall> comm;
+    std::vector<int>                                   data;
+    std::vector<int>                                   counts(comm.size(), 0);
+    size_t                                             num_rounds = 0;
+    comm.alltoallv_chunked(send_buf(data), send_counts(counts), on_chunk([&](Chunk<int> const& chunk) {
+                               EXPECT_EQ(chunk.received().size(), comm.size());
+                               ++num_rounds;
+                           }));
+    EXPECT_EQ(num_rounds, 1);
+}
@@ -78,6 +78,26 @@ TEST(DispatchAlltoallTest, alltoallv_disptach_single_element_maximum_threshold)
     EXPECT_THAT(recv_counts, Each(1));
 }
 
+TEST(DispatchAlltoallTest, alltoallv_dispatch_with_algorithm) {
+    Communicator<std::vector, plugin::GridCommunicator, plugin::DispatchAlltoall> comm;
+
+    std::vector<int> input(comm.size());
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<int> send_counts(comm.size(), 1);
+
+    for (size_t threshold: {size_t{0}, std::numeric_limits<size_t>::max()}) {
+        // the algorithm is used by the builtin exchange and ignored by the grid exchange
+        auto result = comm.alltoallv_dispatch(
+            send_buf(input),
+            kamping::send_counts(send_counts),
+            comm_volume_threshold(threshold),
+            alltoallv_algorithm(alltoallv_algorithms::pairwise)
+        );
+        EXPECT_EQ(result.size(), comm.size());
+        EXPECT_THAT(result, Each(comm.rank_signed()));
+    }
+}
+
 TEST(DispatchAlltoallGridTest, alltoallv_single_element_st_binding) {
     Communicator<std::vector, plugin::GridCommunicator> comm;
     auto                                                grid_comm = comm.make_grid_communicator();
@@ -0,0 +1,114 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "../test_assertions.hpp"
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../helpers_for_testing.hpp"
+#include "kamping/p2p/isend.hpp"
+#include "kamping/p2p/recv.hpp"
+#include "kamping/plugin/alltoall_streaming.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+using namespace ::plugin;
+using namespace ::streaming_alltoall;
+
+namespace {
+/// @brief Rank `i` sends `(i + j) % 3 * j` elements to rank `j`, i.e., some blocks are empty.
+size_t streaming_alltoall_count(size_t source, size_t dest) {
+    return (source + dest) % 3 * dest;
+}
+} // namespace
+
+TEST(StreamingAlltoallTest, matches_alltoallv) {
+    Communicator<std::vector, plugin::StreamingAlltoall> comm;
+    AlltoallvInput const                                 input(comm.rank(), comm.size(), streaming_alltoall_count);
+    auto const expected = comm.alltoallv(send_buf(input.data), send_counts(input.send_counts));
+    auto const expected_counts =
+        comm.alltoall(send_buf(input.send_counts)); // number of elements received from each rank
+
+    for (size_t window: std::vector<size_t>{1, 2, 32}) {
+        std::vector<size_t> invoked(comm.size(), 0);
+        auto                result = comm.alltoallv_streaming(
+            send_buf(input.data),
+            send_counts(input.send_counts),
+            max_outstanding(window),
+            on_block([&](size_t source, Span<int> block) {
+                ++invoked[source];
+                ASSERT_EQ(block.size(), static_cast<size_t>(expected_counts[source]));
+                for (size_t i = 0; i < block.size(); ++i) {
+                    EXPECT_EQ(block[i], AlltoallvInput::element(source, comm.rank(), i));
+                }
+            })
+        );
+        EXPECT_EQ(result, expected);
+        for (size_t source = 0; source < comm.size(); ++source) {
+            EXPECT_EQ(invoked[source], expected_counts[source] > 0 ? 1u : 0u);
+        }
+    }
+}
+
+TEST(StreamingAlltoallTest, given_displs_and_recv_counts) {
+    Communicator<std::vector, plugin::StreamingAlltoall> comm;
+    // every rank sends two elements to every rank with a gap between blocks
+    std::vector<int> data(3 * comm.size(), -1);
+    std::vector<int> displs(comm.size());
+    for (size_t dest = 0; dest < comm.size(); ++dest) {
+        displs[dest]       = static_cast<int>(3 * dest);
+        data[3 * dest]     = comm.rank_signed();
+        data[3 * dest + 1] = static_cast<int>(dest);
+    }
+    std::vector<int> counts(comm.size(), 2);
+
+    size_t     num_blocks = 0;
+    auto const result     = comm.alltoallv_streaming(
+        send_buf(data),
+        send_counts(counts),
+        send_displs(displs),
+        recv_counts(counts),
+        tag(42),
+        on_block([&](size_t source, Span<int> block) {
+            EXPECT_THAT(block, ElementsAre(static_cast<int>(source), comm.rank_signed()));
+            ++num_blocks;
+        })
+    );
+    EXPECT_EQ(num_blocks, comm.size());
+    EXPECT_EQ(result.size(), 2 * comm.size());
+}
+
+TEST(StreamingAlltoallTest, does_not_match_pending_messages_of_the_application) {
+    Communicator<std::vector, plugin::StreamingAlltoall> comm;
+    std::vector<int>                                     data(comm.size(), comm.rank_signed());
+    std::vector<int>                                     counts(comm.size(), 1);
+    // a message with the same tag which is received only after the exchange
+    int const pending = -1;
+    auto      request = comm.isend(send_buf(pending), destination(comm.rank_shifted_cyclic(1)));
+
+    auto const result = comm.alltoallv_streaming(
+        send_buf(data),
+        send_counts(counts),
+        on_block([&](size_t source, Span<int> block) { EXPECT_THAT(block, ElementsAre(static_cast<int>(source))); })
+    );
+    std::vector<int> expected(comm.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(comm.recv_single<int>(source(comm.rank_shifted_cyclic(-1))), pending);
+    request.wait();
+}
@@ -0,0 +1,197 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "../test_assertions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/barrier.hpp"
+#include "kamping/distributed_input.hpp"
+#include "kamping/plugin/buddy_replication.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+using ReplicatedCommunicator = Communicator<std::vector, plugin::BuddyReplication>;
+
+namespace {
+/// @brief Returns the elements of \p rank: rank + 1 elements with values 100 * rank + i.
+std::vector<int> elements_of(size_t rank) {
+    std::vector<int> elements(rank + 1);
+    for (size_t i = 0; i < elements.size(); ++i) {
+        elements[i] = static_cast<int>(100 * rank + i);
+    }
+    return elements;
+}
+
+/// @brief Returns the concatenation of the elements of all ranks.
+std::vector<int> all_elements(size_t size) {
+    std::vector<int> elements;
+    for (size_t rank = 0; rank < size; ++rank) {
+        auto const rank_elements = elements_of(rank);
+        elements.insert(elements.end(), rank_elements.begin(), rank_elements.end());
+    }
+    return elements;
+}
+
+/// @brief Simulates the failure of the ranks in \p failed by splitting them off \p comm.
+ReplicatedCommunicator split_off(ReplicatedCommunicator const& comm, std::vector<size_t> const& failed) {
+    bool const is_failed = std::find(failed.begin(), failed.end(), comm.rank()) != failed.end();
+    return comm.split(is_failed ? 1 : 0, comm.rank_signed());
+}
+} // namespace
+
+TEST(BuddyReplicationTest, buddy) {
+    EXPECT_EQ(ReplicatedCommunicator::buddy(0, 2), 1);
+    EXPECT_EQ(ReplicatedCommunicator::buddy(1, 2), 0);
+    EXPECT_EQ(ReplicatedCommunicator::buddy(0, 4), 1);
+    EXPECT_EQ(ReplicatedCommunicator::buddy(2, 4), 3);
+    EXPECT_EQ(ReplicatedCommunicator::buddy(3, 4), 2);
+}
+
+TEST(BuddyReplicationTest, roll_back_without_failures) {
+    ReplicatedCommunicator comm;
+    std::vector<int>       elements = elements_of(comm.rank());
+    std::vector<double>    values(3, static_cast<double>(comm.rank()));
+    comm.add_replicated(elements);
+    comm.add_replicated(values);
+    EXPECT_EQ(comm.num_replicated(), 2);
+
+    comm.replicate(1);
+    EXPECT_TRUE(comm.replication_in_progress());
+    elements.push_back(-1);
+    // starting the next replication commits the previous one
+    comm.replicate(2);
+    comm.wait_for_replication();
+    EXPECT_FALSE(comm.replication_in_progress());
+
+    elements.clear();
+    values.push_back(-1.0);
+    EXPECT_EQ(comm.recover_from_buddies(comm.split(0, comm.rank_signed())), 2);
+    std::vector<int> expected_elements = elements_of(comm.rank());
+    expected_elements.push_back(-1);
+    EXPECT_EQ(elements, expected_elements);
+    EXPECT_THAT(values, ElementsAre(comm.rank(), comm.rank(), comm.rank()));
+}
+
+TEST(BuddyReplicationTest, recover_single_failure) {
+    ReplicatedCommunicator world;
+    for (size_t failed = 0; failed < world.size() && world.size() > 1; ++failed) {
+        ReplicatedCommunicator comm;
+        std::vector<int>       elements = elements_of(comm.rank());
+        comm.add_replicated(elements);
+        comm.replicate(failed);
+        comm.wait_for_replication();
+        elements.clear();
+
+        auto survivors = split_off(comm, {failed});
+        if (comm.rank() == failed) {
+            continue;
+        }
+        size_t const old_rank = comm.rank();
+        EXPECT_EQ(comm.recover_from_buddies(std::move(survivors)), failed);
+        EXPECT_EQ(comm.size(), world.size() - 1);
+
+        // the buddy of the failed rank adopts its elements, all other ranks keep their own
+        std::vector<int> expected = elements_of(old_rank);
+        if (old_rank == ReplicatedCommunicator::buddy(failed, world.size())) {
+            auto const adopted = elements_of(failed);
+            expected.insert(failed < old_rank ? expected.begin() : expected.end(), adopted.begin(), adopted.end());
+        }
+        EXPECT_EQ(elements, expected);
+
+        std::vector<int> expected_all = all_elements(world.size());
+        EXPECT_EQ(comm.allgatherv(send_buf(elements)), expected_all);
+    }
+    world.barrier();
+}
+
+TEST(BuddyReplicationTest, recover_failure_during_replication) {
+    ReplicatedCommunicator world;
+    for (size_t failed = 0; failed < world.size() && world.size() > 1; ++failed) {
+        ReplicatedCommunicator comm;
+        std::vector<int>       elements = elements_of(comm.rank());
+        comm.add_replicated(elements);
+        comm.replicate(1);
+        comm.wait_for_replication();
+        elements.push_back(-1);
+
+        // the failed rank does not take part in the second replication, so only the ranks which do not exchange
+        // snapshots with it can commit it
+        auto survivors = split_off(comm, {failed});
+        if (comm.rank() == failed) {
+            continue;
+        }
+        comm.replicate(2);
+        bool const is_neighbor = comm.rank() + 1 == failed || comm.rank() == failed + 1;
+        if (!is_neighbor) {
+            comm.wait_for_replication();
+        }
+
+        // all survivors roll back to the first replication
+        EXPECT_EQ(comm.recover_from_buddies(std::move(survivors)), 1);
+        EXPECT_EQ(comm.allgatherv(send_buf(elements)), all_elements(world.size()));
+    }
+    world.barrier();
+}
+
+TEST(BuddyReplicationTest, recover_and_rebalance) {
+    ReplicatedCommunicator comm;
+    if (comm.size() < 2) {
+        return;
+    }
+    size_t const     old_size = comm.size();
+    size_t const     failed   = old_size / 2;
+    std::vector<int> elements = elements_of(comm.rank());
+    comm.add_replicated(elements);
+    comm.replicate();
+    comm.wait_for_replication();
+
+    auto survivors = split_off(comm, {failed});
+    if (comm.rank() == failed) {
+        return;
+    }
+    comm.recover_from_buddies(std::move(survivors), true);
+    std::vector<int> const expected_all = all_elements(old_size);
+    EXPECT_EQ(elements.size(), balanced_partition(expected_all.size(), comm.rank(), comm.size()).size());
+    EXPECT_EQ(comm.allgatherv(send_buf(elements)), expected_all);
+
+    // the recovered state is replicated again on the new communicator
+    EXPECT_FALSE(comm.replication_in_progress());
+    elements.clear();
+    comm.recover_from_buddies(comm.split(0, comm.rank_signed()));
+    EXPECT_EQ(comm.allgatherv(send_buf(elements)), expected_all);
+}
+
+TEST(BuddyReplicationTest, failure_of_rank_and_buddy_is_detected) {
+    ReplicatedCommunicator comm;
+    if (comm.size() < 3) {
+        return;
+    }
+    std::vector<int> elements = elements_of(comm.rank());
+    comm.add_replicated(elements);
+    comm.replicate();
+    comm.wait_for_replication();
+
+    auto survivors = split_off(comm, {1, 2});
+    if (comm.rank() == 1 || comm.rank() == 2) {
+        return;
+    }
+    EXPECT_THROW(comm.recover_from_buddies(std::move(survivors)), kassert::KassertException);
+}
@@ -0,0 +1,136 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "../test_assertions.hpp"
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/plugin/shared_memory.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+using namespace ::plugin;
+
+size_t num_split_type_calls = 0;
+
+int MPI_Comm_split_type(MPI_Comm comm, int split_type, int key, MPI_Info info, MPI_Comm* newcomm) {
+    ++num_split_type_calls;
+    return PMPI_Comm_split_type(comm, split_type, key, info, newcomm);
+}
+
+TEST(SharedMemoryTest, shared_array_segments) {
+    Communicator<std::vector, plugin::SharedMemory> comm;
+    auto                                            array     = comm.shared_array<int>(comm.rank() + 1);
+    auto const&                                     node_comm = array.node_communicator();
+    EXPECT_EQ(array.local().size(), comm.rank() + 1);
+    std::fill(array.local().begin(), array.local().end(), comm.rank_signed());
+    array.sync();
+
+    // all segments are visible to all ranks of the node
+    std::vector<int> const global_ranks = node_comm.allgather(send_buf(comm.rank_signed()));
+    size_t                 total_size   = 0;
+    for (size_t node_rank = 0; node_rank < node_comm.size(); ++node_rank) {
+        auto const segment = array.segment(node_rank);
+        EXPECT_EQ(segment.size(), static_cast<size_t>(global_ranks[node_rank]) + 1);
+        EXPECT_THAT(segment, Each(global_ranks[node_rank]));
+        total_size += segment.size();
+    }
+    // the segments are contiguous
+    EXPECT_EQ(array.all().size(), total_size);
+    EXPECT_EQ(array.all().data(), array.segment(0).data());
+    EXPECT_EQ(array.local().data(), array.all().data() + (array.local().data() - array.segment(0).data()));
+    array.sync();
+}
+
+TEST(SharedMemoryTest, shared_array_from_plain_communicator) {
+    // a plain communicator may span multiple nodes, so it has to be split like any other communicator
+    Communicator<> comm;
+    num_split_type_calls = 0;
+    SharedMemoryArray<int> array(comm, 1);
+    EXPECT_EQ(num_split_type_calls, 1);
+    EXPECT_EQ(array.node_communicator().size(), comm.split_to_shared_memory().size());
+    array.local()[0] = comm.rank_signed();
+    array.sync();
+    std::vector<int> const global_ranks = array.node_communicator().allgather(send_buf(comm.rank_signed()));
+    EXPECT_THAT(array.all(), ElementsAreArray(global_ranks));
+    array.sync();
+}
+
+TEST(SharedMemoryTest, shared_array_from_node_communicator) {
+    Communicator<> comm;
+    Communicator<> node_comm = comm.split_to_shared_memory();
+    num_split_type_calls     = 0;
+    auto array               = SharedMemoryArray<int>::from_node_communicator(std::move(node_comm), 2);
+    EXPECT_EQ(num_split_type_calls, 0);
+    EXPECT_EQ(array.local().size(), 2);
+    EXPECT_EQ(array.all().size(), 2 * array.node_communicator().size());
+    array.sync();
+}
+
+TEST(SharedMemoryTest, bcast_shared) {
+    Communicator<std::vector, plugin::SharedMemory> comm;
+    for (int root_rank = 0; root_rank < comm.size_signed(); ++root_rank) {
+        std::vector<double> data;
+        if (comm.rank_signed() == root_rank) {
+            data.resize(1000);
+            std::iota(data.begin(), data.end(), static_cast<double>(root_rank));
+        }
+        auto const result = comm.bcast_shared(send_buf(data), root(root_rank));
+        ASSERT_EQ(result.all().size(), 1000);
+        for (size_t i = 0; i < 1000; ++i) {
+            EXPECT_EQ(result.all()[i], static_cast<double>(root_rank) + static_cast<double>(i));
+        }
+        // only the node leader owns memory
+        EXPECT_EQ(result.local().size(), result.node_communicator().rank() == 0 ? 1000 : 0);
+    }
+}
+
+TEST(SharedMemoryTest, bcast_shared_with_value_type_on_non_root) {
+    Communicator<std::vector, plugin::SharedMemory> comm;
+    std::vector<int> const                          data{1, 2, 3};
+    auto const result = comm.is_root() ? comm.bcast_shared(send_buf(data)) : comm.bcast_shared<int>();
+    EXPECT_THAT(result.all(), ElementsAre(1, 2, 3));
+}
+
+TEST(SharedMemoryTest, allgatherv_shared) {
+    Communicator<std::vector, plugin::SharedMemory> comm;
+    // rank i contributes i elements with value i
+    std::vector<int> const data(comm.rank(), comm.rank_signed());
+    auto const             result = comm.allgatherv_shared(send_buf(data));
+
+    std::vector<int> expected;
+    for (int rank = 0; rank < comm.size_signed(); ++rank) {
+        expected.insert(expected.end(), static_cast<size_t>(rank), rank);
+    }
+    EXPECT_THAT(result.all(), ElementsAreArray(expected));
+}
+
+TEST(SharedMemoryTest, allgatherv_shared_non_consecutive_nodes) {
+    // reverse the order of the ranks such that the ranks of each node are not consecutive if there are multiple nodes
+    Communicator<std::vector, plugin::SharedMemory> world;
+    Communicator<std::vector, plugin::SharedMemory> comm = world.split(0, world.size_signed() - world.rank_signed());
+    std::vector<int> const                          data(2, comm.rank_signed());
+    auto const                                      result = comm.allgatherv_shared(send_buf(data));
+
+    std::vector<int> expected;
+    for (int rank = 0; rank < comm.size_signed(); ++rank) {
+        expected.insert(expected.end(), 2, rank);
+    }
+    EXPECT_THAT(result.all(), ElementsAreArray(expected));
+}
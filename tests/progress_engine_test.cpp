@@ -0,0 +1,102 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "test_assertions.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/collectives/iallreduce.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/environment.hpp"
+#include "kamping/p2p/irecv.hpp"
+#include "kamping/p2p/isend.hpp"
+#include "kamping/progress_engine.hpp"
+#include "kamping/request_pool.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+TEST(ProgressEngineTest, cooperative_progress_of_result) {
+    Communicator     comm;
+    ProgressEngine   engine;
+    std::vector<int> input{comm.rank_signed(), 1};
+    auto             result = comm.iallreduce(send_buf(input), op(ops::plus<>{}));
+    engine.add(result);
+    EXPECT_EQ(engine.num_registered(), 1);
+    // completed operations are dropped by the engine
+    while (engine.progress() > 0) {
+    }
+    EXPECT_EQ(engine.num_registered(), 0);
+    // the request is not freed by the engine
+    EXPECT_NE(*result.get_request_ptr(), MPI_REQUEST_NULL);
+    std::vector<int> const sum = result.wait();
+    EXPECT_THAT(sum, ElementsAre(comm.size_signed() * (comm.size_signed() - 1) / 2, comm.size_signed()));
+}
+
+TEST(ProgressEngineTest, request_pool_stays_registered) {
+    Communicator   comm;
+    ProgressEngine engine;
+    RequestPool<>  pool;
+    int            received = -1;
+    int const      value    = comm.rank_signed();
+    comm.irecv(recv_buf(received), recv_count(1), source(comm.rank_shifted_cyclic(-1)), request(pool.get_request()));
+    comm.isend(send_buf(value), destination(comm.rank_shifted_cyclic(1)), request(pool.get_request()));
+    engine.add(pool);
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(engine.progress(), 1);
+    }
+    engine.remove(pool);
+    EXPECT_EQ(engine.num_registered(), 0);
+    pool.wait_all();
+    EXPECT_EQ(received, comm.rank_shifted_cyclic(-1));
+}
+
+TEST(ProgressEngineTest, remove_unregistered) {
+    Communicator   comm;
+    ProgressEngine engine;
+    RequestPool<>  pool;
+    engine.remove(pool);
+    engine.add(pool);
+    engine.add(pool);
+    engine.remove(pool);
+    EXPECT_EQ(engine.num_registered(), 0);
+    EXPECT_FALSE(engine.running());
+}
+
+TEST(ProgressEngineTest, background_thread) {
+    ProgressEngine engine;
+    if (mpi_env.thread_level() < ThreadLevel::multiple) {
+        EXPECT_THROW(engine.start(), kassert::KassertException);
+        return;
+    }
+    Communicator     comm;
+    std::vector<int> input{comm.rank_signed()};
+    auto             result = comm.iallreduce(send_buf(input), op(ops::plus<>{}));
+    engine.add(result);
+    engine.start(std::chrono::microseconds(10));
+    EXPECT_TRUE(engine.running());
+    EXPECT_THROW(engine.start(), kassert::KassertException);
+    // the background thread completes the operation while this thread is busy
+    while (engine.num_registered() > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+    engine.stop();
+    EXPECT_FALSE(engine.running());
+    EXPECT_THAT(result.wait(), ElementsAre(comm.size_signed() * (comm.size_signed() - 1) / 2));
+}
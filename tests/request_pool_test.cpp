@@ -11,6 +11,9 @@
 // You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
 // <https://www.gnu.org/licenses/>.
 
+#include <algorithm>
+#include <functional>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <mpi.h>
@@ -402,3 +405,166 @@ TEST(RequestPoolTest, test_any_status_out_reference) {
     index = pool.test_any(status_out(status));
     EXPECT_THAT(index, Optional(Eq(pool.index_end()))); // nothing to wait for
 }
+
+TEST(RequestPoolTest, slots_are_reused) {
+    using namespace ::testing;
+    kamping::RequestPool      pool;
+    DummyNonBlockingOperation op1;
+    DummyNonBlockingOperation op2;
+    int                       val1 = -1;
+    int                       val2 = -1;
+    op1.start_op(kamping::request(pool.get_request()), kamping::tag(42), recv_buf(val1));
+    op2.start_op(kamping::request(pool.get_request()), kamping::tag(43), recv_buf(val2));
+    EXPECT_EQ(pool.num_pending_requests(), 2);
+    op1.finish_op();
+    EXPECT_EQ(pool.wait_any(), 0);
+    EXPECT_EQ(pool.num_pending_requests(), 1);
+
+    // the released slot is handed out again
+    auto request = pool.get_request();
+    EXPECT_EQ(request.index(), 0);
+    EXPECT_EQ(pool.num_requests(), 2);
+    EXPECT_EQ(pool.num_pending_requests(), 2);
+    op1.start_op(kamping::request(std::move(request)), kamping::tag(44), recv_buf(val1));
+    op1.finish_op();
+    op2.finish_op();
+    pool.wait_all();
+    EXPECT_EQ(val1, 44);
+    EXPECT_EQ(val2, 43);
+    EXPECT_EQ(pool.num_pending_requests(), 0);
+
+    // a long-running loop does not grow the pool
+    for (int i = 0; i < 10; ++i) {
+        op1.start_op(kamping::request(pool.get_request()), kamping::tag(i), recv_buf(val1));
+        op1.finish_op();
+        pool.wait_any();
+    }
+    EXPECT_EQ(val1, 9);
+    EXPECT_EQ(pool.num_requests(), 2);
+    EXPECT_EQ(pool.num_pending_requests(), 0);
+}
+
+TEST(RequestPoolTest, wait_some) {
+    using namespace ::testing;
+    kamping::RequestPool                   pool;
+    std::vector<DummyNonBlockingOperation> ops(4);
+    std::vector<int>                       values(4, -1);
+    EXPECT_TRUE(pool.wait_some().empty()); // nothing to wait for
+    for (size_t i = 0; i < ops.size(); ++i) {
+        int const op_tag = 42 + static_cast<int>(i);
+        ops[i].start_op(kamping::request(pool.get_request()), kamping::tag(op_tag), recv_buf(values[i]));
+    }
+    ops[1].finish_op();
+    ops[3].finish_op();
+    std::vector<size_t> indices = pool.wait_some();
+    std::sort(indices.begin(), indices.end());
+    EXPECT_THAT(indices, ElementsAre(1, 3));
+    EXPECT_THAT(values, ElementsAre(-1, 43, -1, 45));
+    EXPECT_EQ(pool.num_pending_requests(), 2);
+
+    ops[0].finish_op();
+    ops[2].finish_op();
+    indices = pool.wait_some();
+    std::sort(indices.begin(), indices.end());
+    EXPECT_THAT(indices, ElementsAre(0, 2));
+    EXPECT_THAT(values, ElementsAre(42, 43, 44, 45));
+    EXPECT_TRUE(pool.wait_some().empty());
+}
+
+TEST(RequestPoolTest, wait_some_statuses_out) {
+    using namespace ::testing;
+    kamping::RequestPool                   pool;
+    std::vector<DummyNonBlockingOperation> ops(3);
+    std::vector<int>                       values(3, -1);
+    for (size_t i = 0; i < ops.size(); ++i) {
+        int const op_tag = 42 + static_cast<int>(i);
+        ops[i].start_op(kamping::request(pool.get_request()), kamping::tag(op_tag), recv_buf(values[i]));
+    }
+    ops[2].finish_op();
+    auto [indices, statuses] = pool.wait_some(statuses_out());
+    EXPECT_THAT(indices, ElementsAre(2));
+    EXPECT_THAT(statuses, ElementsAre(Field(&MPI_Status::MPI_TAG, 44)));
+
+    ops[0].finish_op();
+    ops[1].finish_op();
+    std::vector<MPI_Status> statuses_ref;
+    indices = pool.wait_some(statuses_out<resize_to_fit>(statuses_ref));
+    ASSERT_EQ(indices.size(), 2);
+    ASSERT_EQ(statuses_ref.size(), 2);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        EXPECT_EQ(statuses_ref[i].MPI_TAG, 42 + static_cast<int>(indices[i]));
+    }
+}
+
+TEST(RequestPoolTest, test_some) {
+    using namespace ::testing;
+    kamping::RequestPool                   pool;
+    std::vector<DummyNonBlockingOperation> ops(3);
+    std::vector<int>                       values(3, -1);
+    EXPECT_TRUE(pool.test_some().empty()); // nothing to test
+    for (size_t i = 0; i < ops.size(); ++i) {
+        int const op_tag = 42 + static_cast<int>(i);
+        ops[i].start_op(kamping::request(pool.get_request()), kamping::tag(op_tag), recv_buf(values[i]));
+    }
+    EXPECT_TRUE(pool.test_some().empty());
+
+    ops[1].finish_op();
+    auto [indices, statuses] = pool.test_some(statuses_out());
+    EXPECT_THAT(indices, ElementsAre(1));
+    EXPECT_THAT(statuses, ElementsAre(Field(&MPI_Status::MPI_TAG, 43)));
+    EXPECT_THAT(values, ElementsAre(-1, 43, -1));
+    EXPECT_TRUE(pool.test_some().empty());
+
+    ops[0].finish_op();
+    ops[2].finish_op();
+    indices = pool.test_some();
+    std::sort(indices.begin(), indices.end());
+    EXPECT_THAT(indices, ElementsAre(0, 2));
+    EXPECT_THAT(values, ElementsAre(42, 43, 44));
+}
+
+TEST(RequestPoolTest, completion_callbacks) {
+    using namespace ::testing;
+    kamping::RequestPool                   pool;
+    std::vector<DummyNonBlockingOperation> ops(3);
+    std::vector<int>                       values(3, -1);
+    std::vector<size_t>                    completed;
+    for (size_t i = 0; i < ops.size(); ++i) {
+        ops[i].start_op(
+            kamping::request(pool.get_request([&completed, i] { completed.push_back(i); })),
+            kamping::tag(42 + static_cast<int>(i)),
+            recv_buf(values[i])
+        );
+    }
+    ops[1].finish_op();
+    pool.wait_any();
+    EXPECT_THAT(completed, ElementsAre(1));
+    ops[0].finish_op();
+    ops[2].finish_op();
+    pool.wait_all();
+    // the callback of the request released before is not invoked again
+    EXPECT_THAT(completed, ElementsAre(1, 0, 2));
+}
+
+TEST(RequestPoolTest, callbacks_can_start_new_requests) {
+    using namespace ::testing;
+    kamping::RequestPool      pool;
+    DummyNonBlockingOperation op;
+    int                       value          = -1;
+    int                       num_iterations = 0;
+    std::function<void()>     post_next      = [&] {
+        ++num_iterations;
+        if (num_iterations < 5) {
+            op.start_op(kamping::request(pool.get_request(post_next)), kamping::tag(num_iterations), recv_buf(value));
+            op.finish_op();
+        }
+    };
+    op.start_op(kamping::request(pool.get_request(post_next)), kamping::tag(0), recv_buf(value));
+    op.finish_op();
+    while (pool.num_pending_requests() > 0) {
+        pool.test_some();
+    }
+    EXPECT_EQ(num_iterations, 5);
+    EXPECT_EQ(value, 4);
+    EXPECT_EQ(pool.num_requests(), 1);
+}
@@ -11,6 +11,9 @@
 // You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
 // <https://www.gnu.org/licenses/>.
 
+#include <sstream>
+
+#include <cereal/archives/binary.hpp>
 #include <cereal/archives/json.hpp>
 #include <cereal/types/string.hpp>
 #include <cereal/types/unordered_map.hpp>
@@ -19,7 +22,11 @@
 #include <gtest/gtest.h>
 #include <mpi.h>
 
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/alltoall.hpp"
 #include "kamping/collectives/bcast.hpp"
+#include "kamping/collectives/gather.hpp"
+#include "kamping/collectives/scatter.hpp"
 #include "kamping/communicator.hpp"
 #include "kamping/p2p/recv.hpp"
 #include "kamping/p2p/send.hpp"
@@ -150,3 +157,175 @@ TEST(SerializationTest, custom_serialization_functions) {
         EXPECT_EQ(recv_data, data);
     }
 }
+
+TEST(SerializationTest, serialized_size) {
+    dict_type         data{{"key1", "value1"}, {"key2", "value2"}};
+    std::stringstream stream;
+    {
+        cereal::BinaryOutputArchive archive(stream);
+        archive(data);
+    }
+    EXPECT_EQ(serialized_size(data), stream.str().size());
+    EXPECT_EQ(serialized_size(dict_type{}), serialized_size(std::unordered_map<int, int>{}));
+}
+
+TEST(SerializationTest, basic_with_reserved_serialized_size) {
+    kamping::Communicator comm;
+    dict_type             data{{"key1", "value1"}, {"key2", "value2"}};
+    if (comm.is_root()) {
+        for (size_t dst = 0; dst < comm.size(); dst++) {
+            if (comm.is_root(dst)) {
+                continue;
+            }
+            comm.send(kamping::send_buf(as_serialized(data, reserve_serialized_size)), destination(dst));
+        }
+    } else {
+        auto recv_data = comm.recv(recv_buf(as_deserializable<dict_type>()));
+        EXPECT_EQ(recv_data, data);
+    }
+}
+
+TEST(SerializationTest, bcast_with_reserved_serialized_size) {
+    kamping::Communicator    comm;
+    std::vector<std::string> data;
+    if (comm.is_root()) {
+        data = {"a", "bb", std::string(1000, 'c')};
+    }
+    comm.bcast(send_recv_buf(as_serialized(data, reserve_serialized_size)));
+    EXPECT_THAT(data, ::testing::ElementsAre("a", "bb", std::string(1000, 'c')));
+}
+
+TEST(SerializationTest, serialization_buffer_writes_serialized_data_directly) {
+    Foo  data   = {3.14, {1, 2, 3}};
+    auto buffer = as_serialized(data, reserve_serialized_size);
+    buffer.serialize();
+    EXPECT_EQ(buffer.size(), serialized_size(data));
+
+    // serializing twice must not append to the previously serialized data
+    buffer.serialize();
+    EXPECT_EQ(buffer.size(), serialized_size(data));
+
+    auto recv_buffer = as_deserializable<Foo>();
+    recv_buffer.resize(buffer.size());
+    std::copy_n(buffer.data(), buffer.size(), recv_buffer.data());
+    recv_buffer.deserialize();
+    EXPECT_EQ(std::move(recv_buffer).extract().underlying(), data);
+}
+
+namespace {
+dict_type make_dict(size_t from, size_t to) {
+    return {{"from", std::to_string(from)}, {"to", std::string(to + 1, 'x')}};
+}
+} // namespace
+
+TEST(SerializationTest, serialize_each) {
+    std::vector<std::string> data = {"a", "bb", "", std::string(100, 'c')};
+    auto                     buffer = as_serialized(data);
+    std::vector<int>         counts;
+    buffer.serialize_each(counts);
+    ASSERT_EQ(counts.size(), data.size());
+    size_t expected_size = 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(static_cast<size_t>(counts[i]), serialized_size(data[i]));
+        expected_size += serialized_size(data[i]);
+    }
+    EXPECT_EQ(buffer.size(), expected_size);
+}
+
+TEST(SerializationTest, alltoallv) {
+    kamping::Communicator  comm;
+    std::vector<dict_type> data;
+    for (size_t dst = 0; dst < comm.size(); ++dst) {
+        data.push_back(make_dict(comm.rank(), dst));
+    }
+    auto received = comm.alltoallv(send_buf(as_serialized(data)));
+    ASSERT_EQ(received.size(), comm.size());
+    for (size_t source = 0; source < comm.size(); ++source) {
+        EXPECT_EQ(received.deserialize(source), make_dict(source, comm.rank()));
+        EXPECT_EQ(received.serialized()[source].size(), serialized_size(make_dict(source, comm.rank())));
+    }
+}
+
+TEST(SerializationTest, alltoallv_with_explicit_recv_buf_and_reserved_size) {
+    kamping::Communicator    comm;
+    std::vector<std::string> data;
+    for (size_t dst = 0; dst < comm.size(); ++dst) {
+        data.push_back(std::string(comm.rank() + dst, 'a'));
+    }
+    auto received = comm.alltoallv(
+        send_buf(as_serialized(data, reserve_serialized_size)),
+        recv_buf(as_deserializable<std::string>())
+    );
+    std::vector<std::string> expected;
+    for (size_t source = 0; source < comm.size(); ++source) {
+        expected.push_back(std::string(source + comm.rank(), 'a'));
+    }
+    EXPECT_EQ(received.deserialize_all(), expected);
+}
+
+TEST(SerializationTest, gatherv) {
+    kamping::Communicator    comm;
+    std::vector<std::string> data(comm.rank() + 1, std::to_string(comm.rank()));
+    auto                     received = comm.gatherv(send_buf(as_serialized(data)));
+    if (comm.is_root()) {
+        ASSERT_EQ(received.size(), comm.size());
+        for (size_t source = 0; source < comm.size(); ++source) {
+            EXPECT_EQ(received.deserialize(source), std::vector<std::string>(source + 1, std::to_string(source)));
+        }
+    } else {
+        EXPECT_TRUE(received.empty());
+    }
+}
+
+TEST(SerializationTest, gatherv_with_root) {
+    kamping::Communicator comm;
+    size_t const          root     = comm.size() - 1;
+    dict_type const       data     = make_dict(comm.rank(), root);
+    auto                  received = comm.gatherv(send_buf(as_serialized(data)), kamping::root(root));
+    if (comm.is_root(root)) {
+        std::vector<dict_type> expected;
+        for (size_t source = 0; source < comm.size(); ++source) {
+            expected.push_back(make_dict(source, root));
+        }
+        EXPECT_EQ(received.deserialize_all(), expected);
+    } else {
+        EXPECT_TRUE(received.empty());
+    }
+}
+
+TEST(SerializationTest, allgatherv) {
+    kamping::Communicator comm;
+    dict_type const       data = make_dict(comm.rank(), comm.rank());
+    auto received = comm.allgatherv(send_buf(as_serialized(data)), recv_buf(as_deserializable<dict_type>()));
+    ASSERT_EQ(received.size(), comm.size());
+    for (size_t source = 0; source < comm.size(); ++source) {
+        EXPECT_EQ(received.deserialize(source), make_dict(source, source));
+    }
+}
+
+TEST(SerializationTest, scatterv) {
+    kamping::Communicator  comm;
+    std::vector<dict_type> data;
+    if (comm.is_root()) {
+        for (size_t dst = 0; dst < comm.size(); ++dst) {
+            data.push_back(make_dict(comm.root(), dst));
+        }
+    }
+    auto received = comm.scatterv(send_buf(as_serialized(data)), recv_buf(as_deserializable<dict_type>()));
+    EXPECT_EQ(received, make_dict(comm.root(), comm.rank()));
+}
+
+TEST(SerializationTest, scatterv_into_ref_without_send_buf_on_non_root) {
+    kamping::Communicator    comm;
+    std::vector<std::string> received;
+    if (comm.is_root()) {
+        std::vector<std::vector<std::string>> data;
+        for (size_t dst = 0; dst < comm.size(); ++dst) {
+            data.emplace_back(dst, "foo");
+        }
+        comm.scatterv(send_buf(as_serialized(data)), recv_buf(as_deserializable(received)));
+    } else {
+        comm.scatterv(recv_buf(as_deserializable(received)));
+    }
+    EXPECT_EQ(received, std::vector<std::string>(comm.rank(), "foo"));
+}
@@ -0,0 +1,119 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "test_assertions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "kamping/communicator.hpp"
+#include "kamping/environment.hpp"
+#include "kamping/p2p/irecv.hpp"
+#include "kamping/p2p/isend.hpp"
+#include "kamping/thread_communicators.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+TEST(ThreadCommunicatorsTest, duplicates) {
+    Communicator comm;
+    comm.root(comm.size() - 1);
+    ThreadCommunicators thread_comms(comm, 3);
+    EXPECT_EQ(thread_comms.num_threads(), 3);
+    for (size_t thread_id = 0; thread_id < thread_comms.num_threads(); ++thread_id) {
+        auto const& thread_comm = thread_comms.communicator(thread_id);
+        EXPECT_EQ(thread_comm.rank(), comm.rank());
+        EXPECT_EQ(thread_comm.size(), comm.size());
+        EXPECT_EQ(thread_comm.root(), comm.root());
+        int result;
+        MPI_Comm_compare(thread_comm.mpi_communicator(), comm.mpi_communicator(), &result);
+        EXPECT_EQ(result, MPI_CONGRUENT);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&thread_comm) % kamping::internal::cache_line_size, 0);
+        for (size_t other = 0; other < thread_id; ++other) {
+            EXPECT_NE(thread_comm.mpi_communicator(), thread_comms.communicator(other).mpi_communicator());
+        }
+    }
+}
+
+TEST(ThreadCommunicatorsTest, messages_of_different_threads_do_not_match) {
+    Communicator        comm;
+    size_t const        num_threads = 4;
+    ThreadCommunicators thread_comms(comm, num_threads);
+    size_t const        right = comm.rank_shifted_cyclic(1);
+    size_t const        left  = comm.rank_shifted_cyclic(-1);
+
+    // all threads use the same tag and post their receives in reverse order
+    std::vector<size_t> received(num_threads, num_threads);
+    for (size_t thread_id = num_threads; thread_id-- > 0;) {
+        auto& requests = thread_comms.request_pool(thread_id);
+        thread_comms.communicator(thread_id)
+            .irecv(recv_buf(received[thread_id]), recv_count(1), source(left), tag(0), request(requests.get_request()));
+    }
+    std::vector<size_t> sent(num_threads);
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+        auto& requests  = thread_comms.request_pool(thread_id);
+        sent[thread_id] = thread_id;
+        thread_comms.communicator(thread_id)
+            .isend(send_buf(sent[thread_id]), destination(right), tag(0), request(requests.get_request()));
+    }
+    EXPECT_EQ(thread_comms.request_pools().num_requests(), 2 * num_threads);
+    thread_comms.request_pools().wait_all();
+    EXPECT_THAT(received, ElementsAre(0, 1, 2, 3));
+}
+
+TEST(ThreadCommunicatorsTest, concurrent_threads) {
+    if (mpi_env.thread_level() < ThreadLevel::multiple) {
+        // Concurrent MPI calls are not allowed.
+        return;
+    }
+    Communicator                     comm;
+    size_t const                     num_threads = 4;
+    ThreadCommunicators              thread_comms(comm, num_threads);
+    std::vector<std::vector<size_t>> received(num_threads);
+
+    std::vector<std::thread> threads;
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+        threads.emplace_back([&, thread_id]() {
+            auto&               thread_comm = thread_comms.communicator(thread_id);
+            auto&               requests    = thread_comms.request_pool(thread_id);
+            std::vector<size_t> sent(10, thread_id);
+            received[thread_id].resize(sent.size());
+            for (size_t i = 0; i < sent.size(); ++i) {
+                thread_comm.irecv(
+                    recv_buf(received[thread_id][i]),
+                    recv_count(1),
+                    source(thread_comm.rank_shifted_cyclic(-1)),
+                    request(requests.get_request())
+                );
+                thread_comm.isend(
+                    send_buf(sent[i]),
+                    destination(thread_comm.rank_shifted_cyclic(1)),
+                    request(requests.get_request())
+                );
+            }
+            requests.wait_all();
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+        EXPECT_THAT(received[thread_id], Each(thread_id));
+    }
+}
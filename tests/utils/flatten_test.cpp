@@ -11,6 +11,7 @@
 // You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
 // <https://www.gnu.org/licenses/>.
 //
+#include <string>
 #include <unordered_map>
 
 #include <gmock/gmock.h>
@@ -88,3 +89,47 @@ TEST(FlattenTest, basic_vector_of_vectors) {
     EXPECT_THAT(send_counts, ::testing::Each(1));
     EXPECT_EQ(send_displs, testing::iota_container_n(comm.size(), 0));
 }
+
+TEST(UnflattenTest, copy_from_lvalue) {
+    std::vector<int> flat   = {0, 1, 2, 3, 4, 5};
+    std::vector<int> counts = {2, 0, 3, 1};
+    std::vector<int> displs = {0, 2, 2, 5};
+
+    auto nested = unflatten(flat, counts, displs);
+    static_assert(std::is_same_v<decltype(nested), std::vector<std::vector<int>>>);
+    ASSERT_EQ(nested.size(), 4);
+    EXPECT_THAT(nested[0], ::testing::ElementsAre(0, 1));
+    EXPECT_TRUE(nested[1].empty());
+    EXPECT_THAT(nested[2], ::testing::ElementsAre(2, 3, 4));
+    EXPECT_THAT(nested[3], ::testing::ElementsAre(5));
+    EXPECT_EQ(flat.size(), 6);
+}
+
+TEST(UnflattenTest, move_from_rvalue) {
+    std::vector<std::string> flat   = {"a", "bb", "ccc"};
+    std::vector<int>         counts = {1, 2};
+    std::vector<int>         displs = {2, 0};
+
+    auto nested = unflatten(std::move(flat), counts, displs);
+    ASSERT_EQ(nested.size(), 2);
+    EXPECT_THAT(nested[0], ::testing::ElementsAre("ccc"));
+    EXPECT_THAT(nested[1], ::testing::ElementsAre("a", "bb"));
+}
+
+TEST(UnflattenTest, roundtrip_with_alltoallv_result) {
+    Communicator                  comm;
+    std::vector<std::vector<int>> nested_send_buf(comm.size());
+    for (size_t i = 0; i < comm.size(); i++) {
+        nested_send_buf[i] = std::vector<int>(i + 1, comm.rank_signed());
+    }
+
+    auto nested_recv_buf = unflatten(with_flattened(nested_send_buf).call([&](auto... flattened) {
+        return comm.alltoallv(std::move(flattened)..., recv_counts_out(), recv_displs_out());
+    }));
+
+    ASSERT_EQ(nested_recv_buf.size(), comm.size());
+    for (size_t source = 0; source < comm.size(); source++) {
+        EXPECT_EQ(nested_recv_buf[source].size(), comm.rank() + 1);
+        EXPECT_THAT(nested_recv_buf[source], ::testing::Each(static_cast<int>(source)));
+    }
+}
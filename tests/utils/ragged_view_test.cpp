@@ -0,0 +1,112 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include <iterator>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/alltoall.hpp"
+#include "kamping/collectives/gather.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/utils/ragged_view.hpp"
+
+using namespace kamping;
+
+TEST(RaggedViewTest, basics) {
+    std::vector<int> data   = {0, 1, 2, 3, 4, 5};
+    std::vector<int> counts = {1, 0, 3, 2};
+    std::vector<int> displs = {0, 1, 1, 4};
+
+    auto view = make_ragged_view(data, counts, displs);
+    static_assert(std::is_same_v<decltype(view), RaggedView<int, int>>);
+    EXPECT_EQ(view.size(), 4);
+    EXPECT_FALSE(view.empty());
+    EXPECT_THAT(view[0], ::testing::ElementsAre(0));
+    EXPECT_TRUE(view[1].empty());
+    EXPECT_THAT(view.per_source(2), ::testing::ElementsAre(1, 2, 3));
+    EXPECT_THAT(view[3], ::testing::ElementsAre(4, 5));
+    EXPECT_EQ(view.block_size(2), 3);
+    EXPECT_EQ(view.flat().data(), data.data());
+
+    // the view shares the underlying storage
+    view[3][0] = 42;
+    EXPECT_EQ(data[4], 42);
+
+    EXPECT_EQ(std::distance(view.begin(), view.end()), 4);
+    std::vector<size_t> sizes;
+    for (auto block: view) {
+        sizes.push_back(block.size());
+    }
+    EXPECT_THAT(sizes, ::testing::ElementsAre(1, 0, 3, 2));
+    EXPECT_EQ((*(view.begin() + 2)).size(), 3);
+}
+
+TEST(RaggedViewTest, const_data) {
+    std::vector<int> const data   = {0, 1, 2};
+    std::vector<int> const counts = {2, 1};
+    std::vector<int> const displs = {1, 0};
+
+    auto view = make_ragged_view(data, counts, displs);
+    static_assert(std::is_same_v<decltype(view), RaggedView<int const, int>>);
+    EXPECT_THAT(view[0], ::testing::ElementsAre(1, 2));
+    EXPECT_THAT(view[1], ::testing::ElementsAre(0));
+}
+
+TEST(RaggedViewTest, alltoallv_per_source) {
+    Communicator     comm;
+    // rank i sends i+1 copies of its rank to every other rank
+    std::vector<int> input(comm.size() * (comm.rank() + 1), comm.rank_signed());
+    std::vector<int> counts(comm.size(), comm.rank_signed() + 1);
+
+    auto result = comm.alltoallv(send_buf(input), send_counts(counts), recv_counts_out(), recv_displs_out());
+    auto view   = result.recv_buf_per_source();
+    ASSERT_EQ(view.size(), comm.size());
+    for (size_t source = 0; source < comm.size(); ++source) {
+        EXPECT_EQ(view[source].size(), source + 1);
+        EXPECT_THAT(view[source], ::testing::Each(static_cast<int>(source)));
+        EXPECT_EQ(result.per_source(source).data(), view[source].data());
+    }
+    // the view refers to the storage owned by the result object
+    EXPECT_EQ(view.flat().data(), result.get_recv_buf().data());
+}
+
+TEST(RaggedViewTest, allgatherv_per_source) {
+    Communicator     comm;
+    std::vector<int> input(comm.rank(), comm.rank_signed());
+
+    auto const result = comm.allgatherv(send_buf(input), recv_counts_out(), recv_displs_out());
+    size_t     source = 0;
+    for (auto block: result.recv_buf_per_source()) {
+        EXPECT_EQ(block.size(), source);
+        EXPECT_THAT(block, ::testing::Each(static_cast<int>(source)));
+        ++source;
+    }
+    EXPECT_EQ(source, comm.size());
+}
+
+TEST(RaggedViewTest, gatherv_per_source) {
+    Communicator     comm;
+    std::vector<int> input(comm.rank() + 1, comm.rank_signed());
+
+    auto result = comm.gatherv(send_buf(input), recv_counts_out(), recv_displs_out());
+    if (comm.is_root()) {
+        ASSERT_EQ(result.recv_buf_per_source().size(), comm.size());
+        for (size_t source = 0; source < comm.size(); ++source) {
+            EXPECT_EQ(result.per_source(source).size(), source + 1);
+            EXPECT_THAT(result.per_source(source), ::testing::Each(static_cast<int>(source)));
+        }
+    }
+}
@@ -0,0 +1,249 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "test_assertions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/collectives/allreduce.hpp"
+#include "kamping/collectives/barrier.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/window.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+TEST(WindowTest, put_and_get_with_fence) {
+    Communicator comm;
+    auto         window = Window<int>::allocate(comm, comm.size());
+    EXPECT_EQ(window.local().size(), comm.size());
+    std::fill(window.local().begin(), window.local().end(), -1);
+
+    // every rank writes its rank to position rank on its right neighbor
+    size_t const right = (comm.rank() + 1) % comm.size();
+    size_t const left  = (comm.rank() + comm.size() - 1) % comm.size();
+    {
+        // the send buffer has to outlive the epoch
+        int const value = comm.rank_signed();
+        auto      epoch = window.fence_epoch(MPI_MODE_NOPRECEDE);
+        window.put(send_buf(value), target(right), target_disp(comm.rank_signed()));
+    }
+    std::vector<int> expected(comm.size(), -1);
+    expected[left] = comm.rank_signed() == 0 ? comm.size_signed() - 1 : comm.rank_signed() - 1;
+    EXPECT_THAT(std::vector<int>(window.local().begin(), window.local().end()), ElementsAreArray(expected));
+
+    // every rank reads the window of its right neighbor
+    std::vector<int> result;
+    {
+        auto epoch = window.fence_epoch();
+        result     = window.get(recv_count(comm.size_signed()), target(right));
+        epoch.close();
+    }
+    std::vector<int> expected_right(comm.size(), -1);
+    expected_right[comm.rank()] = comm.rank_signed();
+    EXPECT_THAT(result, ElementsAreArray(expected_right));
+}
+
+TEST(WindowTest, get_into_given_buffer) {
+    Communicator comm;
+    auto         window = Window<int>::allocate(comm, 4);
+    std::iota(window.local().begin(), window.local().end(), comm.rank_signed() * 4);
+
+    size_t const     right = (comm.rank() + 1) % comm.size();
+    std::vector<int> result(2);
+    window.fence();
+    window.get(recv_buf(result), target(right), target_disp(1));
+    window.fence();
+    EXPECT_THAT(result, ElementsAre(right * 4 + 1, right * 4 + 2));
+
+    std::vector<int> resized;
+    window.get(recv_buf<resize_to_fit>(resized), recv_count(3), target(right));
+    window.fence();
+    EXPECT_THAT(resized, ElementsAre(right * 4, right * 4 + 1, right * 4 + 2));
+}
+
+TEST(WindowTest, create_with_user_memory) {
+    Communicator     comm;
+    std::vector<int> memory(comm.size(), -1);
+    auto             window = Window<int>::create(comm, Span<int>(memory.data(), memory.size()));
+    EXPECT_EQ(window.local().data(), memory.data());
+    {
+        int const value = comm.rank_signed();
+        auto      epoch = window.fence_epoch();
+        // each rank writes to its own element, as conflicting puts in the same epoch are erroneous
+        window.put(send_buf(value), target(0), target_disp(comm.rank_signed()));
+    }
+    if (comm.rank() == 0) {
+        std::vector<int> expected(comm.size());
+        std::iota(expected.begin(), expected.end(), 0);
+        EXPECT_EQ(memory, expected);
+    }
+}
+
+TEST(WindowTest, accumulate_sum) {
+    Communicator comm;
+    auto         window = Window<int>::allocate(comm, 2);
+    std::fill(window.local().begin(), window.local().end(), 0);
+    {
+        std::vector<int> const data{1, comm.rank_signed()};
+        auto                   epoch = window.fence_epoch();
+        for (size_t rank = 0; rank < comm.size(); ++rank) {
+            window.accumulate(send_buf(data), op(ops::plus<>{}), target(rank));
+        }
+    }
+    int const expected_sum = comm.size_signed() * (comm.size_signed() - 1) / 2;
+    EXPECT_THAT(window.local(), ElementsAre(comm.size_signed(), expected_sum));
+}
+
+TEST(WindowTest, fetch_and_op_counter) {
+    Communicator comm;
+    auto         window = Window<size_t>::allocate(comm, comm.rank() == 0 ? 1 : 0);
+    if (comm.rank() == 0) {
+        window.local()[0] = 0;
+    }
+    comm.barrier();
+
+    std::vector<size_t> tickets;
+    {
+        auto epoch = window.lock_all_epoch();
+        for (size_t i = 0; i < 10; ++i) {
+            tickets.push_back(window.fetch_and_op(send_buf(size_t{1}), op(ops::plus<>{}), target(0)));
+        }
+    }
+    // all tickets are distinct
+    std::vector<size_t> const all_tickets = comm.allgatherv(send_buf(tickets));
+    std::vector<size_t>       sorted_tickets(all_tickets);
+    std::sort(sorted_tickets.begin(), sorted_tickets.end());
+    std::vector<size_t> expected(10 * comm.size());
+    std::iota(expected.begin(), expected.end(), size_t{0});
+    EXPECT_EQ(sorted_tickets, expected);
+
+    comm.barrier();
+    if (comm.rank() == 0) {
+        auto epoch = window.lock_epoch(0);
+        EXPECT_EQ(window.fetch_and_op(send_buf(size_t{0}), op(MPI_NO_OP), target(0)), 10 * comm.size());
+    }
+}
+
+TEST(WindowTest, compare_and_swap) {
+    Communicator comm;
+    auto         window = Window<int>::allocate(comm, comm.rank() == 0 ? 1 : 0);
+    if (comm.rank() == 0) {
+        window.local()[0] = -1;
+    }
+    comm.barrier();
+
+    // exactly one rank succeeds in replacing -1 by its rank
+    int previous;
+    {
+        auto epoch = window.lock_epoch(0, MPI_LOCK_SHARED);
+        previous   = window.compare_and_swap(send_buf(comm.rank_signed()), compare_value(-1), target(0));
+    }
+    bool const succeeded = previous == -1;
+    EXPECT_EQ(comm.allreduce_single(send_buf(succeeded ? 1 : 0), op(ops::plus<>{})), 1);
+    int const winner = comm.allreduce_single(send_buf(succeeded ? comm.rank_signed() : -1), op(ops::max<>{}));
+    if (!succeeded) {
+        EXPECT_EQ(previous, winner);
+    }
+    comm.barrier();
+    if (comm.rank() == 0) {
+        EXPECT_EQ(window.local()[0], winner);
+    }
+}
+
+TEST(WindowTest, rput_and_rget_with_lock_all) {
+    Communicator comm;
+    auto         window = Window<int>::allocate(comm, comm.size());
+    std::fill(window.local().begin(), window.local().end(), 0);
+    comm.barrier();
+
+    size_t const     right = (comm.rank() + 1) % comm.size();
+    std::vector<int> data{comm.rank_signed() + 1};
+    std::vector<int> result(comm.size());
+    {
+        auto    epoch   = window.lock_all_epoch();
+        Request request = window.rput(send_buf(data), target(right), target_disp(comm.rank_signed()));
+        request.wait();
+        window.flush(static_cast<int>(right));
+        comm.barrier();
+        Request get_request = window.rget(recv_buf(result), target(right));
+        get_request.wait();
+    }
+    std::vector<int> expected(comm.size(), 0);
+    expected[comm.rank()] = comm.rank_signed() + 1;
+    EXPECT_EQ(result, expected);
+}
+
+TEST(WindowTest, post_start_complete_wait) {
+    Communicator comm;
+    if (comm.size() < 2) {
+        return;
+    }
+    auto window       = Window<int>::allocate(comm, 1);
+    window.local()[0] = -1;
+    Group const world(comm);
+    auto const  single_rank_group = [&](int rank) {
+        MPI_Group group;
+        MPI_Group_incl(world.mpi_group(), 1, &rank, &group);
+        return Group(group, true);
+    };
+    // rank 0 exposes its window to rank 1, which writes to it
+    if (comm.rank() == 0) {
+        auto epoch = window.exposure_epoch(single_rank_group(1));
+        epoch.close();
+        EXPECT_EQ(window.local()[0], 42);
+    } else if (comm.rank() == 1) {
+        int const value = 42;
+        auto      epoch = window.access_epoch(single_rank_group(0));
+        window.put(send_buf(value), target(0));
+    }
+}
+
+TEST(WindowTest, dynamic_window) {
+    Communicator     comm;
+    auto             window = Window<int>::create_dynamic(comm);
+    std::vector<int> memory(3, comm.rank_signed());
+    MPI_Aint const   address   = window.attach(Span<int>(memory.data(), memory.size()));
+    auto const       addresses = comm.allgather(send_buf(address));
+
+    size_t const     right = (comm.rank() + 1) % comm.size();
+    std::vector<int> result;
+    {
+        auto epoch = window.lock_all_epoch();
+        // displacements in dynamic windows are addresses in bytes
+        result = window.get(recv_count(2), target(right), target_disp(addresses[right] + MPI_Aint{sizeof(int)}));
+    }
+    EXPECT_THAT(result, ElementsAre(right, right));
+    comm.barrier();
+    window.detach(Span<int>(memory.data(), memory.size()));
+}
+
+TEST(WindowTest, move) {
+    Communicator comm;
+    auto         window = Window<int>::allocate(comm, 1);
+    MPI_Win      win    = window.mpi_window();
+    Window<int>  moved(std::move(window));
+    EXPECT_EQ(moved.mpi_window(), win);
+    EXPECT_EQ(window.mpi_window(), MPI_WIN_NULL);
+    auto other = Window<int>::allocate(comm, 2);
+    other      = std::move(moved);
+    EXPECT_EQ(other.mpi_window(), win);
+    EXPECT_EQ(other.local().size(), 1);
+}
@@ -0,0 +1,112 @@
+// This file is part of KaMPIng.
+//
+// Copyright 2025 The KaMPIng Authors
+//
+// KaMPIng is free software : you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+// version. KaMPIng is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+// for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with KaMPIng.  If not, see
+// <https://www.gnu.org/licenses/>.
+
+#include "test_assertions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "kamping/collectives/allgather.hpp"
+#include "kamping/communicator.hpp"
+#include "kamping/work_queue.hpp"
+
+using namespace ::kamping;
+using namespace ::testing;
+
+namespace {
+/// @brief Fetches \p values_per_rank values from \p counter on each rank and returns all fetched values sorted.
+std::vector<size_t> fetch_all(Communicator<> const& comm, GlobalCounter& counter, size_t values_per_rank) {
+    std::vector<size_t> values;
+    for (size_t i = 0; i < values_per_rank; ++i) {
+        values.push_back(counter.next());
+    }
+    std::vector<size_t> all_values = comm.allgatherv(send_buf(values));
+    std::sort(all_values.begin(), all_values.end());
+    return all_values;
+}
+} // namespace
+
+TEST(GlobalCounterTest, values_are_unique) {
+    Communicator  comm;
+    GlobalCounter counter(comm, 5);
+    auto const    values = fetch_all(comm, counter, 100);
+
+    std::vector<size_t> expected(100 * comm.size());
+    std::iota(expected.begin(), expected.end(), size_t{5});
+    EXPECT_EQ(values, expected);
+}
+
+TEST(GlobalCounterTest, values_are_unique_with_batching) {
+    Communicator  comm;
+    GlobalCounter counter(comm, 0, 8);
+    EXPECT_EQ(counter.batch_size(), 8);
+    auto const values = fetch_all(comm, counter, 100);
+
+    // each value is returned at most once, and values are only skipped at the end of the last batch of each node
+    EXPECT_EQ(std::adjacent_find(values.begin(), values.end()), values.end());
+    EXPECT_LT(values.back(), 100 * comm.size() + 8 * comm.size());
+}
+
+TEST(GlobalCounterTest, values_are_contiguous_with_batching_within_node) {
+    Communicator  comm;
+    GlobalCounter counter(comm, 0, 4);
+    // as all ranks of a node share the batches, the values are contiguous if a multiple of the batch size is fetched
+    auto const          node_comm = comm.split_to_shared_memory();
+    std::vector<size_t> values;
+    if (node_comm.rank() == 0) {
+        for (size_t i = 0; i < 4 * node_comm.size(); ++i) {
+            values.push_back(counter.next());
+        }
+    }
+    std::vector<size_t> all_values = comm.allgatherv(send_buf(values));
+    std::sort(all_values.begin(), all_values.end());
+    std::vector<size_t> expected(all_values.size());
+    std::iota(expected.begin(), expected.end(), size_t{0});
+    EXPECT_EQ(all_values, expected);
+}
+
+TEST(WorkQueueTest, all_items_are_processed_exactly_once) {
+    for (size_t batch_size: {size_t{1}, size_t{3}}) {
+        Communicator comm;
+        WorkQueue    queue(comm, 1000, 7, batch_size);
+        EXPECT_EQ(queue.num_items(), 1000);
+        EXPECT_EQ(queue.chunk_size(), 7);
+
+        std::vector<size_t> processed;
+        while (auto chunk = queue.next_chunk()) {
+            EXPECT_LT(chunk->begin, chunk->end);
+            EXPECT_LE(chunk->end - chunk->begin, 7);
+            for (size_t item = chunk->begin; item < chunk->end; ++item) {
+                processed.push_back(item);
+            }
+        }
+        EXPECT_FALSE(queue.next_chunk().has_value());
+
+        std::vector<size_t> all_processed = comm.allgatherv(send_buf(processed));
+        std::sort(all_processed.begin(), all_processed.end());
+        std::vector<size_t> expected(1000);
+        std::iota(expected.begin(), expected.end(), size_t{0});
+        EXPECT_EQ(all_processed, expected);
+    }
+}
+
+TEST(WorkQueueTest, empty_queue) {
+    Communicator comm;
+    WorkQueue    queue(comm, 0);
+    EXPECT_FALSE(queue.next_chunk().has_value());
+}